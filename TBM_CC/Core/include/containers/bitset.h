@@ -0,0 +1,147 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef BITSET_H
+#define BITSET_H
+
+#include <stdint.h>
+
+/**
+ * @brief   Fixed-width bitset built from 32-bit words
+ * @details Bit n lives in word (n >> 5) at position (n & 0x1f). Searches use
+ *          CLZ/CTZ (a single 'clz', or 'rbit'+'clz', on the Cortex-M7) and
+ *          only loop over words, never over individual bits.
+ *
+ *          BITSET_DECLARE(occupied, 40);        // uint32_t occupied[2]
+ *          bitset_set(occupied, 33);
+ *          int32_t idx = bitset_ffs(occupied, BITSET_WORDS(40)); // == 33
+ *
+ * @note    bitset_ffz() may return an index past the logical width when the
+ *          width is not a multiple of 32, callers compare against their width.
+ **/
+#define BITSET_BITS_PER_WORD 32
+#define BITSET_WORDS(nbits)  (((nbits) + 0x1f) >> 0x5)
+#define BITSET_DECLARE(name, nbits) uint32_t name[BITSET_WORDS(nbits)]
+#define BITSET_NONE (-1)
+
+/** @brief Index of the lowest set bit of a non-zero word (CTZ) */
+static inline uint32_t
+bits_ffs32(uint32_t word)
+{
+  return (uint32_t)__builtin_ctz(word);
+}
+
+/** @brief Index of the highest set bit of a non-zero word (31 - CLZ) */
+static inline uint32_t
+bits_fls32(uint32_t word)
+{
+  return 0x1f - (uint32_t)__builtin_clz(word);
+}
+
+static inline uint32_t
+bits_popcount32(uint32_t word)
+{
+  return (uint32_t)__builtin_popcount(word);
+}
+
+/** @brief Clears and returns the index of the lowest set bit of a non-zero word */
+static inline uint32_t
+bits_pop_lowest32(uint32_t * word)
+{
+  uint32_t idx = bits_ffs32(*word);
+  *word &= (*word - 1); // clear lowest set bit, no shift needed
+  return idx;
+}
+
+static inline void
+bitset_zero(uint32_t * bits, uint32_t nwords)
+{
+  while (nwords--) { bits[nwords] = 0x0; }
+}
+
+static inline void
+bitset_set(uint32_t * bits, uint32_t idx)
+{
+  bits[idx >> 0x5] |= (0x1UL << (idx & 0x1f));
+}
+
+static inline void
+bitset_clear(uint32_t * bits, uint32_t idx)
+{
+  bits[idx >> 0x5] &= ~(0x1UL << (idx & 0x1f));
+}
+
+static inline uint32_t
+bitset_test(const uint32_t * bits, uint32_t idx)
+{
+  return (bits[idx >> 0x5] >> (idx & 0x1f)) & 0x1;
+}
+
+/** @brief Set or clear without branching on 'value' */
+static inline void
+bitset_assign(uint32_t * bits, uint32_t idx, uint32_t value)
+{
+  uint32_t mask = (0x1UL << (idx & 0x1f));
+  bits[idx >> 0x5] = (bits[idx >> 0x5] & ~mask) | (mask * (value != 0));
+}
+
+/** @brief Lowest set bit, BITSET_NONE if every bit is clear */
+static inline int32_t
+bitset_ffs(const uint32_t * bits, uint32_t nwords)
+{
+  for (uint32_t w = 0; w < nwords; w++)
+  {
+    if (bits[w] != 0) { return (int32_t)((w << 0x5) + bits_ffs32(bits[w])); }
+  }
+  return BITSET_NONE;
+}
+
+/** @brief Highest set bit, BITSET_NONE if every bit is clear */
+static inline int32_t
+bitset_fls(const uint32_t * bits, uint32_t nwords)
+{
+  while (nwords--)
+  {
+    if (bits[nwords] != 0) { return (int32_t)((nwords << 0x5) + bits_fls32(bits[nwords])); }
+  }
+  return BITSET_NONE;
+}
+
+/** @brief Lowest clear bit, BITSET_NONE if every bit is set. Used for id allocation */
+static inline int32_t
+bitset_ffz(const uint32_t * bits, uint32_t nwords)
+{
+  for (uint32_t w = 0; w < nwords; w++)
+  {
+    if (bits[w] != 0xffffffff) { return (int32_t)((w << 0x5) + bits_ffs32(~bits[w])); }
+  }
+  return BITSET_NONE;
+}
+
+/** @brief Lowest set bit at or after 'from', BITSET_NONE if there is none */
+static inline int32_t
+bitset_next(const uint32_t * bits, uint32_t nwords, uint32_t from)
+{
+  uint32_t w = from >> 0x5;
+  if (w >= nwords) { return BITSET_NONE; }
+
+  uint32_t word = bits[w] & (0xffffffff << (from & 0x1f)); // mask off bits below 'from'
+  for (;;)
+  {
+    if (word != 0) { return (int32_t)((w << 0x5) + bits_ffs32(word)); }
+    if (++w >= nwords) { return BITSET_NONE; }
+    word = bits[w];
+  }
+}
+
+static inline uint32_t
+bitset_count(const uint32_t * bits, uint32_t nwords)
+{
+  uint32_t count = 0;
+  while (nwords--) { count += bits_popcount32(bits[nwords]); }
+  return count;
+}
+
+#endif // BITSET_H
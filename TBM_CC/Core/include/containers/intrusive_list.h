@@ -0,0 +1,170 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief   Intrusive, circular, doubly-linked list
+ * @details The link lives inside the owning object, so nothing is allocated
+ *          when linking or unlinking. The list head is a sentinel node that
+ *          points back to itself when empty, which lets insert and unlink run
+ *          without any NULL checks (no branches on the hot path).
+ *
+ *          typedef struct { ilist_node_s link; uint32_t payload; } item_s;
+ *          ilist_s list = ILIST_INIT(list);
+ *          ilist_push_back(&list, &item->link);
+ *          item_s* first = ILIST_ENTRY(ilist_first(&list), item_s, link);
+ *
+ * @note    Not interrupt safe on its own, lists shared with an ISR must be
+ *          modified inside __disable_irq()/__enable_irq().
+ **/
+typedef struct ilist_node
+{
+  struct ilist_node * prev;
+  struct ilist_node * next;
+} ilist_node_s;
+
+typedef struct
+{
+  ilist_node_s head; // Sentinel, never an actual element
+} ilist_s;
+
+/** @brief Static initializer for a list head, e.g. 'ilist_s l = ILIST_INIT(l);' */
+#define ILIST_INIT(list) {{&(list).head, &(list).head}}
+
+/** @brief Resolve the object which embeds the given link */
+#define ILIST_ENTRY(node_ptr, type, member) \
+  ((type *)(((uint8_t *)(node_ptr)) - offsetof(type, member)))
+
+/** @brief Iterate every node, the loop body must not unlink 'node' */
+#define ILIST_FOR_EACH(node, list) \
+  for ((node) = (list)->head.next; (node) != &(list)->head; (node) = (node)->next)
+
+/** @brief Iterate every node, the loop body may unlink 'node' (not 'tmp') */
+#define ILIST_FOR_EACH_SAFE(node, tmp, list)                                  \
+  for ((node) = (list)->head.next, (tmp) = (node)->next;                      \
+       (node) != &(list)->head;                                               \
+       (node) = (tmp), (tmp) = (node)->next)
+
+static inline void
+ilist_init(ilist_s * list)
+{
+  list->head.prev = list->head.next = &list->head;
+}
+
+/** @brief A node that is not linked anywhere points to itself */
+static inline void
+ilist_node_init(ilist_node_s * node)
+{
+  node->prev = node->next = node;
+}
+
+static inline uint8_t
+ilist_empty(const ilist_s * list)
+{
+  return list->head.next == &list->head;
+}
+
+static inline uint8_t
+ilist_node_linked(const ilist_node_s * node)
+{
+  return node->next != node;
+}
+
+/** @brief First node, or the sentinel (&list->head) if empty */
+static inline ilist_node_s *
+ilist_first(ilist_s * list)
+{
+  return list->head.next;
+}
+
+/** @brief Last node, or the sentinel (&list->head) if empty */
+static inline ilist_node_s *
+ilist_last(ilist_s * list)
+{
+  return list->head.prev;
+}
+
+/** @brief Link 'node' in between two adjacent nodes, O(1) */
+static inline void
+__ilist_link__(ilist_node_s * node, ilist_node_s * prev, ilist_node_s * next)
+{
+  node->prev = prev;
+  node->next = next;
+  prev->next = node;
+  next->prev = node;
+}
+
+static inline void
+ilist_insert_after(ilist_node_s * pos, ilist_node_s * node)
+{
+  __ilist_link__(node, pos, pos->next);
+}
+
+static inline void
+ilist_insert_before(ilist_node_s * pos, ilist_node_s * node)
+{
+  __ilist_link__(node, pos->prev, pos);
+}
+
+static inline void
+ilist_push_front(ilist_s * list, ilist_node_s * node)
+{
+  __ilist_link__(node, &list->head, list->head.next);
+}
+
+static inline void
+ilist_push_back(ilist_s * list, ilist_node_s * node)
+{
+  __ilist_link__(node, list->head.prev, &list->head);
+}
+
+/**
+ * @brief   Unlink a node from whichever list it is in, O(1)
+ * @details Safe to call on an unlinked (self-pointing) node, the node is
+ *          left self-pointing so a second unlink is a no-op.
+ **/
+static inline void
+ilist_unlink(ilist_node_s * node)
+{
+  node->prev->next = node->next;
+  node->next->prev = node->prev;
+  node->prev = node->next = node;
+}
+
+/** @brief Unlink and return the first node, NULL if empty */
+static inline ilist_node_s *
+ilist_pop_front(ilist_s * list)
+{
+  ilist_node_s * node = list->head.next;
+  if (node == &list->head) { return NULL; }
+  ilist_unlink(node);
+  return node;
+}
+
+/**
+ * @brief Move every node of 'src' to the end of 'dst', leaves 'src' empty, O(1)
+ **/
+static inline void
+ilist_splice_back(ilist_s * dst, ilist_s * src)
+{
+  if (ilist_empty(src)) { return; }
+
+  ilist_node_s * first = src->head.next;
+  ilist_node_s * last  = src->head.prev;
+
+  first->prev          = dst->head.prev;
+  dst->head.prev->next = first;
+  last->next           = &dst->head;
+  dst->head.prev       = last;
+
+  ilist_init(src);
+}
+
+#endif // INTRUSIVE_LIST_H
@@ -0,0 +1,86 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MIN_HEAP_H
+#define MIN_HEAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief   Intrusive binary min-heap keyed on a 64-bit value
+ * @details The node lives inside the owning object and remembers its own
+ *          position, so remove and re-key of an arbitrary node are O(log n)
+ *          without a search. The heap only stores pointers in caller provided
+ *          storage, nothing is allocated.
+ *
+ *          typedef struct { mheap_node_s node; void* payload; } deadline_s;
+ *          static mheap_node_s* storage[32];
+ *          mheap_s heap;
+ *          mheap_init(&heap, storage, 32);
+ *          item->node.key = deadline;
+ *          mheap_push(&heap, &item->node);
+ *          deadline_s* next = MHEAP_ENTRY(mheap_peek(&heap), deadline_s, node);
+ *
+ * @note    Not interrupt safe on its own, same rules as the intrusive list.
+ **/
+typedef struct
+{
+  uint64_t key;
+  uint32_t slot; // Position in the heap + 1, 0 when not queued (so zeroed nodes are valid)
+} mheap_node_s;
+
+typedef struct
+{
+  mheap_node_s** nodes;
+  uint32_t       size;
+  uint32_t       capacity;
+} mheap_s;
+
+/** @brief Resolve the object which embeds the given heap node */
+#define MHEAP_ENTRY(node_ptr, type, member) \
+  ((type *)(((uint8_t *)(node_ptr)) - offsetof(type, member)))
+
+void mheap_init(mheap_s* heap, mheap_node_s** storage, uint32_t capacity);
+
+static inline void
+mheap_node_init(mheap_node_s* node)
+{
+  node->key  = 0;
+  node->slot = 0;
+}
+
+static inline uint8_t
+mheap_queued(const mheap_node_s* node)
+{
+  return node->slot != 0;
+}
+
+static inline uint32_t
+mheap_size(const mheap_s* heap)
+{
+  return heap->size;
+}
+
+/** @brief Smallest key, NULL if empty. O(1) */
+static inline mheap_node_s*
+mheap_peek(const mheap_s* heap)
+{
+  return (heap->size != 0) ? heap->nodes[0] : NULL;
+}
+
+/** @brief Insert 'node' with its current key, O(log n). Returns 0 when the storage is full */
+uint8_t mheap_push(mheap_s* heap, mheap_node_s* node);
+
+/** @brief Remove and return the smallest key, NULL if empty. O(log n) */
+mheap_node_s* mheap_pop(mheap_s* heap);
+
+/** @brief Remove an arbitrary queued node, no-op on a node that is not queued. O(log n) */
+void mheap_remove(mheap_s* heap, mheap_node_s* node);
+
+/** @brief Change the key of a queued node and restore the heap order. O(log n) */
+void mheap_update(mheap_s* heap, mheap_node_s* node, uint64_t key);
+
+#endif // MIN_HEAP_H
@@ -0,0 +1,83 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef CLOCK_DISCIPLINE_H
+#define CLOCK_DISCIPLINE_H
+
+#include <stdint.h>
+
+#include "typedefs/ttimer_mgr.h"
+#include "monotonic_clock.h"
+
+/**
+ * @brief   Oscillator discipline from a 1PPS input, corrects the rate of every timer
+ * @details Every PPS stamp (GPT2 capture, see input_capture.h) closes a type-2
+ *          PI loop on the phase of the counter's seconds: the integral term
+ *          steers the frequency estimate, the proportional term pulls the phase
+ *          back. The loop starts wide (fast acquisition) and narrows once the
+ *          phase has stayed within DISCIPLINE_LOCK_TICKS for DISCIPLINE_LOCK_EDGES
+ *          edges. Intervals more than ~1000ppm off (missed or glitched pulses)
+ *          are rejected.
+ *
+ *          GPT2 (24MHz oscillator) and the PIT (IPG, PLL locked to the same
+ *          crystal) share one reference, so the rate error measured on GPT2
+ *          applies to the monotonic clock and to PIT load values alike:
+ *
+ *          discipline_init(TIMER_GPT_HZ);
+ *          while (capture_ring_pop(&pps_ring, &stamp)) { discipline_pps(stamp, clock_now_ns()); }
+ *          time_ns64_t now = discipline_now_ns();                 // Rate corrected clock_now_ns()
+ *          PIT_LDVAL1 = discipline_compensate_ticks(ldval);      // Exact period despite the drift
+ *
+ * @note    Only the rate is corrected, the phase of discipline_now_ns() is not
+ *          aligned to the PPS edge (it is a different counter).
+ **/
+#define DISCIPLINE_LOCK_TICKS 8 // |phase| below this many counter ticks (~330ns at 24MHz) counts as locked
+#define DISCIPLINE_LOCK_EDGES 8
+#define DISCIPLINE_MAX_PPM    1000
+
+typedef enum
+{
+  DISCIPLINE_PRIMED,   // First stamp, nothing measured yet
+  DISCIPLINE_TRACKING, // Interval accepted, loop updated
+  DISCIPLINE_REJECTED, // Interval outside DISCIPLINE_MAX_PPM, ignored
+} discipline_result_e;
+
+/** @brief Reset the loop for a counter nominally running at 'nominal_hz' */
+void discipline_init(uint32_t nominal_hz);
+
+/**
+ * @brief   Feed one PPS capture stamp
+ * @param   stamp      Raw 32-bit counter value latched at the edge
+ * @param   raw_now_ns clock_now_ns() when the stamp is processed, re-anchors the
+ *                     correction so discipline_correct_ns() stays continuous
+ **/
+discipline_result_e discipline_pps(uint32_t stamp, time_ns64_t raw_now_ns);
+
+/** @brief Loop has converged and runs with the narrow gains */
+uint8_t discipline_locked();
+
+/** @brief Measured oscillator error in parts per billion, positive when running fast */
+int32_t discipline_ppb();
+
+/** @brief Estimated true counter rate in Hz, rounded down */
+uint32_t discipline_freq_hz();
+
+/** @brief Intervals rejected as outliers */
+uint32_t discipline_rejected();
+
+/** @brief Rate corrected time for a raw monotonic clock reading */
+time_ns64_t discipline_correct_ns(time_ns64_t raw_ns);
+
+/** @brief Ticks of a nominal-rate period to ticks of the real oscillator, for PIT LDVAL or GPT OCR values */
+uint32_t discipline_compensate_ticks(uint32_t nominal_ticks);
+
+/** @brief Rate corrected clock_now_ns() */
+static inline time_ns64_t
+discipline_now_ns()
+{
+  return discipline_correct_ns(clock_now_ns());
+}
+
+#endif // CLOCK_DISCIPLINE_H
@@ -0,0 +1,196 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef EDMA_H
+#define EDMA_H
+
+#include <stdint.h>
+
+#include "sys/irq_dispatch.h"
+
+/**
+ * @brief   Single-descriptor eDMA channels for peripheral FIFOs
+ * @details One major loop per transfer: every hardware request of the
+ *          peripheral (DMAMUX source) moves one unit of 1, 2 or 4 bytes between
+ *          a buffer and a fixed register. The completion interrupt runs the
+ *          channel's callback, the CPU is not involved in between:
+ *
+ *          static edma_channel_s dma;
+ *          edma_enable(&dma, 0x0, EDMA_SOURCE_LPI2C1, 0x40);
+ *          edma_tcd_mem_to_periph(dma.tcd, (uint32_t)buf, (uint32_t)&fifo, EDMA_SIZE_8BIT, len);
+ *          edma_start(&dma, &on_done, ctx);
+ *
+ *          Controller and descriptor are pointers held by the channel, so
+ *          'make hosttest' runs the same code on fake register blocks.
+ *
+ * @note    Buffers are read by the bus master, not the core. Keep them out of
+ *          cached memory (DTCM, the default for .data/.bss, is uncached) or
+ *          clean the cache before edma_start().
+ **/
+#define EDMA_CHANNELS  32
+#define EDMA_MAX_ITER  0x7fff // CITER/BITER without channel linking
+
+#define EDMA_BASE_ADDR 0x400e8000
+#define EDMA_TCD_ADDR  0x400e9000 // TCD0, 0x20 apart
+#define EDMA_MUX_ADDR  0x400ec000 // DMAMUX CHCFG0, 0x4 apart
+
+#define EDMA_MUX_ENBL  (0x1UL << 0x1f)
+
+/** @brief DMAMUX request sources, 4.4 p.52 */
+#define EDMA_SOURCE_FLEXIO1_01 0x0  // Shifters 0 and 1
+#define EDMA_SOURCE_FLEXIO2_01 0x1
+#define EDMA_SOURCE_LPI2C1     0x11
+#define EDMA_SOURCE_LPI2C3     0x12
+#define EDMA_SOURCE_FLEXIO1_23 0x40 // Shifters 2 and 3
+#define EDMA_SOURCE_FLEXIO2_23 0x41
+#define EDMA_SOURCE_LPI2C2     0x51
+#define EDMA_SOURCE_LPI2C4     0x52
+
+/** @brief LPI2C'n' (1-4) request, the ports are not numbered in order */
+#define EDMA_SOURCE_LPI2C(n)                                            \
+  ((n) == 1 ? EDMA_SOURCE_LPI2C1 : (n) == 2 ? EDMA_SOURCE_LPI2C2 :      \
+   (n) == 3 ? EDMA_SOURCE_LPI2C3 : EDMA_SOURCE_LPI2C4)
+
+/** @brief Transfer unit, the ATTR size encoding (log2 of the byte count) */
+typedef enum
+{
+  EDMA_SIZE_8BIT  = 0x0,
+  EDMA_SIZE_16BIT = 0x1,
+  EDMA_SIZE_32BIT = 0x2,
+} edma_size_e;
+
+/** @brief Controller registers up to HRS, 6.6 p.115. Byte-wide write-only aliases take a channel number */
+typedef struct
+{
+  volatile uint32_t CR;
+  volatile uint32_t ES;   // RO
+  uint32_t          reserved0;
+  volatile uint32_t ERQ;
+  uint32_t          reserved1;
+  volatile uint32_t EEI;
+  volatile uint8_t  CEEI; // WO
+  volatile uint8_t  SEEI; // WO
+  volatile uint8_t  CERQ; // WO
+  volatile uint8_t  SERQ; // WO
+  volatile uint8_t  CDNE; // WO
+  volatile uint8_t  SSRT; // WO
+  volatile uint8_t  CERR; // WO
+  volatile uint8_t  CINT; // WO
+  uint32_t          reserved2;
+  volatile uint32_t INT;  // W1C
+  uint32_t          reserved3;
+  volatile uint32_t ERR;  // W1C
+  uint32_t          reserved4;
+  volatile uint32_t HRS;  // RO
+} edma_regs_s;
+
+/** @brief Transfer control descriptor, 32 bytes per channel, 6.6.5.19 p.141 */
+typedef struct
+{
+  volatile uint32_t SADDR;
+  volatile int16_t  SOFF;
+  volatile uint16_t ATTR;
+  volatile uint32_t NBYTES;
+  volatile int32_t  SLAST;
+  volatile uint32_t DADDR;
+  volatile int16_t  DOFF;
+  volatile uint16_t CITER;
+  volatile int32_t  DLASTSGA;
+  volatile uint16_t CSR;
+  volatile uint16_t BITER;
+} edma_tcd_s;
+
+#define EDMA_REGS         ((volatile edma_regs_s*)EDMA_BASE_ADDR)
+#define EDMA_TCD(ch)      ((volatile edma_tcd_s*)(EDMA_TCD_ADDR + ((uint32_t)(ch) << 0x5)))
+#define EDMA_MUX_CHCFG(ch) ((volatile uint32_t*)(EDMA_MUX_ADDR + ((uint32_t)(ch) << 0x2)))
+
+#define EDMA_ATTR(ssize, dsize) ((uint16_t)(((ssize) << 0x8) | (dsize)))
+#define EDMA_CSR_START    (0x1 << 0x0)
+#define EDMA_CSR_INTMAJOR (0x1 << 0x1)
+#define EDMA_CSR_DREQ     (0x1 << 0x3) // Clear ERQ at the end of the major loop
+#define EDMA_CSR_DONE     (0x1 << 0x7)
+
+/** @brief Completion callback, 'error' is non-zero when the controller flagged the channel */
+typedef void (*edma_done_fp)(void* ctx, uint8_t error);
+
+typedef struct
+{
+  volatile edma_regs_s* regs;
+  volatile edma_tcd_s*  tcd;
+  edma_done_fp          done;
+  void*                 ctx;
+  irq_slot_s            slots[2]; // Channel line, shared error line
+  uint8_t               ch;
+  volatile uint8_t      busy;
+} edma_channel_s;
+
+/**
+ * @brief   Descriptor for 'count' units from 'src' to the fixed register 'dst'
+ * @details Source advances by one unit per request and is rewound at the end,
+ *          DREQ stops the requests after the last unit so a late FIFO request
+ *          can not restart the descriptor.
+ **/
+static inline void
+edma_tcd_mem_to_periph(volatile edma_tcd_s* tcd, uint32_t src, uint32_t dst, edma_size_e size, uint16_t count)
+{
+  tcd->CSR      = 0;
+  tcd->SADDR    = src;
+  tcd->SOFF     = (int16_t)(0x1 << size);
+  tcd->ATTR     = EDMA_ATTR(size, size);
+  tcd->NBYTES   = 0x1UL << size;
+  tcd->SLAST    = -(int32_t)((uint32_t)count << size);
+  tcd->DADDR    = dst;
+  tcd->DOFF     = 0;
+  tcd->CITER    = count;
+  tcd->DLASTSGA = 0;
+  tcd->BITER    = count;
+  tcd->CSR      = EDMA_CSR_INTMAJOR | EDMA_CSR_DREQ;
+}
+
+/** @brief Descriptor for 'count' units from the fixed register 'src' into 'dst' */
+static inline void
+edma_tcd_periph_to_mem(volatile edma_tcd_s* tcd, uint32_t src, uint32_t dst, edma_size_e size, uint16_t count)
+{
+  tcd->CSR      = 0;
+  tcd->SADDR    = src;
+  tcd->SOFF     = 0;
+  tcd->ATTR     = EDMA_ATTR(size, size);
+  tcd->NBYTES   = 0x1UL << size;
+  tcd->SLAST    = 0;
+  tcd->DADDR    = dst;
+  tcd->DOFF     = (int16_t)(0x1 << size);
+  tcd->CITER    = count;
+  tcd->DLASTSGA = -(int32_t)((uint32_t)count << size);
+  tcd->BITER    = count;
+  tcd->CSR      = EDMA_CSR_INTMAJOR | EDMA_CSR_DREQ;
+}
+
+/** @brief Bind 'chan' to channel 'ch' of 'regs' with descriptor 'tcd', no hardware access */
+void edma_channel_init(edma_channel_s* chan, volatile edma_regs_s* regs, volatile edma_tcd_s* tcd, uint8_t ch);
+
+/**
+ * @brief   Gate the eDMA clock, route 'source' to channel 'ch' and hook its interrupt lines
+ * @details DMA channel n and n+16 share IRQ line n, the error line is shared by
+ *          every channel. edma_service() checks the channel's own flags.
+ **/
+void edma_enable(edma_channel_s* chan, uint8_t ch, uint8_t source, uint8_t nvic_priority);
+
+/** @brief Arm the loaded descriptor for hardware requests, 0 while a transfer is still running */
+uint8_t edma_start(edma_channel_s* chan, edma_done_fp done, void* ctx);
+
+/** @brief Drop the request enable, the callback is not run */
+void edma_stop(edma_channel_s* chan);
+
+/** @brief Interrupt side, acknowledges completion or error of 'chan' and runs its callback once */
+void edma_service(edma_channel_s* chan);
+
+/** @brief Units not yet moved by the running descriptor */
+static inline uint16_t
+edma_remaining(const edma_channel_s* chan)
+{
+  return chan->busy ? chan->tcd->CITER : 0;
+}
+
+#endif // EDMA_H
@@ -0,0 +1,229 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef FLEXIO_H
+#define FLEXIO_H
+
+#include <stdint.h>
+
+#include "edma.h"
+#include "pinmux.h"
+
+/**
+ * @brief   FlexIO protocol engine, one shifter and one timer per transmit lane
+ * @details A program is the five register values of a shifter/timer pair,
+ *          computed once by a builder and loaded with flexio_load(). From then
+ *          on the timer generates the clock (or strobe) and the shifter the
+ *          data, the CPU only fills the shifter buffer, or hands that to eDMA:
+ *
+ *          static flexio_s spi;
+ *          static flexio_program_s prog;
+ *          flexio_enable(&spi, 2);                                     // FlexIO2, FLEXIO_CLOCK_HZ
+ *          flexio_program_spi(&prog, 0, 0, 2, 3, spi.hz, 8000000); // MOSI FlexIO2_D02, SCK D03
+ *          flexio_load(&spi, &prog);
+ *          flexio_write_dma(&spi, &dma, frame, sizeof(frame), &on_done, NULL);
+ *
+ *          Builders exist for SPI mode 0 (MSB first, 8-bit frames), an 8080
+ *          style 8-bit parallel bus with WR strobe, and WS2812 LED strips (each
+ *          data bit becomes three symbols, 100 or 110, at 2.4MHz, see
+ *          flexio_ws2812_encode()). I2C needs open-drain ACK sampling a TX
+ *          lane can not do, it goes through the LPI2C controllers instead.
+ *
+ *          The register block is a parameter, 'make hosttest' loads and runs
+ *          programs on a fake one.
+ *
+ * @note    Only shifters 0-3 of FlexIO1/2 have DMA requests, FlexIO3 has none.
+ *          The DMA callback runs when the last unit is in the shifter buffer,
+ *          up to two units are still on the wire, see flexio_flush().
+ **/
+#define FLEXIO_SHIFTERS 8
+#define FLEXIO_TIMERS   8
+#define FLEXIO_PINS     32
+#define FLEXIO_DMA_SHIFTERS 4
+
+#define FLEXIO_CLOCK_HZ 120000000UL // flexio_enable(), pll3_sw_clk (480MHz) / 4
+
+/** @brief FlexIOn base address, 50.5.1 p.2923 */
+#define FLEXIO_ADDR(n) (((n) == 1) ? 0x401ac000 : (((n) == 2) ? 0x401b0000 : 0x42020000))
+
+/** @brief Pad carrying FlexIO2_Dn, GPIO_B0_00-15 then GPIO_B1_00-15, both on ALT4 */
+#define FLEXIO2_PAD(pin) (((pin) < 16) ? PINMUX_PAD_B0(pin) : PINMUX_PAD_B1((pin) - 16))
+#define FLEXIO2_ALT      0x4
+
+/** @brief FlexIO register block, uint32_t so the layout also holds on a 64-bit host */
+typedef struct
+{
+  volatile uint32_t VERID;       // 0x000
+  volatile uint32_t PARAM;
+  volatile uint32_t CTRL;
+  volatile uint32_t PIN;
+  volatile uint32_t SHIFTSTAT;   // 0x010, W1C
+  volatile uint32_t SHIFTERR;    // W1C
+  volatile uint32_t TIMSTAT;     // W1C
+  uint32_t          reserved0;
+  volatile uint32_t SHIFTSIEN;   // 0x020
+  volatile uint32_t SHIFTEIEN;
+  volatile uint32_t TIMIEN;
+  uint32_t          reserved1;
+  volatile uint32_t SHIFTSDEN;   // 0x030
+  uint32_t          reserved2[3];
+  volatile uint32_t SHIFTSTATE;  // 0x040
+  uint32_t          reserved3[15];
+  volatile uint32_t SHIFTCTL[FLEXIO_SHIFTERS];    // 0x080
+  uint32_t          reserved4[24];
+  volatile uint32_t SHIFTCFG[FLEXIO_SHIFTERS];    // 0x100
+  uint32_t          reserved5[56];
+  volatile uint32_t SHIFTBUF[FLEXIO_SHIFTERS];    // 0x200
+  uint32_t          reserved6[24];
+  volatile uint32_t SHIFTBUFBIS[FLEXIO_SHIFTERS]; // 0x280, bit swapped
+  uint32_t          reserved7[24];
+  volatile uint32_t SHIFTBUFBYS[FLEXIO_SHIFTERS]; // 0x300, byte swapped
+  uint32_t          reserved8[24];
+  volatile uint32_t SHIFTBUFBBS[FLEXIO_SHIFTERS]; // 0x380, bit and byte swapped
+  uint32_t          reserved9[24];
+  volatile uint32_t TIMCTL[FLEXIO_TIMERS];        // 0x400
+  uint32_t          reserved10[24];
+  volatile uint32_t TIMCFG[FLEXIO_TIMERS];        // 0x480
+  uint32_t          reserved11[24];
+  volatile uint32_t TIMCMP[FLEXIO_TIMERS];        // 0x500
+} flexio_regs_s;
+
+#define FLEXIO_PORT(n) ((volatile flexio_regs_s*)FLEXIO_ADDR(n))
+
+#define FLEXIO_CTRL_FLEXEN  (0x1UL << 0x0)
+#define FLEXIO_CTRL_SWRST   (0x1UL << 0x1)
+#define FLEXIO_CTRL_DBGE    (0x1UL << 0x1e)
+
+#define FLEXIO_PINCFG_OFF    0x0
+#define FLEXIO_PINCFG_OUTPUT 0x3
+
+#define FLEXIO_SHIFTCTL_TIMSEL(t)  ((uint32_t)(t) << 0x18)
+#define FLEXIO_SHIFTCTL_TIMPOL_NEG (0x1UL << 0x17) // Shift on the falling edge of the timer output
+#define FLEXIO_SHIFTCTL_PINCFG(x)  ((uint32_t)(x) << 0x10)
+#define FLEXIO_SHIFTCTL_PINSEL(p)  ((uint32_t)(p) << 0x8)
+#define FLEXIO_SHIFTCTL_SMOD_TX    0x2UL
+#define FLEXIO_SHIFTCFG_PWIDTH(w)  ((uint32_t)(w) << 0x10) // Bits per shift minus one
+#define FLEXIO_SHIFTCFG_LOAD_SHIFT 0x1UL // No start bit, the first shift clock loads the buffer
+
+#define FLEXIO_TIMCTL_TRGSEL(x)    ((uint32_t)(x) << 0x18)
+#define FLEXIO_TIMCTL_TRGPOL_LOW   (0x1UL << 0x17)
+#define FLEXIO_TIMCTL_TRGSRC_INT   (0x1UL << 0x16)
+#define FLEXIO_TIMCTL_PINCFG(x)    ((uint32_t)(x) << 0x10)
+#define FLEXIO_TIMCTL_PINSEL(p)    ((uint32_t)(p) << 0x8)
+#define FLEXIO_TIMCTL_PINPOL_LOW   (0x1UL << 0x7)
+#define FLEXIO_TIMCTL_TIMOD_BAUD   0x1UL // Dual 8-bit counters, baud divider and bit count
+#define FLEXIO_TRIGGER_SHIFTER(n)  (((uint32_t)(n) << 0x2) | 0x1) // Status flag of shifter n
+
+#define FLEXIO_TIMCFG_TIMOUT_ZERO  (0x1UL << 0x18)
+#define FLEXIO_TIMCFG_TIMDIS_CMP   (0x2UL << 0xc)
+#define FLEXIO_TIMCFG_TIMENA_TRG   (0x2UL << 0x8)
+#define FLEXIO_TIMCFG_TSTOP_DIS    (0x2UL << 0x4)
+#define FLEXIO_TIMCFG_TSTART       (0x1UL << 0x1)
+
+/** @brief Baud mode compare, 'shifts' shift clocks per buffer load with half periods of 'div' + 1 FlexIO clocks */
+#define FLEXIO_TIMCMP_BAUD(shifts, div) ((((uint32_t)(shifts) * 2 - 1) << 0x8) | ((div) & 0xff))
+
+/** @brief Which SHIFTBUF alias a program writes, sets the bit order on the wire */
+typedef enum
+{
+  FLEXIO_BUF,     // LSB first
+  FLEXIO_BUF_BIS, // MSB first
+} flexio_buf_e;
+
+typedef struct
+{
+  uint32_t     shiftctl;
+  uint32_t     shiftcfg;
+  uint32_t     timctl;
+  uint32_t     timcfg;
+  uint32_t     timcmp;
+  uint32_t     hz;       // Shift clock actually generated
+  uint8_t      shifter;
+  uint8_t      timer;
+  uint8_t      unit;     // Bytes per buffer write, 1 or 4
+  flexio_buf_e buf;
+} flexio_program_s;
+
+typedef struct
+{
+  volatile flexio_regs_s* regs;
+  flexio_program_s        prog;
+  uint32_t                hz; // FlexIO functional clock
+  uint8_t                 port;
+  uint8_t                 loaded;
+} flexio_s;
+
+/** @brief SPI mode 0 transmit, 8-bit frames MSB first. Shift clock is at most 'baud', see prog->hz */
+void flexio_program_spi(flexio_program_s* prog,
+                        uint8_t           shifter,
+                        uint8_t           timer,
+                        uint8_t           mosi_pin,
+                        uint8_t           sck_pin,
+                        uint32_t          flexio_hz,
+                        uint32_t          baud);
+
+/**
+ * @brief   8080 style 8-bit parallel write, D0-D7 on 'd0_pin' upwards, active-low WR on 'wr_pin'
+ * @details Each buffer write sends four bytes, lowest first, data changes on the
+ *          falling WR edge and is latched by the display on the rising one,
+ *          half a strobe period of setup and hold each.
+ **/
+void flexio_program_8080(flexio_program_s* prog,
+                         uint8_t           shifter,
+                         uint8_t           timer,
+                         uint8_t           d0_pin,
+                         uint8_t           wr_pin,
+                         uint32_t          flexio_hz,
+                         uint32_t          strobe_hz);
+
+/** @brief WS2812 one-wire output on 'data_pin', words from flexio_ws2812_encode(), 2.4MHz symbol clock */
+void flexio_program_ws2812(flexio_program_s* prog,
+                           uint8_t           shifter,
+                           uint8_t           timer,
+                           uint8_t           data_pin,
+                           uint32_t          flexio_hz);
+
+#define FLEXIO_WS2812_HZ 2400000UL
+
+/** @brief Words needed for 'bytes' colour bytes, 24 symbols per byte */
+#define FLEXIO_WS2812_WORDS(bytes) (((bytes) * 3 + 3) >> 0x2)
+
+/** @brief Expand 'bytes' colour bytes (GRB order per LED) into symbol words, returns the word count */
+uint32_t flexio_ws2812_encode(const uint8_t* grb, uint32_t bytes, uint32_t* words);
+
+/** @brief Software reset of the module in 'regs', then enable it */
+void flexio_init(flexio_s* io, volatile flexio_regs_s* regs, uint32_t flexio_hz);
+
+/** @brief Gate FlexIO'n' (1-3) on, clock it with FLEXIO_CLOCK_HZ and flexio_init() it */
+void flexio_enable(flexio_s* io, uint8_t n);
+
+/** @brief Stop the lane of the previous program and start 'prog' */
+void flexio_load(flexio_s* io, const flexio_program_s* prog);
+
+/** @brief Disable shifter, timer and DMA request of the loaded program */
+void flexio_release(flexio_s* io);
+
+/** @brief Register the loaded program's units go to, the DMA destination */
+volatile void* flexio_tx_register(const flexio_s* io);
+
+/** @brief Polled transmit, 'len' is a multiple of the program's unit. Returns the bytes queued */
+uint32_t flexio_write(flexio_s* io, const uint8_t* data, uint32_t len);
+
+/** @brief Transmit through 'dma', 0 if the channel is busy, 'len' is not a multiple of the unit or too long */
+uint8_t flexio_write_dma(flexio_s* io, edma_channel_s* dma, const void* data, uint32_t len, edma_done_fp done, void* ctx);
+
+/** @brief DMAMUX source of 'shifter' on FlexIO'n', 0xff when it has none */
+uint8_t flexio_dma_source(uint8_t n, uint8_t shifter);
+
+/**
+ * @brief   Wait until the last queued unit has left the pins
+ * @details Waits for the empty buffer, clears the timer flag and waits for the
+ *          end of the frame in flight. The wait is bounded by one frame of
+ *          FlexIO clocks so a frame which ended before the flag was cleared can
+ *          not hang it. Call before reloading or releasing the lane.
+ **/
+void flexio_flush(flexio_s* io);
+
+#endif // FLEXIO_H
@@ -6,6 +6,9 @@
 #ifndef GPIO_HANDLER_H
 #define GPIO_HANDLER_H
 
+#include "gpio_irq.h"
+#include "gpio_port.h"
+#include "gpio_registry.h"
 #include "iomux_controller.h"
 #include "timer_manager.h"
 
@@ -83,9 +86,27 @@ typedef struct
   gpio_io_e        io_type;
 } gpiodev_s; // = {.base_mux_device->mux_mode = ALT5_GPIOx_IOx};
 
+/**
+ * @brief   Direction and module routing of one pin, see gpio_route_e in gpio_port.h
+ * @details 'port' is the pad bank (1-5), gpio_pin_configure() picks GPIO6-9 for
+ *          it unless 'route' says otherwise:
+ *
+ *          static const gpio_pin_config_s sck_config = GPIO_PIN_CONFIG(2, 3, GDIR_OUT, GPIO_ROUTE_AUTO);
+ *          gpio_pin_s sck;
+ *          gpio_pin_configure(&sck_config, &sck); // GPIO7_IO03, AHB clocked
+ **/
+typedef struct
+{
+  uint8_t      port;
+  uint8_t      bit;
+  gpio_io_e    io_type;
+  gpio_route_e route;
+} gpio_pin_config_s;
+
+#define GPIO_PIN_CONFIG(port, bit, io_type, route) {(port), (bit), (io_type), (route)}
+
 // EXTERNS
 extern trigger_gpio_fp_t tgpio_fp;
-extern gpiodev_s         current_gpio_devices[9];
 
 #define SET_GPIO_GDIR(gpio_gdir_addr, io_type, direction_bit)     \
   *gpio_gdir_addr |= ((0x1 * io_type) << direction_bit)
@@ -136,13 +157,22 @@ extern gpiodev_s         current_gpio_devices[9];
 
 // FUNCTION DECLARATIONS
 /**
- * @brief pointer to be able to source pin addresses to the interface
- * @param gpio_pin_addr const volatile uint32_t pointer to a gpio addr
- * @param pulse const uint8_t that indicates low or high pulse
+ * @brief Drive the line of 'gpio_device_id' (gpio_add_device()), the target of tgpio_fp
+ * @param gpio_device_id ID from gpio_add_device() or gpio_line_add()
+ * @param pulse const uint8_t that indicates low (0) or high (non-zero) pulse
  */
 void
 trigger_gpio(const uint8_t gpio_device_id, const unsigned char pulse);
 
+/**
+ * @brief  Register an initialized device (init_gpio()) for trigger_gpio()
+ * @return Its ID, GPIO_LINE_NONE when the registry is full or the device is not set up
+ */
+uint8_t gpio_add_device(const gpiodev_s* gpio_device);
+
+/** @brief Release an ID from gpio_add_device(), trigger_gpio() on it does nothing afterwards */
+void gpio_remove_device(const uint8_t gpio_device_id);
+
 void
 init_gpio(gpiodev_s*       gpio_device,
           gpio_registers_e gpio_register,
@@ -151,10 +181,33 @@ init_gpio(gpiodev_s*       gpio_device,
           uint8_t          ctrl_pos);
 
 /**
- * @brief: Set all MUX bits in the correct General Purpose Register (GPR)
+ * @brief: Set the direction on the module named by 'pin' and route the pin to it (GPR26-29)
  **/
 void set_gpr_gdir(gpiodev_s* gpio_device);
 
+/**
+ * @brief   Route one pin of pad bank 1-4 to its regular (0) or fast (!= 0) module
+ * @details Only the pin's bit of IOMUXC_GPR_GPR26-29 changes, other pins of the
+ *          bank keep their module. No-op for GPIO5.
+ **/
+void gpio_route_pin(uint8_t port, uint8_t bit, uint8_t fast);
+
+/**
+ * @brief   Route 'config' to its module, set its direction there and fill 'pin' for gpio_pin_*()
+ * @details The pad has to be muxed to GPIO (ALT5) already, see init_gpio().
+ * @return  Module now driving the pin (1-9), 0 for an invalid port
+ **/
+uint8_t gpio_pin_configure(const gpio_pin_config_s* config, gpio_pin_s* pin);
+
+/**
+ * @brief   Take the interrupt line(s) of 'port' (1-9) for 'irq', see gpio_irq.h
+ * @details Ports 1-5 get both half-port lines, GPIO6-9 share IRQ_GPIO6789 and
+ *          each enabled port adds its own slot to it. Edges are stamped with
+ *          clock_now_ticks() at ISR entry, so the stamp lags the edge by the
+ *          interrupt latency. init_monotonic_clock() has to run first.
+ **/
+void gpio_irq_enable(gpio_irq_s* irq, uint8_t port, uint8_t nvic_priority);
+
 /** @brief Initializes the stock LED device and return a heap pointer to it's created object */
 gpiodev_s* init_onboard_led();
 
@@ -166,7 +219,7 @@ timer_context_s* generate_led_device_context();
  * 
  * @param timerdatum Object which holds essential the timer data needed for interpreting values 
  * @param interrupt_callback The callback for an potential interrupt-based tick function, fp has no parameter requirements 
- * @param tick_callback The callback for an potential polling-based tick function, fp requires deltatime
+ * @param tick_callback The callback for an potential polling-based tick function, gets the delta-time in nano-seconds (time_ns64_t)
  * @return The new timer manager object which has been constructed on the heap 
  */
 inline timer_manager_s*
@@ -179,7 +232,7 @@ start_PITx(
   pit_timer->timer_ctx = generate_led_device_context();
 
   init_pitman(pit_timer, timerdatum, PIT_CH1, interrupt_callback, tick_callback);
-  setup_PITx(pit_timer); // start pit timer
+  pit_configure(pit_timer); // start pit timer
 
   SET_GPIO_REGISTER(GPIO7_DR_TOGGLE, 0x3); // Enable the given bit in the supplied flags/register
  
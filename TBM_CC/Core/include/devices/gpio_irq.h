@@ -0,0 +1,138 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef GPIO_IRQ_H
+#define GPIO_IRQ_H
+
+#include <stdint.h>
+
+#include "containers/bitset.h"
+#include "gpio_port.h"
+#include "sys/irq_dispatch.h"
+
+/**
+ * @brief   Edge interrupts of one GPIO port, (handler, context) and debounce per pin
+ * @details One gpio_irq_s serves all 32 pins of a port. Its entry reads
+ *          ISR & IMR once, clears those flags and walks the set bits with CLZ,
+ *          highest pin first. Each handler gets its context, the pin and the
+ *          time stamp taken at entry, so edges are timed by the interrupt and
+ *          not by whenever the handler gets to run:
+ *
+ *          static gpio_irq_s port2;
+ *          static void on_button(void* ctx, uint32_t pin, uint64_t stamp) { ... }
+ *          gpio_irq_enable(&port2, 2, 0x40);                                 // gpio_handler.h
+ *          gpio_irq_attach(&port2, 16, GPIO_IRQ_FALLING, &on_button, &btn, debounce_ticks);
+ *
+ *          Debounce drops an edge that comes less than 'debounce' stamp ticks
+ *          after the last accepted edge of the same pin. The stamps are
+ *          clock_now_ticks() on target (64-bit, never wraps) so a window can be
+ *          any length.
+ *
+ *          The stamp is software, read at ISR entry: it includes the interrupt
+ *          latency (stacking, a higher priority ISR or a masked section before
+ *          it) and every pin of one entry shares it. The GPIO module has no
+ *          time stamp of its own, an edge that needs tick accuracy goes to a
+ *          GPT capture pin instead (input_capture.h).
+ *
+ *          Table and scan are hardware independent, the register block is set
+ *          by gpio_irq_init() so 'make hosttest' runs the same code on a fake one.
+ *
+ * @note    The pad has to be an input on the module the port's registers belong
+ *          to, GPIO_ROUTE_AUTO leaves inputs on GPIO1-5 (one line per half port,
+ *          GPIO6-9 share IRQ_GPIO6789).
+ **/
+#define GPIO_IRQ_PINS 32
+
+/** @brief Trigger of a pin, the first four are the ICR encodings (gpio_icr_e) */
+typedef enum
+{
+  GPIO_IRQ_LOW     = 0x0,
+  GPIO_IRQ_HIGH    = 0x1,
+  GPIO_IRQ_RISING  = 0x2,
+  GPIO_IRQ_FALLING = 0x3,
+  GPIO_IRQ_BOTH    = 0x4, // EDGE_SEL, ICR is ignored
+} gpio_irq_edge_e;
+
+typedef void (*gpio_irq_fp)(void* ctx, uint32_t pin, uint64_t stamp);
+
+typedef struct
+{
+  gpio_irq_fp handler;
+  void*       ctx;
+  uint64_t    last;     // Stamp of the last accepted edge
+  uint64_t    debounce; // Stamp ticks, 0 passes every edge
+} gpio_irq_entry_s;
+
+typedef struct
+{
+  gpio_irq_entry_s           entries[GPIO_IRQ_PINS];
+  volatile gpio_port_regs_s* regs;
+  volatile uint32_t          attached; // Bit per pin with a handler
+  uint32_t                   primed;   // Bit per pin with an accepted edge, 'last' is valid
+  uint32_t                   bounced;  // Edges dropped by debounce
+  uint32_t                   spurious; // Entries with no flagged pin
+  irq_slot_s                 slots[2]; // The port's lines, see gpio_irq_enable()
+} gpio_irq_s;
+
+/** @brief Empty table for the port at 'regs', touches no register */
+void gpio_irq_init(gpio_irq_s* irq, volatile gpio_port_regs_s* regs);
+
+/**
+ * @brief   Set the handler of 'pin', program its trigger and unmask it
+ * @details The pin is masked while ICR/EDGE_SEL change and a flag raised by the
+ *          change is cleared before IMR is set again. Replaces a previous handler.
+ **/
+void gpio_irq_attach(gpio_irq_s*     irq,
+                     uint32_t        pin,
+                     gpio_irq_edge_e edge,
+                     gpio_irq_fp     handler,
+                     void*           ctx,
+                     uint64_t        debounce);
+
+/** @brief Mask 'pin' and remove its handler */
+void gpio_irq_detach(gpio_irq_s* irq, uint32_t pin);
+
+/** @brief Flagged and unmasked pins of 'regs', each flag is cleared (W1C) */
+static inline uint32_t
+gpio_irq_collect(volatile gpio_port_regs_s* regs)
+{
+  uint32_t pending = regs->ISR & regs->IMR;
+  regs->ISR        = pending;
+  return pending;
+}
+
+/**
+ * @brief   Run the handler of every pin in 'pending', highest first, stamped 'now'
+ * @return  Pins whose handler ran, debounced ones are counted in 'bounced'
+ **/
+static inline uint32_t
+gpio_irq_dispatch(gpio_irq_s* irq, uint32_t pending, uint64_t now)
+{
+  uint32_t todo = pending & irq->attached;
+  uint32_t run  = 0;
+  while (todo != 0)
+  {
+    uint32_t          pin   = bits_fls32(todo);
+    uint32_t          bit   = 0x1UL << pin;
+    gpio_irq_entry_s* entry = &irq->entries[pin];
+    todo                   &= ~bit;
+
+    if ((irq->primed & bit) && now - entry->last < entry->debounce)
+    {
+      irq->bounced++;
+      continue;
+    }
+    entry->last  = now;
+    irq->primed |= bit;
+    run         |= bit;
+    entry->handler(entry->ctx, pin, now);
+  }
+  return run;
+}
+
+/** @brief Collect, clear and dispatch, the body of the port's entry. Returns the pins run */
+uint32_t gpio_irq_service(gpio_irq_s* irq, uint64_t now);
+
+#endif // GPIO_IRQ_H
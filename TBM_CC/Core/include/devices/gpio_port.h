@@ -0,0 +1,203 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef GPIO_PORT_H
+#define GPIO_PORT_H
+
+#include <stdint.h>
+
+#include "sys/irq_handler.h"
+#include "sys/memory_map.h"
+
+/**
+ * @brief   Whole-port GPIO access through DR_SET, DR_CLEAR and DR_TOGGLE
+ * @details Every call takes a full 32-bit mask, so any number of pins of one
+ *          port change in a single store. The write-only set/clear/toggle
+ *          registers need no read-modify-write of DR, an ISR touching other
+ *          pins of the same port can not be overwritten:
+ *
+ *          static const gpio_pin_s led = GPIO_PIN(7, 3);          // Pin 13
+ *          gpio_pin_toggle(&led);
+ *          gpio_port_write_masked(GPIO_PORT(6), 0xff << 16, byte << 16); // 8-bit bus on GPIO6_IO16-23
+ *
+ *          Pin descriptors are plain constant initializers, the port address and
+ *          mask are resolved at compile time and a pin access is one store.
+ *
+ *          The register block is a parameter, so 'make hosttest' runs the same
+ *          code on a fake one.
+ *
+ * @note    gpio_port_write_masked() is two stores, pins going high change one
+ *          bus cycle before pins going low. A bus needing every line to switch
+ *          together (strobed by another pin) is fine, anything else has to write
+ *          DR under a critical section instead.
+ **/
+#define GPIO_PORTS 9
+
+/** @brief GPIOn base address, 12.5.1 p.961. Ports 6-9 are the AHB clocked fast modules */
+#define GPIO_PORT_ADDR(n)                                                   \
+  (((n) <= 4) ? (0x401b8000 + ((n) - 1) * 0x4000)                           \
+              : (((n) == 5) ? 0x400c0000 : (0x42000000 + ((n) - 6) * 0x4000)))
+
+/**
+ * @brief   Which module drives a pad of GPIO1-4, IOMUXC_GPR_GPR26-29 hold one bit per pin
+ * @details GPIO1-5 run off IPG_CLK_ROOT, GPIO6-9 off AHB_CLK_ROOT (4x IPG by
+ *          default) and sit on the core's AHB path instead of behind the
+ *          peripheral bridge, a store lands several times sooner. GPIOn and
+ *          GPIOn+5 share the same pads, GPIO5 has no fast twin.
+ *
+ *          GPIO_ROUTE_AUTO puts outputs on the fast module and leaves inputs on
+ *          the regular one, GPIO1-5 keep an interrupt line per port (GPIO6-9
+ *          share a single one).
+ **/
+typedef enum
+{
+  GPIO_ROUTE_AUTO,
+  GPIO_ROUTE_NORMAL, // GPIO1-5, IPG clocked
+  GPIO_ROUTE_FAST,   // GPIO6-9, AHB clocked
+} gpio_route_e;
+
+#define GPIO_FAST_OFFSET 5 // GPIOn pairs with GPIOn+5, n from 1 to 4
+
+/** @brief Pad bank (1-5) of a module, GPIO6-9 map back to GPIO1-4 */
+static inline uint8_t
+gpio_route_bank(uint8_t port)
+{
+  return (port > GPIO_FAST_OFFSET) ? (uint8_t)(port - GPIO_FAST_OFFSET) : port;
+}
+
+/** @brief Module (1-9) which should drive a pin of 'port' given its direction and route */
+static inline uint8_t
+gpio_route_module(uint8_t port, uint8_t output, gpio_route_e route)
+{
+  uint8_t bank = gpio_route_bank(port);
+  if (bank == 0 || bank >= GPIO_FAST_OFFSET) { return bank; } // GPIO5, or invalid
+  uint8_t fast = (route == GPIO_ROUTE_FAST) || (route == GPIO_ROUTE_AUTO && output);
+  return fast ? (uint8_t)(bank + GPIO_FAST_OFFSET) : bank;
+}
+
+/** @brief GPIO module register block, offsets as in gpio_registers_e. uint32_t so the layout also holds on a 64-bit host */
+typedef struct
+{
+  volatile uint32_t DR;
+  volatile uint32_t GDIR;
+  volatile uint32_t PSR;       // RO
+  volatile uint32_t ICR1;
+  volatile uint32_t ICR2;
+  volatile uint32_t IMR;
+  volatile uint32_t ISR;       // W1C
+  volatile uint32_t EDGE_SEL;
+  uint32_t          reserved[25];
+  volatile uint32_t DR_SET;    // WO
+  volatile uint32_t DR_CLEAR;  // WO
+  volatile uint32_t DR_TOGGLE; // WO
+} gpio_port_regs_s;
+
+#define GPIO_PORT(n) ((volatile gpio_port_regs_s*)GPIO_PORT_ADDR(n))
+
+/** @brief Pin descriptor, build it with GPIO_PIN() so it is a compile-time constant */
+typedef struct
+{
+  volatile gpio_port_regs_s* port;
+  uint32_t                   mask;
+} gpio_pin_s;
+
+/** @brief Descriptor of GPIOn_IOb, e.g. GPIO_PIN(7, 3) is pin 13 (LED) */
+#define GPIO_PIN(n, bit)         {GPIO_PORT(n), 0x1UL << (bit)}
+
+/** @brief Descriptor on an arbitrary register block, for tests on a fake port */
+#define GPIO_PIN_AT(regs, bit)   {(regs), 0x1UL << (bit)}
+
+/** @brief 'width' bits starting at 'shift', the mask of a parallel bus */
+#define GPIO_FIELD_MASK(shift, width) ((((width) >= 32) ? 0xffffffffUL : ((0x1UL << (width)) - 1)) << (shift))
+
+/** @brief Drive every pin in 'mask' high */
+static inline void
+gpio_port_set(volatile gpio_port_regs_s* port, uint32_t mask)
+{
+  port->DR_SET = mask;
+}
+
+/** @brief Drive every pin in 'mask' low */
+static inline void
+gpio_port_clear(volatile gpio_port_regs_s* port, uint32_t mask)
+{
+  port->DR_CLEAR = mask;
+}
+
+/** @brief Invert every pin in 'mask' */
+static inline void
+gpio_port_toggle(volatile gpio_port_regs_s* port, uint32_t mask)
+{
+  port->DR_TOGGLE = mask;
+}
+
+/** @brief Pins in 'mask' take their bit of 'value', the other pins are untouched */
+static inline void
+gpio_port_write_masked(volatile gpio_port_regs_s* port, uint32_t mask, uint32_t value)
+{
+  port->DR_SET   = value & mask;
+  port->DR_CLEAR = ~value & mask;
+}
+
+/** @brief Put the low 'width' bits of 'value' on the pins from 'shift' upwards */
+static inline void
+gpio_port_write_field(volatile gpio_port_regs_s* port, uint32_t shift, uint32_t width, uint32_t value)
+{
+  gpio_port_write_masked(port, GPIO_FIELD_MASK(shift, width), value << shift);
+}
+
+/** @brief Pad levels of the whole port (PSR) */
+static inline uint32_t
+gpio_port_read(volatile gpio_port_regs_s* port)
+{
+  return port->PSR;
+}
+
+/**
+ * @brief   Make the pins in 'mask' outputs ('output' != 0) or inputs
+ * @details GDIR has no set/clear alias, the read-modify-write is done with
+ *          interrupts masked. Setup path only.
+ **/
+static inline void
+gpio_port_direction(volatile gpio_port_regs_s* port, uint32_t mask, uint8_t output)
+{
+  uint32_t primask = __irq_save__();
+  port->GDIR       = output ? (port->GDIR | mask) : (port->GDIR & ~mask);
+  __irq_restore__(primask);
+}
+
+static inline void
+gpio_pin_set(const gpio_pin_s* pin)
+{
+  pin->port->DR_SET = pin->mask;
+}
+
+static inline void
+gpio_pin_clear(const gpio_pin_s* pin)
+{
+  pin->port->DR_CLEAR = pin->mask;
+}
+
+static inline void
+gpio_pin_toggle(const gpio_pin_s* pin)
+{
+  pin->port->DR_TOGGLE = pin->mask;
+}
+
+/** @brief Drive 'pin' high for a non-zero 'level', low otherwise, one store either way */
+static inline void
+gpio_pin_write(const gpio_pin_s* pin, uint8_t level)
+{
+  if (level) { pin->port->DR_SET = pin->mask; }
+  else       { pin->port->DR_CLEAR = pin->mask; }
+}
+
+static inline uint8_t
+gpio_pin_read(const gpio_pin_s* pin)
+{
+  return (pin->port->PSR & pin->mask) != 0;
+}
+
+#endif // GPIO_PORT_H
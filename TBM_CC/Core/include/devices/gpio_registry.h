@@ -0,0 +1,63 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef GPIO_REGISTRY_H
+#define GPIO_REGISTRY_H
+
+#include <stdint.h>
+
+#include "gpio_port.h"
+
+/**
+ * @brief   GPIO lines by small integer ID, what trigger_gpio() drives
+ * @details Interfaces only carry an ID (see trigger_gpio_fp_t). Adding a pin
+ *          resolves its DR_CLEAR and DR_SET addresses and its mask once, driving
+ *          the line is then an indexed load and a single store, no branch:
+ *
+ *          static const gpio_pin_s sda_pin = GPIO_PIN(7, 17);
+ *          uint8_t sda = gpio_line_add(&sda_pin);
+ *          gpio_line_write(sda, bit);                // or tgpio_fp(sda, bit)
+ *          gpio_line_remove(sda);
+ *
+ *          A free entry points both registers at a dummy word, so a removed or
+ *          never handed out ID writes nothing. IDs past the table, GPIO_LINE_NONE
+ *          from a failed add included, select the extra entry GPIO_LINE_SINK
+ *          which is never handed out (a conditional select, no branch).
+ *
+ * @note    The table starts out with every entry free (initialised data, not
+ *          .bss), so an ID written before any gpio_line_add() is dropped too.
+ *          gpio_handler.h wraps this as gpio_add_device() and
+ *          gpio_remove_device() for gpiodev_s devices.
+ **/
+#define GPIO_LINES       16 // At most 32, gpio_line_used() is a bit per ID
+#define GPIO_LINE_SINK   GPIO_LINES // Always free, every out of range ID lands here
+#define GPIO_LINE_NONE   0xff
+
+typedef struct
+{
+  volatile uint32_t* reg[2]; // [0] DR_CLEAR, [1] DR_SET
+  uint32_t           mask;
+} gpio_line_s;
+
+extern gpio_line_s g_gpio_lines[GPIO_LINES + 1];
+
+/** @brief Register 'pin', returns its ID or GPIO_LINE_NONE once all GPIO_LINES are taken */
+uint8_t gpio_line_add(const gpio_pin_s* pin);
+
+/** @brief Free 'id', writes to it are dropped until it is handed out again */
+void gpio_line_remove(uint8_t id);
+
+/** @brief IDs currently handed out, bit per ID */
+uint32_t gpio_line_used();
+
+/** @brief Drive line 'id' high for a non-zero 'level', low otherwise */
+static inline void
+gpio_line_write(uint8_t id, uint8_t level)
+{
+  gpio_line_s* line = &g_gpio_lines[(id < GPIO_LINES) ? id : GPIO_LINE_SINK];
+  *line->reg[level != 0] = line->mask;
+}
+
+#endif // GPIO_REGISTRY_H
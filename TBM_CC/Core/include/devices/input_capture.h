@@ -0,0 +1,111 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef INPUT_CAPTURE_H
+#define INPUT_CAPTURE_H
+
+#include <stdint.h>
+
+/**
+ * @brief   Input capture timestamps, a lock-free ring plus edge interval statistics
+ * @details The producer (capture ISR) only writes 'head', the consumer (thread
+ *          context) only writes 'tail', so neither side masks interrupts. Stamps
+ *          are raw 32-bit counter values, intervals are taken modulo 2^32 so
+ *          counter wraps between two edges do not matter.
+ *
+ *          static capture_ring_s pps_ring;
+ *          static capture_stats_s pps_stats;
+ *          init_capture_GPT2(&pps_ring, CAPTURE_IRQ);   // timer_manager.h
+ *          ...
+ *          uint32_t stamp;
+ *          while (capture_ring_pop(&pps_ring, &stamp)) { capture_stats_add(&pps_stats, stamp); }
+ *          uint32_t hz_milli = capture_stats_freq_mhz(&pps_stats, TIMER_GPT_HZ);
+ *
+ * @note    The GPT has no DMA request line on the i.MX RT1062, see
+ *          init_capture_GPT2() for how high edge rates are handled instead.
+ **/
+#define CAPTURE_RING_SIZE 256 // Power of two
+#define CAPTURE_RING_MASK (CAPTURE_RING_SIZE - 1)
+
+typedef struct
+{
+  uint32_t          stamps[CAPTURE_RING_SIZE];
+  volatile uint32_t head;     // Written by the producer only
+  volatile uint32_t tail;     // Written by the consumer only
+  volatile uint32_t overruns; // Stamps dropped on a full ring
+} capture_ring_s;
+
+/**
+ * @brief   Running interval statistics
+ * @details Deviations are kept relative to the first interval so the sums stay
+ *          small for periodic signals, mean and jitter need no 64-bit division
+ *          in the producer path. 'span' is the sum of all intervals.
+ **/
+typedef struct
+{
+  uint32_t count;      // Intervals, one less than the stamps added
+  uint32_t last_stamp;
+  uint32_t reference;  // First interval
+  uint32_t min;
+  uint32_t max;
+  int64_t  sum_dev;    // Sum of (interval - reference)
+  uint64_t sum_dev_sq; // Sum of (interval - reference)^2
+  uint64_t span;       // Sum of intervals, counter ticks
+  uint8_t  primed;     // A first stamp has been seen
+} capture_stats_s;
+
+typedef enum
+{
+  CAPTURE_IRQ,    // One interrupt per capture
+  CAPTURE_POLLED, // No interrupt, capture_poll_GPT2(ring) from a loop
+} capture_mode_e;
+
+void capture_ring_init(capture_ring_s* ring);
+
+/** @brief Producer side, O(1) with no critical section. Returns 0 and counts an overrun on a full ring */
+static inline uint8_t
+capture_ring_push(capture_ring_s* ring, uint32_t stamp)
+{
+  uint32_t head = ring->head;
+  if (head - ring->tail >= CAPTURE_RING_SIZE)
+  {
+    ring->overruns++;
+    return 0;
+  }
+
+  ring->stamps[head & CAPTURE_RING_MASK] = stamp;
+  __asm__ volatile("" : : : "memory"); // Stamp stored before it is published
+  ring->head = head + 1;
+  return 1;
+}
+
+/** @brief Producer side, push 'count' stamps with a single publish of 'head', returns the number pushed */
+uint32_t capture_ring_push_block(capture_ring_s* ring, const uint32_t* stamps, uint32_t count);
+
+/** @brief Consumer side, 0 if the ring is empty */
+uint8_t capture_ring_pop(capture_ring_s* ring, uint32_t* stamp);
+
+/** @brief Stamps waiting for the consumer */
+uint32_t capture_ring_count(const capture_ring_s* ring);
+
+void capture_stats_init(capture_stats_s* stats);
+
+/** @brief Add the next stamp, every stamp after the first adds one interval */
+void capture_stats_add(capture_stats_s* stats, uint32_t stamp);
+
+/** @brief Mean interval in counter ticks, rounded down, 0 before the first interval */
+uint32_t capture_stats_mean(const capture_stats_s* stats);
+
+/** @brief RMS deviation of the intervals from their mean (jitter) in counter ticks */
+uint32_t capture_stats_jitter(const capture_stats_s* stats);
+
+/**
+ * @brief   Edge frequency in milli-Hertz for a counter running at 'counter_hz'
+ * @details count * counter_hz / span over the whole window. For a 1PPS input
+ *          capture_stats_mean() is the counter's true rate in Hz instead.
+ **/
+uint32_t capture_stats_freq_mhz(const capture_stats_s* stats, uint32_t counter_hz);
+
+#endif // INPUT_CAPTURE_H
@@ -7,6 +7,7 @@
 #define IOMUX_MANAGER_H
 
 #include "gpio_handler.h"
+#include "pinmux.h"
 // #include "lcdif_handler.h"
 // #include "qtimer_handler.h"
 // #include "flexpwm_handler.h"
@@ -27,4 +28,53 @@ typedef union
   // SStoredDEVICE _device;
 } iomux_manager_u;
 
+/**
+ * @brief   Board pad description, applied once by iomux_board_init() before any driver starts
+ * @details Entries usable on their own as well, a driver calls iomux_route()
+ *          with the same entry so it still works on a board table without it.
+ **/
+#define IOMUX_LED_PIN13 PINMUX_ENTRY(PINMUX_PAD_B0(3), MM_ALT5, PAD_DSE_R07) // GPIO2/7_IO03
+
+#define IOMUX_GPT2_CAPIN1_PIN15                                                      \
+  PINMUX_ENTRY_DAISY(PINMUX_PAD_AD_B1(3),                                            \
+                     MM_ALT8,                                                        \
+                     PAD_HYST_ENABLED | PAD_100KOHM_DOWN | PAD_SLCT_PULLER | PAD_PULLKEEP_ENABLED, \
+                     &IOMUXC_GPT2_IPP_IND_CAPIN1__SLCT_IN_DR,                        \
+                     0x1) // GPS 1PPS
+
+#define IOMUX_LPI2C1_PAD_CONFIG                                                      \
+  (PAD_HYST_ENABLED | PAD_22KOHM_UP | PAD_SLCT_PULLER | PAD_PULLKEEP_ENABLED |       \
+   PAD_OPENDRAIN_ENABLED | PAD_SPEED_100MHZ | PAD_DSE_R04)
+
+#define IOMUX_LPI2C1_SCL_PIN19                                                       \
+  PINMUX_ENTRY_DAISY(PINMUX_PAD_AD_B1(0),                                            \
+                     MM_ALT3 | PINMUX_SION,                                          \
+                     IOMUX_LPI2C1_PAD_CONFIG,                                        \
+                     &IOMUXC_LPI2C1_SCL__SLCT_IN_DR,                                 \
+                     0x1) // SSD1306 display
+
+#define IOMUX_LPI2C1_SDA_PIN18                                                       \
+  PINMUX_ENTRY_DAISY(PINMUX_PAD_AD_B1(1),                                            \
+                     MM_ALT3 | PINMUX_SION,                                          \
+                     IOMUX_LPI2C1_PAD_CONFIG,                                        \
+                     &IOMUXC_LPI2C1_SDA__SLCT_IN_DR,                                 \
+                     0x1)
+
+/** @brief Pad ownership of the whole chip */
+extern pinmux_s g_iomux;
+
+/**
+ * @brief   Apply the board table in one pass and claim its pads
+ * @return  Entries skipped as conflicts, 0 for a consistent table
+ **/
+uint32_t iomux_board_init();
+
+/**
+ * @brief   Route one pad for a driver unless it is claimed already
+ * @details A pad the board table (or an earlier call) owns is left alone, so
+ *          this costs a bit test on every call after the first.
+ * @return  1 if the entry was written now
+ **/
+uint8_t iomux_route(const pinmux_entry_s* entry);
+
 #endif // IOMUX_MANAGER_H
\ No newline at end of file
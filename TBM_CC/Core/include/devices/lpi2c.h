@@ -0,0 +1,222 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef LPI2C_H
+#define LPI2C_H
+
+#include <stdint.h>
+
+#include "edma.h"
+#include "sys/irq_dispatch.h"
+
+/**
+ * @brief   LPI2C master, non-blocking writes with a completion callback
+ * @details A write is START + address, an optional head (control byte,
+ *          register address) and a data block, then STOP. The controller runs
+ *          it from its command FIFO: the interrupt refills every free FIFO
+ *          word at once, or with an eDMA channel attached the data block is
+ *          moved by DMA and the CPU only queues START, head and STOP:
+ *
+ *          static lpi2c_s bus;
+ *          static edma_channel_s dma;
+ *          lpi2c_enable(&bus, 1, LPI2C_FAST_PLUS_HZ, 0x40);
+ *          edma_enable(&dma, 0x1, EDMA_SOURCE_LPI2C1, 0x40);
+ *          lpi2c_attach_dma(&bus, &dma);
+ *          static const uint8_t ctrl = 0x40;
+ *          lpi2c_write_async(&bus, 0x3c, &ctrl, 1, frame, 1024, &on_done, NULL); // Returns at once
+ *
+ *          'done' runs in interrupt context once STOP is on the bus, or on the
+ *          first error. lpi2c_wait() polls the same state machine, so the
+ *          blocking path also works before the NVIC line is enabled.
+ *
+ *          The register block is a parameter, 'make hosttest' drives the state
+ *          machine on a fake one.
+ *
+ * @note    Head and data are not copied, both stay untouched until 'done'.
+ *          The head has to fit the FIFO behind START (LPI2C_HEAD_MAX bytes)
+ *          when the data block goes through DMA.
+ **/
+#define LPI2C_PORTS          4
+#define LPI2C_CLOCK_HZ       24000000UL // lpi2c_enable(), oscillator clock, no divider
+#define LPI2C_STANDARD_HZ    100000UL
+#define LPI2C_FAST_HZ        400000UL
+#define LPI2C_FAST_PLUS_HZ   1000000UL
+#define LPI2C_DMA_MIN        8 // Shorter data blocks go through the interrupt, setting up DMA costs more
+#define LPI2C_HEAD_MAX       3 // 4-word FIFO less the START word
+
+/** @brief LPI2Cn base address, 47.4 p.2794 */
+#define LPI2C_ADDR(n) (0x403f0000 + ((n) - 1) * 0x4000)
+
+/** @brief Master register block up to MRDR, uint32_t so the layout also holds on a 64-bit host */
+typedef struct
+{
+  volatile uint32_t VERID;      // 0x00
+  volatile uint32_t PARAM;
+  uint32_t          reserved0[2];
+  volatile uint32_t MCR;        // 0x10
+  volatile uint32_t MSR;        // W1C flags
+  volatile uint32_t MIER;
+  volatile uint32_t MDER;
+  volatile uint32_t MCFGR0;     // 0x20
+  volatile uint32_t MCFGR1;
+  volatile uint32_t MCFGR2;
+  volatile uint32_t MCFGR3;
+  uint32_t          reserved1[4];
+  volatile uint32_t MDMR;       // 0x40
+  uint32_t          reserved2;
+  volatile uint32_t MCCR0;      // 0x48
+  uint32_t          reserved3;
+  volatile uint32_t MCCR1;      // 0x50
+  uint32_t          reserved4;
+  volatile uint32_t MFCR;       // 0x58
+  volatile uint32_t MFSR;
+  volatile uint32_t MTDR;       // 0x60, WO
+  uint32_t          reserved5[3];
+  volatile uint32_t MRDR;       // 0x70, RO
+} lpi2c_regs_s;
+
+#define LPI2C_PORT(n) ((volatile lpi2c_regs_s*)LPI2C_ADDR(n))
+
+#define LPI2C_MCR_MEN   (0x1UL << 0x0)
+#define LPI2C_MCR_RST   (0x1UL << 0x1)
+#define LPI2C_MCR_DBGEN (0x1UL << 0x3)
+#define LPI2C_MCR_RTF   (0x1UL << 0x8) // Reset the transmit FIFO
+#define LPI2C_MCR_RRF   (0x1UL << 0x9)
+
+#define LPI2C_MSR_TDF   (0x1UL << 0x0)
+#define LPI2C_MSR_SDF   (0x1UL << 0x9)  // STOP detected
+#define LPI2C_MSR_NDF   (0x1UL << 0xa)  // NACK
+#define LPI2C_MSR_ALF   (0x1UL << 0xb)  // Arbitration lost
+#define LPI2C_MSR_FEF   (0x1UL << 0xc)  // Command sequence error
+#define LPI2C_MSR_PLTF  (0x1UL << 0xd)  // Pin low timeout
+#define LPI2C_MSR_MBF   (0x1UL << 0x18) // Master busy
+#define LPI2C_MSR_W1C   (0x7fUL << 0x8)
+#define LPI2C_MSR_ERRORS (LPI2C_MSR_NDF | LPI2C_MSR_ALF | LPI2C_MSR_FEF | LPI2C_MSR_PLTF)
+
+#define LPI2C_MIER_TDIE (0x1UL << 0x0) // Same bit layout as MSR
+#define LPI2C_MDER_TDDE (0x1UL << 0x0)
+
+#define LPI2C_MCFGR1_PRESCALE(x) ((uint32_t)(x) & 0x7)
+#define LPI2C_MCFGR2_BUSIDLE(x)  ((uint32_t)(x) & 0xfff)
+#define LPI2C_MCFGR2_FILTSCL(x)  (((uint32_t)(x) & 0xf) << 0x10)
+#define LPI2C_MCFGR2_FILTSDA(x)  (((uint32_t)(x) & 0xf) << 0x18)
+#define LPI2C_MCCR0_CLKLO(x)     ((uint32_t)(x) & 0x3f)
+#define LPI2C_MCCR0_CLKHI(x)     (((uint32_t)(x) & 0x3f) << 0x8)
+#define LPI2C_MCCR0_SETHOLD(x)   (((uint32_t)(x) & 0x3f) << 0x10)
+#define LPI2C_MCCR0_DATAVD(x)    (((uint32_t)(x) & 0x3f) << 0x18)
+#define LPI2C_MFCR_TXWATER(x)    ((uint32_t)(x) & 0x3)
+#define LPI2C_MFSR_TXCOUNT(x)    ((x) & 0x7)
+
+/** @brief MTDR command field, data in bits 7:0 */
+#define LPI2C_CMD_TX    (0x0UL << 0x8)
+#define LPI2C_CMD_STOP  (0x2UL << 0x8)
+#define LPI2C_CMD_START (0x4UL << 0x8) // START, then transmit the address byte
+
+typedef enum
+{
+  LPI2C_OK,
+  LPI2C_NACK,        // Address or data byte not acknowledged
+  LPI2C_ARBITRATION, // Another master won the bus
+  LPI2C_FIFO_ERROR,
+  LPI2C_PIN_LOW,     // SCL or SDA held low past the timeout
+  LPI2C_DMA_ERROR,
+} lpi2c_status_e;
+
+typedef void (*lpi2c_done_fp)(void* ctx, lpi2c_status_e status);
+
+typedef enum
+{
+  LPI2C_IDLE,
+  LPI2C_FIFO, // Interrupt refills START, head, data and STOP
+  LPI2C_DMA,  // Data block owned by the DMA channel
+  LPI2C_STOP, // STOP queued, waiting for it on the bus
+} lpi2c_phase_e;
+
+/** @brief SCL timing for MCCR0/MCFGR1/MCFGR2, see lpi2c_timing() */
+typedef struct
+{
+  uint8_t  clklo;
+  uint8_t  clkhi;
+  uint8_t  sethold;
+  uint8_t  datavd;
+  uint8_t  prescale;
+  uint8_t  filt;
+  uint16_t busidle;
+  uint32_t hz; // SCL rate actually generated
+} lpi2c_timing_s;
+
+typedef struct
+{
+  volatile lpi2c_regs_s* regs;
+  edma_channel_s*        dma;      // NULL, data goes through the interrupt
+  const uint8_t*         head;
+  const uint8_t*         data;
+  uint16_t               head_len; // Bytes left to queue
+  uint16_t               data_len;
+  lpi2c_done_fp          done;
+  void*                  ctx;
+  uint32_t               hz;
+  uint32_t               transfers;
+  uint32_t               errors;
+  irq_slot_s             slot;
+  uint8_t                fifo;     // Transmit FIFO words
+  uint8_t                addr;
+  volatile uint8_t       start;    // START + address still to queue
+  volatile uint8_t       phase;    // lpi2c_phase_e
+  volatile uint8_t       status;   // lpi2c_status_e of the last transfer
+} lpi2c_s;
+
+/**
+ * @brief   SCL timing for 'scl_hz' from a 'src_hz' functional clock
+ * @details Smallest prescaler whose period fits CLKLO/CLKHI, low phase 60% of
+ *          the period (Fast-mode needs tLOW >= 1.3us of 2.5us). The rate never
+ *          exceeds 'scl_hz'.
+ * @return  0 if even the largest prescaler is too fast
+ **/
+uint8_t lpi2c_timing(uint32_t src_hz, uint32_t scl_hz, lpi2c_timing_s* timing);
+
+/** @brief Reset the master in 'regs' and enable it at 'scl_hz' */
+void lpi2c_init(lpi2c_s* bus, volatile lpi2c_regs_s* regs, uint32_t src_hz, uint32_t scl_hz);
+
+/** @brief Gate LPI2C'n' (1-4) on, clock it with LPI2C_CLOCK_HZ, lpi2c_init() it and hook its interrupt */
+void lpi2c_enable(lpi2c_s* bus, uint8_t n, uint32_t scl_hz, uint8_t nvic_priority);
+
+/** @brief Move data blocks of LPI2C_DMA_MIN bytes and up through 'dma', a channel routed to the port's EDMA_SOURCE_LPI2Cn */
+void lpi2c_attach_dma(lpi2c_s* bus, edma_channel_s* dma);
+
+/**
+ * @brief   Start writing 'head' then 'data' to 7-bit address 'addr'
+ * @return  0 if a transfer is running or the arguments are invalid, 'done' is then not called
+ **/
+uint8_t lpi2c_write_async(lpi2c_s*       bus,
+                          uint8_t        addr,
+                          const uint8_t* head,
+                          uint16_t       head_len,
+                          const uint8_t* data,
+                          uint16_t       len,
+                          lpi2c_done_fp  done,
+                          void*          ctx);
+
+/** @brief lpi2c_write_async() and lpi2c_wait(), LPI2C_FIFO_ERROR when the bus was busy */
+lpi2c_status_e lpi2c_write(lpi2c_s*       bus,
+                           uint8_t        addr,
+                           const uint8_t* head,
+                           uint16_t       head_len,
+                           const uint8_t* data,
+                           uint16_t       len);
+
+/** @brief Spin until the running transfer is done, advancing it from here with interrupts masked per step */
+lpi2c_status_e lpi2c_wait(lpi2c_s* bus);
+
+/** @brief Interrupt side, refills the FIFO, detects STOP and errors, runs 'done' */
+void lpi2c_service(lpi2c_s* bus);
+
+static inline uint8_t
+lpi2c_busy(const lpi2c_s* bus)
+{
+  return bus->phase != LPI2C_IDLE;
+}
+
+#endif // LPI2C_H
@@ -0,0 +1,81 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MONOTONIC_CLOCK_H
+#define MONOTONIC_CLOCK_H
+
+#include <stdint.h>
+
+#include "typedefs/ttimer_mgr.h"
+
+/**
+ * @brief   Free running 64-bit monotonic clock on PIT channels 2 and 3
+ * @details Channel 3 is chained to channel 2 and both count down from
+ *          0xffffffff, together a 64-bit down-counter which will not wrap for
+ *          ~2900 years at 200MHz. The lifetime registers (LTMR64H/L) are not
+ *          used as they only latch channels 0 and 1, and channel 0 is the tick.
+ *
+ *          A read is high, low, high: if the high word moved the low word wrapped
+ *          in between and is read again. No lock, no interrupt masking, so it can
+ *          be called from any ISR.
+ *
+ *          init_monotonic_clock(PIT_SPEED_200MHz);
+ *          uint64_t t0 = clock_now_ticks();
+ *          ...
+ *          time_ns64_t elapsed_ns = clock_ticks_to_ns(clock_now_ticks() - t0);
+ *
+ * @note    pit_configure() and init_tickless_PIT0() only touch channels 0 and 1.
+ **/
+
+/**
+ * @brief   Nano-seconds per PIT tick as Q32.32 (integer, fraction)
+ * @details 50/100/200MHz are exact, 150MHz (6.666.. ns) is off by less than
+ *          1ns per 2^32 ticks (~28s).
+ **/
+typedef struct
+{
+  uint32_t ns_int;
+  uint32_t ns_frac;
+} clock_ns_per_tick_s;
+
+/**
+ * @brief   ticks -> ns at 'freq', only multiplies (no __aeabi_uldivmod on the teensy)
+ * @details ticks * (ns_int + ns_frac / 2^32), the fraction product is split on the
+ *          high and low tick word so nothing overflows 64 bits.
+ **/
+static inline time_ns64_t
+clock_ticks_to_ns_at(uint64_t ticks, pit_speed_e freq)
+{
+  static const clock_ns_per_tick_s ns_per_tick[4] = {
+    {20, 0x0},        // PIT_SPEED_50MHz
+    {10, 0x0},        // PIT_SPEED_100MHz
+    { 6, 0xaaaaaaab}, // PIT_SPEED_150MHz
+    { 5, 0x0},        // PIT_SPEED_200MHz
+  };
+  const clock_ns_per_tick_s* scale = &ns_per_tick[freq & 0x3];
+
+  uint64_t ticks_hi = ticks >> 0x20;
+  uint64_t ticks_lo = ticks & 0xffffffff;
+  return ticks * scale->ns_int
+       + ticks_hi * scale->ns_frac
+       + ((ticks_lo * scale->ns_frac) >> 0x20);
+}
+
+/** @brief Start channels 2 and 3 as a chained free running counter, the clock reads 0 from here */
+void init_monotonic_clock(pit_speed_e freq);
+
+/** @brief PIT ticks since init_monotonic_clock() */
+uint64_t clock_now_ticks();
+
+/** @brief Nano-seconds since init_monotonic_clock() */
+time_ns64_t clock_now_ns();
+
+/** @brief Convert a tick count (or difference) of this clock into nano-seconds */
+time_ns64_t clock_ticks_to_ns(uint64_t ticks);
+
+/** @brief PIT speed the clock was started with */
+pit_speed_e clock_speed();
+
+#endif // MONOTONIC_CLOCK_H
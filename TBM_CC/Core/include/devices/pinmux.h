@@ -0,0 +1,89 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef PINMUX_H
+#define PINMUX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "containers/bitset.h"
+#include "sys/registers.h"
+
+/**
+ * @brief   Pad mux tables, {pad, alt mode, pad config, daisy select} applied in one pass
+ * @details A board describes its pads once as a const table, pinmux_apply()
+ *          writes it at boot and claims every pad in an ownership bitmap. A pad
+ *          claimed twice (two entries, or a driver routing a pad the board
+ *          already gave to something else) is a conflict: the later entry is
+ *          skipped and counted instead of silently re-muxing a live pin.
+ *
+ *          static const pinmux_entry_s board[] = {
+ *            PINMUX_ENTRY(PINMUX_PAD_B0(3), MM_ALT5, PAD_DSE_R07),          // Pin 13, LED
+ *            PINMUX_ENTRY_DAISY(PINMUX_PAD_AD_B1(3), MM_ALT8, PAD_HYST_ENABLED,
+ *                               &IOMUXC_GPT2_IPP_IND_CAPIN1__SLCT_IN_DR, 0x1), // Pin 15, GPT2 capture 1
+ *          };
+ *          pinmux_apply(&g_iomux, board, PINMUX_COUNT(board));
+ *
+ *          Pads are numbered in register order (EMC, AD_B0, AD_B1, B0, B1,
+ *          SD_B0, SD_B1), both register banks are a base plus 4 bytes per pad.
+ *          The bases are parameters so 'make hosttest' runs this on fake banks.
+ *
+ * @note    Per entry the daisy select is written first, then the pad config,
+ *          the mux last, so the peripheral never sees an unconfigured pad.
+ **/
+#define PINMUX_PADS 124
+
+#define PINMUX_PAD_EMC(n)   (n)
+#define PINMUX_PAD_AD_B0(n) (42 + (n))
+#define PINMUX_PAD_AD_B1(n) (58 + (n))
+#define PINMUX_PAD_B0(n)    (74 + (n))
+#define PINMUX_PAD_B1(n)    (90 + (n))
+#define PINMUX_PAD_SD_B0(n) (106 + (n))
+#define PINMUX_PAD_SD_B1(n) (112 + (n))
+
+/** @brief SW_MUX_CTL_PAD_GPIO_EMC_00 and SW_PAD_CTL_PAD_GPIO_EMC_00, 11.7 p.403 */
+#define PINMUX_MUX_BASE ((vuint32_t*)0x401f8014)
+#define PINMUX_PAD_BASE ((vuint32_t*)0x401f8204)
+
+#define PINMUX_SION 0x10 // Software input on, OR into 'alt' to read the pad back through PSR
+
+typedef struct
+{
+  uint16_t   pad;         // PINMUX_PAD_*()
+  uint8_t    alt;         // muxmode_e, optionally | PINMUX_SION
+  uint32_t   config;      // SW_PAD_CTL value, PAD_* macros of memory_map.h
+  vuint32_t* daisy;       // *_SELECT_INPUT register, NULL if the signal has none
+  uint32_t   daisy_value;
+} pinmux_entry_s;
+
+#define PINMUX_ENTRY(pad, alt, config)                     {(pad), (alt), (config), NULL, 0}
+#define PINMUX_ENTRY_DAISY(pad, alt, config, daisy, value) {(pad), (alt), (config), (daisy), (value)}
+#define PINMUX_COUNT(table)                                (sizeof(table) / sizeof((table)[0]))
+
+typedef struct
+{
+  vuint32_t* mux_base;
+  vuint32_t* pad_base;
+  BITSET_DECLARE(owned, PINMUX_PADS);
+  uint32_t   conflicts; // Entries skipped since pinmux_init()
+} pinmux_s;
+
+/** @brief Nothing owned, register banks at 'mux_base' and 'pad_base' (PINMUX_MUX_BASE, PINMUX_PAD_BASE) */
+void pinmux_init(pinmux_s* mux, vuint32_t* mux_base, vuint32_t* pad_base);
+
+/**
+ * @brief   Claim and write every entry of 'table'
+ * @return  Entries skipped, pad out of range or already owned, 0 when all applied
+ **/
+uint32_t pinmux_apply(pinmux_s* mux, const pinmux_entry_s* table, uint32_t count);
+
+/** @brief Hand 'pad' back, its registers keep their values until someone claims it */
+void pinmux_release(pinmux_s* mux, uint32_t pad);
+
+/** @brief 'pad' has been claimed */
+uint8_t pinmux_owned(const pinmux_s* mux, uint32_t pad);
+
+#endif // PINMUX_H
@@ -0,0 +1,113 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef PIT_DEMUX_H
+#define PIT_DEMUX_H
+
+#include <stdint.h>
+
+#include "sys/memory_map.h"
+
+/**
+ * @brief   One IRQ_PIT entry for all four PIT channels, (handler, context) per channel
+ * @details The four channels share IRQ_PIT. Instead of one dispatch slot per
+ *          channel, each re-reading its own TFLG, a single slot services the
+ *          line: it gathers TIF of every channel with TIE set into a bitmask,
+ *          clears those flags and runs the handler of each set bit, lowest
+ *          channel first. Handlers do not touch TFLG, they only see their own
+ *          channel's expiries:
+ *
+ *          static void blink(void* led) { ... }
+ *          pit_channel_start(PIT_TIMER_01, ldval, &blink, &led); // timer_manager.h
+ *
+ *          The table and the scan are hardware independent, the register block
+ *          is a parameter so 'make hosttest' runs the same code on a fake one.
+ *
+ * @note    A periodic channel reloads LDVAL on its own, its handler runs once
+ *          per period with no register access. A flag is cleared before its
+ *          handler runs, so a handler may rearm its channel.
+ **/
+#define PIT_DEMUX_CHANNELS 4
+#define PIT_TCTRL_TIE      0x2
+
+/**
+ * @brief   PIT channel register block (LDVAL, CVAL, TCTRL, TFLG), 0x10 apart from 0x40084100
+ * @details Lets the hot path index a channel instead of switching on it.
+ **/
+typedef struct
+{
+  vuint32_t LDVAL;
+  vuint32_t CVAL;
+  vuint32_t TCTRL;
+  vuint32_t TFLG;
+} pit_channel_regs_s;
+
+typedef void (*pit_channel_fp)(void* ctx);
+
+typedef struct
+{
+  pit_channel_fp handler;
+  void*          ctx;
+} pit_demux_entry_s;
+
+typedef struct
+{
+  pit_demux_entry_s entries[PIT_DEMUX_CHANNELS];
+  volatile uint32_t attached; // Bit per channel with a handler
+  uint32_t          spurious; // Entries with no flagged channel (e.g. a rearm left the NVIC request pending)
+} pit_demux_s;
+
+void pit_demux_init(pit_demux_s* demux);
+
+/** @brief Set the handler of 'channel', replaces a previous one */
+void pit_demux_attach(pit_demux_s* demux, uint32_t channel, pit_channel_fp handler, void* ctx);
+
+/** @brief Remove the handler of 'channel', its flags are still cleared but nothing runs */
+void pit_demux_detach(pit_demux_s* demux, uint32_t channel);
+
+/**
+ * @brief   Run the handler of every channel in 'pending', lowest first
+ * @return  Channels whose handler ran
+ **/
+static inline uint32_t
+pit_demux_dispatch(pit_demux_s* demux, uint32_t pending)
+{
+  uint32_t run = pending & demux->attached;
+  uint32_t todo = run;
+  while (todo != 0)
+  {
+    uint32_t channel = (uint32_t)__builtin_ctz(todo);
+    todo            &= todo - 1;
+    demux->entries[channel].handler(demux->entries[channel].ctx);
+  }
+  return run;
+}
+
+/**
+ * @brief   Flagged channels of 'regs' (TIF and TIE set) as a bitmask, each flag is cleared
+ * @details Channels without TIE (e.g. the chained monotonic clock on 2+3) are
+ *          left untouched.
+ **/
+static inline uint32_t
+pit_demux_collect(volatile pit_channel_regs_s* regs)
+{
+  uint32_t pending = 0;
+  uint32_t channel;
+  for (channel = 0; channel < PIT_DEMUX_CHANNELS; channel++)
+  {
+    if ((regs[channel].TFLG & 0x1) && (regs[channel].TCTRL & PIT_TCTRL_TIE)) { pending |= 0x1 << channel; }
+  }
+
+  for (channel = 0; channel < PIT_DEMUX_CHANNELS; channel++)
+  {
+    if (pending & (0x1 << channel)) { regs[channel].TFLG = 0x1; } // Write 1 to clear
+  }
+  return pending;
+}
+
+/** @brief Collect, clear and dispatch in one go, the body of the IRQ_PIT entry. Returns the channels run */
+uint32_t pit_demux_service(pit_demux_s* demux, volatile pit_channel_regs_s* regs);
+
+#endif // PIT_DEMUX_H
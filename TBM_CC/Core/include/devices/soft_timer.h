@@ -0,0 +1,120 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef SOFT_TIMER_H
+#define SOFT_TIMER_H
+
+#include <stdint.h>
+
+#include "containers/bitset.h"
+#include "containers/intrusive_list.h"
+#include "typedefs/ttimer_mgr.h"
+
+/**
+ * @brief   Hierarchical timing wheel, any number of software timers on one hw tick
+ * @details One PIT channel drives soft_timer_tick() at a fixed period (the wheel
+ *          tick). Timers are hashed into one of SOFT_TIMER_LEVELS wheels of
+ *          SOFT_TIMER_SLOTS slots each, level n covering deltas below
+ *          2^(SOFT_TIMER_SLOT_BITS * (n + 1)) wheel ticks. Every time level n
+ *          wraps, the next slot of level n + 1 is cascaded down.
+ *
+ *          - start/stop are O(1): hash + intrusive list link/unlink
+ *          - expire is O(1) per expired timer, plus an amortized cascade
+ *          - a per-level occupancy bitmap lets a tickless caller find the next
+ *            non-empty slot with CTZ instead of scanning lists
+ *
+ *          With 4 levels of 64 slots and a 1ms wheel tick a single timer can be
+ *          armed up to ~4.6 hours ahead, longer deltas are re-cascaded through
+ *          the last level until they are in range.
+ *
+ *          static soft_timer_s blink; // zero-initialized is a valid idle timer
+ *          soft_timer_wheel_init(&pit_tick_datum);
+ *          soft_timer_start(&blink, generate_time_struct(PIT_SPEED_200MHz, MILLIS_E, 500), &blink_cb, NULL);
+ *
+ * @note    Callbacks run from soft_timer_tick(), i.e. in the PIT interrupt, with
+ *          interrupts enabled. A callback may start/stop any timer, itself included.
+ **/
+#define SOFT_TIMER_LEVELS    4
+#define SOFT_TIMER_SLOT_BITS 6
+#define SOFT_TIMER_SLOTS     (0x1UL << SOFT_TIMER_SLOT_BITS)
+#define SOFT_TIMER_SLOT_MASK (SOFT_TIMER_SLOTS - 1)
+#define SOFT_TIMER_MAX_DELTA ((0x1UL << (SOFT_TIMER_LEVELS * SOFT_TIMER_SLOT_BITS)) - 1)
+
+typedef void (*soft_timer_cb)(void* ctx);
+
+typedef struct soft_timer
+{
+  ilist_node_s  link;     // Slot membership, NULL/self when idle
+  uint64_t      expires;  // Absolute wheel tick, never wraps
+  uint32_t      period;   // Wheel ticks between re-arms, 0 for one-shot
+  soft_timer_cb callback;
+  void*         ctx;
+  uint8_t       level;    // Slot the timer is hashed into, used by stop
+  uint8_t       slot;
+} soft_timer_s;
+
+typedef struct
+{
+  ilist_s  slots[SOFT_TIMER_LEVELS][SOFT_TIMER_SLOTS];
+  uint32_t occupied[SOFT_TIMER_LEVELS][BITSET_WORDS(SOFT_TIMER_SLOTS)];
+  uint64_t now;      // Wheel ticks since init, never wraps
+  uint32_t tick_us;  // Length of one wheel tick
+  uint32_t pending;  // Number of armed timers
+} soft_timer_wheel_s;
+
+/**
+ * @brief   Reset the wheel, every armed timer is dropped
+ * @param   tick_datum Period of the hardware tick which calls soft_timer_tick(),
+ *          as returned by generate_time_struct() (val in ticks at tick_datum->freq)
+ **/
+void soft_timer_wheel_init(const timer_datum_s* tick_datum);
+
+/** @brief Set up a timer at runtime, timers in .bss need no init */
+void soft_timer_init(soft_timer_s* timer);
+
+/**
+ * @brief   Arm a one-shot timer, re-arming an already pending timer moves it
+ * @param   timer Caller owned storage, must stay valid while pending
+ * @param   delay Time until expiry, from generate_time_struct(). Rounded up
+ *          to whole wheel ticks so a timer never fires early
+ * @param   callback Called from the tick interrupt on expiry
+ * @param   ctx Passed to callback unchanged
+ **/
+void soft_timer_start(
+  soft_timer_s* timer,
+  timer_datum_s delay,
+  soft_timer_cb callback,
+  void*         ctx);
+
+/** @brief As soft_timer_start(), re-armed every 'period' until stopped */
+void soft_timer_start_periodic(
+  soft_timer_s* timer,
+  timer_datum_s period,
+  soft_timer_cb callback,
+  void*         ctx);
+
+/** @brief Arm in raw wheel ticks, 'delay' 0 is treated as 1, 'period' 0 is one-shot */
+void soft_timer_start_ticks(
+  soft_timer_s* timer,
+  uint32_t      delay,
+  uint32_t      period,
+  soft_timer_cb callback,
+  void*         ctx);
+
+/** @brief Disarm, no-op on an idle timer. The callback will not be called afterwards */
+void soft_timer_stop(soft_timer_s* timer);
+
+uint8_t soft_timer_pending(const soft_timer_s* timer);
+
+/** @brief Convert a timer datum into whole wheel ticks (rounded up, at least 1) */
+uint32_t soft_timer_datum_to_ticks(const timer_datum_s* datum);
+
+/** @brief Current wheel time in wheel ticks, low 32 bits (wraps) */
+uint32_t soft_timer_now();
+
+/** @brief Advance the wheel by one tick and run every expired callback, call from the tick ISR */
+void soft_timer_tick();
+
+#endif // SOFT_TIMER_H
@@ -0,0 +1,110 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef TICKLESS_TIMER_H
+#define TICKLESS_TIMER_H
+
+#include <stdint.h>
+
+#include "containers/min_heap.h"
+#include "typedefs/ttimer_mgr.h"
+
+/**
+ * @brief   Tickless one-shot scheduler, the PIT only fires at the next deadline
+ * @details Pending deadlines are kept in a min-heap (absolute 64-bit PIT
+ *          ticks). Whenever the earliest deadline changes the channel is
+ *          reprogrammed with exactly the distance to it, so there are no empty
+ *          periodic ticks in between. With nothing pending the channel is armed
+ *          with the full 32-bit range, only to keep the time base running.
+ *
+ *          The hardware is reached through 'tickless_hw_s' so the scheduling
+ *          core is identical on the teensy and in 'make hosttest', see
+ *          init_tickless_PIT0() in timer_manager.h for the PIT0 backend.
+ *
+ *          static tickless_timer_s blink;
+ *          init_tickless_PIT0(PIT_SPEED_200MHz);
+ *          tickless_start(&blink, generate_time_struct(PIT_SPEED_200MHz, MILLIS_E, 500), &blink_cb, NULL);
+ *
+ * @note    Compared to soft_timer.h this trades O(1) start/stop for O(log n),
+ *          but gives expiry at PIT resolution and no interrupts while idle.
+ *          Use the wheel for many coarse timeouts, this for few precise ones.
+ **/
+#define TICKLESS_MAX_TIMERS 32
+#define TICKLESS_MAX_ARM    0xffffffffUL
+
+typedef void (*tickless_cb)(void* ctx);
+
+typedef struct
+{
+  mheap_node_s node;     // node.key is the absolute deadline in PIT ticks
+  uint32_t     period;   // PIT ticks between re-arms, 0 for one-shot
+  tickless_cb  callback;
+  void*        ctx;
+} tickless_timer_s;
+
+/**
+ * @brief   Hardware hooks of the channel which runs the scheduler
+ * @param   arm      Restart the count, expire 'ticks' PIT ticks from now (>= 1).
+ *                   Returns elapsed() as read right before the restart
+ * @param   elapsed  PIT ticks counted since the last arm(), or since the last
+ *                   expiry once the expiry has been handled
+ **/
+typedef struct
+{
+  uint32_t (*arm)(uint32_t ticks);
+  uint32_t (*elapsed)(void);
+} tickless_hw_s;
+
+/** @brief Reset the scheduler onto 'hw' running at 'freq', every pending timer is dropped */
+void tickless_init(const tickless_hw_s* hw, pit_speed_e freq);
+
+void tickless_timer_init(tickless_timer_s* timer);
+
+/**
+ * @brief   Arm a one-shot timer 'delay' from now, re-arming a pending timer moves it
+ * @param   delay From generate_time_struct(), converted if its freq differs
+ * @return  0 if TICKLESS_MAX_TIMERS are already pending
+ **/
+uint8_t tickless_start(
+  tickless_timer_s* timer,
+  timer_datum_s     delay,
+  tickless_cb       callback,
+  void*             ctx);
+
+/** @brief As tickless_start(), re-armed every 'period' until stopped, without drift */
+uint8_t tickless_start_periodic(
+  tickless_timer_s* timer,
+  timer_datum_s     period,
+  tickless_cb       callback,
+  void*             ctx);
+
+/** @brief Arm in raw PIT ticks, 'period' 0 is one-shot */
+uint8_t tickless_start_ticks(
+  tickless_timer_s* timer,
+  uint32_t          delay,
+  uint32_t          period,
+  tickless_cb       callback,
+  void*             ctx);
+
+/**
+ * @brief   Disarm, no-op on an idle timer
+ * @note    The channel is not reprogrammed, if this was the earliest deadline
+ *          the next interrupt simply finds nothing due and rearms
+ **/
+void tickless_stop(tickless_timer_s* timer);
+
+/** @brief PIT ticks since tickless_init(), 64-bit so it does not wrap */
+uint64_t tickless_now();
+
+/** @brief Number of hardware expiries handled, for comparing against a periodic tick */
+uint32_t tickless_wakeups();
+
+/** @brief Run every due callback and rearm for the next deadline, call from the channel ISR after clearing its flag */
+void tickless_expire();
+
+/** @brief Convert 'datum' into PIT ticks at 'freq' without a 64-bit division */
+uint32_t tickless_datum_to_ticks(const timer_datum_s* datum, pit_speed_e freq);
+
+#endif // TICKLESS_TIMER_H
@@ -0,0 +1,144 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef TIMER_DRIVER_H
+#define TIMER_DRIVER_H
+
+#include <stdint.h>
+
+#include "typedefs/ttimer_mgr.h"
+
+/**
+ * @brief   One interface over every hardware timer channel (PIT, GPT, QuadTimer, RTWDOG)
+ * @details Each backend is a 'timer_driver_ops_s' table, each hardware channel a
+ *          'timer_channel_s' built by its constructor in timer_manager.h. Code
+ *          which only needs "fire in N ns" goes through timer_channel_arm_ns()
+ *          and never switches on timer_type_e.
+ *
+ *          Channels handed to timer_pool_add() can be allocated per deadline,
+ *          timer_pool_alloc() returns the free channel with the finest
+ *          resolution which still reaches the deadline in a single arm:
+ *
+ *          static timer_channel_s gpt1_oc1, tmr1_ch0;
+ *          timer_channel_gpt(&gpt1_oc1, GPT1_E, OCR_CH1);
+ *          timer_channel_qtimer(&tmr1_ch0, 0, 0, 0x7);
+ *          timer_pool_add(&gpt1_oc1);
+ *          timer_pool_add(&tmr1_ch0);
+ *
+ *          timer_channel_s* ch = timer_pool_alloc(time_to_ns64(MICROS_E, 25), TIMER_CAP_ONESHOT);
+ *          timer_channel_arm_ns(ch, time_to_ns64(MICROS_E, 25), &done_cb, NULL);
+ *
+ * @note    A channel in the pool belongs to the pool, do not also run it through
+ *          start_PITx(), init_tickless_PIT0() or set_time().
+ *
+ *          timer_manager_s (init_pitman()/start_PITx(), init_gptman()/set_time())
+ *          is not routed through this table. Its channels reload in hardware
+ *          every period and its callbacks take no context. arm() here is a
+ *          one-shot with a context, so the managers keep their register paths
+ *          and new code uses timer_channel_s.
+ **/
+#define TIMER_POOL_MAX 16
+
+/** @brief Channel capabilities, timer_pool_alloc() only returns channels with all requested bits */
+#define TIMER_CAP_ONESHOT (0x1 << 0x0) // arm() fires once and stops
+#define TIMER_CAP_READ    (0x1 << 0x1) // read() returns a running count
+#define TIMER_CAP_CAPTURE (0x1 << 0x2) // capture() returns an input capture
+#define TIMER_CAP_RESETS  (0x1 << 0x3) // Expiry resets the chip (watchdogs), never allocated
+
+typedef void (*timer_channel_cb)(void* ctx);
+
+typedef struct timer_channel_s timer_channel_s;
+
+/**
+ * @brief   Backend operations, one static table per peripheral type
+ * @param   configure Clock gating, module reset and IRQ routing, called once per channel
+ * @param   arm       Expire 'ticks' (1..max_ticks) channel ticks from now, cancels a pending arm
+ * @param   cancel    Disarm, no callback is run afterwards
+ * @param   read      Current count in channel ticks (counting up, may wrap at max_ticks)
+ * @param   capture   Latest input capture in channel ticks, NULL without TIMER_CAP_CAPTURE
+ **/
+typedef struct
+{
+  void     (*configure)(timer_channel_s* ch);
+  void     (*arm)(timer_channel_s* ch, uint32_t ticks);
+  void     (*cancel)(timer_channel_s* ch);
+  uint32_t (*read)(timer_channel_s* ch);
+  uint32_t (*capture)(timer_channel_s* ch);
+} timer_driver_ops_s;
+
+struct timer_channel_s
+{
+  const timer_driver_ops_s* ops;
+  timer_type_e              type;
+  uint8_t                   unit;          // GPT1/2, TMR1..4 (0 based)
+  uint8_t                   index;         // PIT channel, OCR channel or QuadTimer channel
+  uint8_t                   caps;          // TIMER_CAP_*
+  uint8_t                   allocated;
+  uint8_t                   config;        // Backend specific, QuadTimer prescaler
+  uint32_t                  freq_hz;       // Tick rate
+  uint32_t                  max_ticks;     // Longest single arm()
+  time_q32_t                ticks_per_ns;  // Q32.32, filled in by timer_channel_setup()
+  timer_channel_cb          callback;
+  void*                     ctx;
+  irq_slot_s                irq_slot;      // Backend ISR slot, the channel is its context
+};
+
+/**
+ * @brief   Fill in the generic part of a channel, used by the backend constructors
+ * @details Computes ticks_per_ns once so arming is multiply only. Does not
+ *          touch hardware, ops->configure() does that.
+ **/
+void timer_channel_setup(
+  timer_channel_s*          ch,
+  const timer_driver_ops_s* ops,
+  timer_type_e              type,
+  uint8_t                   unit,
+  uint8_t                   index,
+  uint8_t                   caps,
+  uint32_t                  freq_hz,
+  uint32_t                  max_ticks);
+
+/**
+ * @brief   Nano-seconds to channel ticks, clamped to max_ticks and at least 1
+ * @details Whole tick multiples are exact, anything else is rounded down except
+ *          for less than 2^-32 ticks per ns of headroom, i.e. never early.
+ **/
+uint32_t timer_channel_ns_to_ticks(const timer_channel_s* ch, time_ns64_t ns);
+
+/** @brief True if 'ns' fits in a single arm() of the channel */
+uint8_t timer_channel_reaches(const timer_channel_s* ch, time_ns64_t ns);
+
+/** @brief Arm 'ns' from now, 'callback' runs from the channel ISR */
+void timer_channel_arm_ns(timer_channel_s* ch, time_ns64_t ns, timer_channel_cb callback, void* ctx);
+
+/** @brief Disarm a channel, no-op on an idle channel */
+void timer_channel_cancel(timer_channel_s* ch);
+
+/** @brief Called by the backend ISRs on expiry, runs the channel callback */
+void timer_channel_expired(timer_channel_s* ch);
+
+/**
+ * @brief   Hand a channel to the allocator, configures it
+ * @return  0 if TIMER_POOL_MAX channels are already pooled
+ **/
+uint8_t timer_pool_add(timer_channel_s* ch);
+
+/**
+ * @brief   Take the best free channel for a deadline 'ns' from now
+ * @details Of the free channels with every bit of 'caps', the finest resolution
+ *          one which reaches 'ns' in a single arm() wins, on a tie the shorter
+ *          range one so long-range channels stay free. If none reaches 'ns'
+ *          the longest range channel is returned (the caller re-arms for the rest).
+ * @return  NULL if no free channel has 'caps'
+ **/
+timer_channel_s* timer_pool_alloc(time_ns64_t ns, uint8_t caps);
+
+/** @brief Cancel and return a channel to the pool */
+void timer_pool_free(timer_channel_s* ch);
+
+/** @brief Drop every pooled channel, for tests and re-initialisation */
+void timer_pool_reset();
+
+#endif // TIMER_DRIVER_H
@@ -11,6 +11,11 @@
 /* Utils@Permadev */
 #include "utils/utimer_mgr.h"
 
+#include "tickless_timer.h"
+#include "timer_driver.h"
+#include "input_capture.h"
+#include "pit_demux.h"
+
 // General Purpose Timers
 #ifndef GP_TIMER_H
   #define GP_TIMER_H
@@ -113,6 +118,10 @@ set_time(timer_manager_s* restrict gptman,
 void
 __setup_gpt2__();
 
+/** @brief Mux pin 15 (GPIO_AD_B1_03) onto GPT2 capture input 1, the GPS 1PPS input */
+void
+__route_gpt2_capin1__();
+
 #endif // GP_TIMER_H
 
 #ifndef PI_TIMER_H
@@ -217,13 +226,13 @@ __setup_gpt2__();
   #define PIT_TCTRL0_IRQ_EN(x)    PIT_TCTRL0 = PIT_TCTRL_IRQ(x, PIT_TCTRL0)
   #define PIT_TCTRL0_TIMER_EN(x)  PIT_TCTRL0 = PIT_TCTRL_TIMER(x, PIT_TCTRL0)
 
-  #define PIT_TCTRL1_CHAIN_SET(x) PIT_TCTRL1 = PIT_TCTRL_CHAIN(x, PIT_TCTRL3)
-  #define PIT_TCTRL1_IRQ_EN(x)    PIT_TCTRL1 = PIT_TCTRL_IRQ(x, PIT_TCTRL3)
-  #define PIT_TCTRL1_TIMER_EN(x)  PIT_TCTRL1 = PIT_TCTRL_TIMER(x, PIT_TCTRL3)
+  #define PIT_TCTRL1_CHAIN_SET(x) PIT_TCTRL1 = PIT_TCTRL_CHAIN(x, PIT_TCTRL1)
+  #define PIT_TCTRL1_IRQ_EN(x)    PIT_TCTRL1 = PIT_TCTRL_IRQ(x, PIT_TCTRL1)
+  #define PIT_TCTRL1_TIMER_EN(x)  PIT_TCTRL1 = PIT_TCTRL_TIMER(x, PIT_TCTRL1)
 
-  #define PIT_TCTRL2_CHAIN_SET(x) PIT_TCTRL2 = PIT_TCTRL_CHAIN(x, PIT_TCTRL3)
-  #define PIT_TCTRL2_IRQ_EN(x)    PIT_TCTRL2 = PIT_TCTRL_IRQ(x, PIT_TCTRL3)
-  #define PIT_TCTRL2_TIMER_EN(x)  PIT_TCTRL2 = PIT_TCTRL_TIMER(x, PIT_TCTRL3)
+  #define PIT_TCTRL2_CHAIN_SET(x) PIT_TCTRL2 = PIT_TCTRL_CHAIN(x, PIT_TCTRL2)
+  #define PIT_TCTRL2_IRQ_EN(x)    PIT_TCTRL2 = PIT_TCTRL_IRQ(x, PIT_TCTRL2)
+  #define PIT_TCTRL2_TIMER_EN(x)  PIT_TCTRL2 = PIT_TCTRL_TIMER(x, PIT_TCTRL2)
 
   #define PIT_TCTRL3_CHAIN_SET(x) PIT_TCTRL3 = PIT_TCTRL_CHAIN(x, PIT_TCTRL3)
   #define PIT_TCTRL3_IRQ_EN(x)    PIT_TCTRL3 = PIT_TCTRL_IRQ(x, PIT_TCTRL3)
@@ -277,27 +286,84 @@ init_pitman(timer_manager_s* restrict pitman,
             timer_manager_sick_cb tick_callback);
 
 /**
- * @brief   Sets appropriate PIT timer registers
- * @details
+ * @brief   One-time PIT setup, sets every clock, pad, NVIC and channel register
+ * @details Clock gating/root, the POR errata fix, the IOMUXC trigger pad, the
+ *          vector entry, NVIC priority and finally LDVAL/TCTRL of channels 0
+ *          and 1. Call once, the tick runs through the PIT demux (pit_demux.h)
+ *          which already clears TIF, the callback only rearms to change the period.
  * @param   pit_mgr  See @timer_manager_s
  *
  * @note    Do not use with uninit. pit_mgr, will cause a crash, no safety checks
  */
 void
-setup_PITx(timer_manager_s* restrict pitman);
+pit_configure(timer_manager_s* restrict pitman);
 
+/** @brief Register block of a PIT channel, see pit_channel_regs_s in pit_demux.h */
+#define PIT_CHANNEL(pit_timerx) \
+  MAP_32BIT_ANYREG(pit_channel_regs_s, 0x40084100 + (((uint32_t)(pit_timerx)) << 0x4))
 
 /**
- * @brief   Resolves the ticks from the given value and time type
- * @details
- */
-uint32_t resolve_time(pit_speed_e freq, timetype_e time_type, uint32_t targetval, ttconversiondir_e conversiondir);
+ * @brief   Restart a channel with a new load value, 4 register writes
+ * @details The channel is stopped first because a LDVAL write otherwise only
+ *          takes effect at the next reload. The flag is cleared before TIE is
+ *          set again so no stale interrupt is raised.
+ * @param   pit_timerx Channel
+ * @param   ldval      Raw load value, the period is ldval + 1 ticks
+ **/
+static inline void
+pit_rearm(pit_timer_e pit_timerx, uint32_t ldval)
+{
+  PIT_CHANNEL(pit_timerx).TCTRL = 0;
+  PIT_CHANNEL(pit_timerx).LDVAL = ldval;
+  PIT_CHANNEL(pit_timerx).TFLG  = 0x1;
+  PIT_CHANNEL(pit_timerx).TCTRL = 0x3; // TIE | TEN
+}
+
+/**
+ * @brief   Acknowledge a periodic channel, 1 register write
+ * @details The PIT reloads LDVAL on its own at expiry, a periodic tick only
+ *          needs TIF cleared (write 1 to clear, no read-modify-write).
+ * @note    Follow with a 'dsb' before leaving the ISR, see irq_handler.h
+ **/
+static inline void
+pit_ack(pit_timer_e pit_timerx)
+{
+  PIT_CHANNEL(pit_timerx).TFLG = 0x1;
+}
+
+/**
+ * @brief   Run 'handler' on every expiry of 'pit_timerx', through the shared PIT demux
+ * @details Installs the demux as the only slot of IRQ_PIT on first use (vector,
+ *          priority 0, enable), later calls only swap the channel's entry. The
+ *          flag is cleared before 'handler' runs, see pit_demux.h.
+ **/
+void
+pit_channel_attach(pit_timer_e pit_timerx, pit_channel_fp handler, void* ctx);
+
+/** @brief Stop dispatching 'pit_timerx', the channel keeps counting */
+void
+pit_channel_detach(pit_timer_e pit_timerx);
+
+/**
+ * @brief   Periodic work on one channel, 'handler' runs every ldval + 1 ticks
+ * @details Enables the PIT clock, attaches 'handler' and restarts the channel.
+ *          The four channels run independently, each at its own period.
+ * @note    Channels 2 and 3 are the monotonic clock once init_monotonic_clock()
+ *          ran, channel 0 is the tick of start_PITx() or init_tickless_PIT0().
+ **/
+void
+pit_channel_start(pit_timer_e pit_timerx, uint32_t ldval, pit_channel_fp handler, void* ctx);
+
+/** @brief Stop the count and the dispatch of 'pit_timerx' */
+void
+pit_channel_stop(pit_timer_e pit_timerx);
 
 /**
  * @brief   Resolves the ticks from the given value and time type
  * @details
  */
-float resolve_time_as_float(pit_speed_e freq, timetype_e time_resolution, uint32_t targetval, ttconversiondir_e conversiondir);
+uint32_t resolve_time(pit_speed_e freq, timetype_e time_type, uint32_t targetval, ttconversiondir_e conversiondir);
+
 
 
 /**
@@ -326,13 +392,160 @@ setup_pit_irq(timer_manager_s* restrict pitman, pit_timer_e pit_timerx);
 void
 reset_pit(timer_manager_s* restrict pitman, pit_timer_e pit_timerx);
 
+/**
+ * @brief   Gate the PIT clock on (perclk from the IPG root) and enable the module
+ * @details Idempotent, running channels are not touched.
+ **/
+void
+__pit_enable_clock__();
+
+/**
+ * @brief   Run the tickless scheduler (tickless_timer.h) on PIT channel 0
+ * @details Enables the PIT clock, installs the channel 0 handler and arms the
+ *          channel for the full 32-bit range until the first timer is started.
+ *          From then on LDVAL0 is only written when the earliest deadline
+ *          changes, instead of a fixed period.
+ * @param   freq Must match the PIT clock, same as the freq of the timer datums
+ * @note    Replaces start_PITx() for channel 0, the two can not share it
+ **/
+void
+init_tickless_PIT0(pit_speed_e freq);
+
 /** @brief  Hardware trigger tick, used for IRQs */
 void hwtick();
 
 /** @brief  Software polling timer tick, used for polling purposes when accuracy is a lesser concern */ 
-void polltick(const float delta_time);
+void polltick(const time_ns64_t delta_ns);
 
 /** @brief  Led toggle (used in software polling sanity checking) */ 
-void led_toggle(const float delta_time, vuint32_t ctrl_pos); // sanity checking test
+void led_toggle(const time_ns64_t delta_ns, vuint32_t ctrl_pos); // sanity checking test
+
+#endif // PIT_TIMER_H
+
+// Generic timer driver backends, see timer_driver.h
+#ifndef TIMER_BACKENDS_H
+  #define TIMER_BACKENDS_H
+
+/** @brief IPG root on the teensy 4.1 (600MHz core / 4), clocks the QuadTimers */
+  #define TIMER_IPG_HZ    150000000UL
+  #define TIMER_GPT_HZ    24000000UL  // 24MHz oscillator, SRC_IPG_CLK_24M
+  #define TIMER_RTWDOG_HZ 32768UL     // LPO clock
+
+/** @brief GPT register block, 52.7 p.2957 */
+typedef struct
+{
+  vuint32_t CR;
+  vuint32_t PR;
+  vuint32_t SR;
+  vuint32_t IR;
+  vuint32_t OCR[3];
+  vuint32_t ICR[2];
+  vuint32_t CNT;
+} gpt_regs_s;
+
+  #define GPT_REGS(gpt_x) \
+    MAP_32BIT_ANYREG(gpt_regs_s, ((gpt_x) == GPT1_E) ? 0x401ec000 : 0x401f0000)
+
+  #define GPT_CR_EN_24M (0x1 << 0xa)
+  #define GPT_CR_FRR    (0x1 << 0x9)
+  #define GPT_CR_RESET  (0x1 << 0xf)
+  #define GPT_SR_IF1    (0x1 << 0x3) // Input capture 1, same bit in IR (IF1IE)
+  #define GPT_SR_IF2    (0x1 << 0x4)
+
+/** @brief QuadTimer channel register block (16-bit), 0x20 apart, 54.6 p.2990 */
+typedef struct
+{
+  vuint16_t COMP1;
+  vuint16_t COMP2;
+  vuint16_t CAPT;
+  vuint16_t LOAD;
+  vuint16_t HOLD;
+  vuint16_t CNTR;
+  vuint16_t CTRL;
+  vuint16_t SCTRL;
+  vuint16_t CMPLD1;
+  vuint16_t CMPLD2;
+  vuint16_t CSCTRL;
+  vuint16_t FILT;
+  vuint16_t DMA;
+  vuint16_t _reserved[2];
+  vuint16_t ENBL; // Channel 0 block only
+} qtimer_channel_regs_s;
+
+  #define QTIMER_CHANNEL(unit, index) \
+    MAP_32BIT_ANYREG(qtimer_channel_regs_s, 0x401dc000 + (((uint32_t)(unit)) << 0xe) + (((uint32_t)(index)) << 0x5))
+
+/** @brief RTWDOG (WDOG3) registers, 57.8 p.3082 */
+typedef struct
+{
+  vuint32_t CS;
+  vuint32_t CNT;
+  vuint32_t TOVAL;
+  vuint32_t WIN;
+} rtwdog_regs_s;
+
+  #define RTWDOG_REGS MAP_32BIT_ANYREG(rtwdog_regs_s, 0x400bc000)
+
+  #define RTWDOG_CS_EN       (0x1 << 0x7)
+  #define RTWDOG_CS_INT      (0x1 << 0x6)
+  #define RTWDOG_CS_UPDATE   (0x1 << 0x5)
+  #define RTWDOG_CS_CLK_LPO  (0x1 << 0x8)
+  #define RTWDOG_CS_ULK      (0x1 << 0xb)
+  #define RTWDOG_CS_CMD32EN  (0x1 << 0xd)
+  #define RTWDOG_CS_FLG      (0x1 << 0xe)
+  #define RTWDOG_UNLOCK_KEY  0xd928c520
+  #define RTWDOG_REFRESH_KEY 0xb480a602
+
+/**
+ * @brief   PIT channel as a generic timer channel, one-shot at 'freq'
+ * @param   pit_timerx PIT_TIMER_00 or PIT_TIMER_01, 2 and 3 are the monotonic clock
+ **/
+void
+timer_channel_pit(timer_channel_s* ch, pit_timer_e pit_timerx, pit_speed_e freq);
+
+/**
+ * @brief   GPT output compare channel as a generic timer channel
+ * @details The GPT free-runs from the 24MHz oscillator, the three compare
+ *          channels share the counter and are armed independently. OCR_CH1/2
+ *          also capture on ICR1/2 (rising edge) once their pad is muxed.
+ **/
+void
+timer_channel_gpt(timer_channel_s* ch, gptx_e gpt_x, gpt_ocr_e ocr_ch);
+
+/**
+ * @brief   QuadTimer channel as a generic timer channel
+ * @param   unit          TMR1..TMR4 as 0..3
+ * @param   index         Channel 0..3 within the unit
+ * @param   prescale_log2 0..7, the channel counts at TIMER_IPG_HZ >> prescale_log2 (16-bit)
+ **/
+void
+timer_channel_qtimer(timer_channel_s* ch, uint8_t unit, uint8_t index, uint8_t prescale_log2);
+
+/**
+ * @brief   RTWDOG as a generic timer channel, expiry resets the chip
+ * @details arm() is the watchdog timeout (refreshing it), the callback runs from
+ *          the early warning interrupt 255 bus clocks before the reset. Marked
+ *          TIMER_CAP_RESETS so timer_pool_alloc() never hands it out.
+ **/
+void
+timer_channel_rtwdog(timer_channel_s* ch);
+
+/**
+ * @brief   Timestamp GPT2 capture 1 (pin 15, 1PPS) into 'ring'
+ * @details GPT2 free-runs at TIMER_GPT_HZ and latches its count on every rising
+ *          edge. CAPTURE_IRQ pushes from a short ISR, CAPTURE_POLLED raises no
+ *          interrupt at all and the stamps are moved by capture_poll_GPT2().
+ *
+ *          The GPT has no DMA request line on this part, so for high edge rates
+ *          poll from a tight loop instead of taking an interrupt per edge. The
+ *          hardware holds one stamp per input, poll at least once per edge.
+ * @note    Owns GPT2, do not pool GPT2 channels (timer_channel_gpt()) as well
+ **/
+void
+init_capture_GPT2(capture_ring_s* ring, capture_mode_e mode);
+
+/** @brief Move pending GPT2 captures into the ring, also the body of the capture ISR */
+void
+capture_poll_GPT2(capture_ring_s* ring);
 
-#endif // PIT_TIMER_H
\ No newline at end of file
+#endif // TIMER_BACKENDS_H
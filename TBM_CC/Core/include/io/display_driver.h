@@ -7,6 +7,9 @@
 #define DISPLAY_DRIVER_H
 
 #include "sys/memory_map.h"
+#include "sys/coroutine.h"
+#include "typedefs/ttimer_mgr.h"
+#include "devices/lpi2c.h"
 
 /**
  * @brief 128x32 MINIOLED
@@ -269,6 +272,38 @@ typedef enum
 #define SSD1306_I2C_IDLE_TIME        1300
 #define SSD1306_I2C_CLOCK            2500
 
+/**
+ * @brief   LPI2C1 backend of the interface, Teensy pins 19 (SCL) and 18 (SDA)
+ * @details ssd1306_phy_start() opens a transfer, send_fp collects the control
+ *          and command bytes, send_buffer_fp hands over one data block and
+ *          ssd1306_phy_stop() submits it all as START, address, bytes, STOP.
+ *          The block is not copied, it goes out by eDMA from the caller's
+ *          buffer, so a whole 1KiB frame costs the CPU the setup and one
+ *          interrupt. ssd1306_phy_close() waits for the bus.
+ *
+ * @note    The interface functions carry no context, the backend is a single
+ *          display. send_fp bytes after the data block are not sent.
+ **/
+#define SSD1306_I2C_ADDR    0x3c // SA0 low, 0x3d with SA0 high
+#define SSD1306_I2C_HZ      LPI2C_FAST_HZ // Datasheet limit, most modules also take LPI2C_FAST_PLUS_HZ
+#define SSD1306_DMA_CHANNEL 0x1
+#define SSD1306_NVIC_PRIO   0x40
+#define SSD1306_HEAD_MAX    32 // Control and command bytes per transfer
+#define SSD1306_CTRL_CMD    0x00 // Co = 0, D/C# = 0, command bytes follow
+#define SSD1306_CTRL_DATA   0x40 // Co = 0, D/C# = 1, GDDRAM bytes follow
+
+typedef struct
+{
+  lpi2c_s*             bus;
+  const unsigned char* data;
+  unsigned short       len;
+  unsigned char        head[SSD1306_HEAD_MAX];
+  unsigned char        head_len;
+  unsigned char        addr;
+  lpi2c_done_fp        done; // Completion of ssd1306_phy_stop() transfers, NULL for none
+  void*                ctx;
+} ssd1306_lpi2c_s;
+
 /** Send Start to SSD1306 display. */
 typedef void (*start_fp_t)(void);
 
@@ -294,22 +329,57 @@ typedef struct
   sendbuf_fp_t send_buffer_fp;
 } ssd1306_intf; // ssd1306 interface
 
+/**
+ * @brief   State of a non-blocking bit-banged transfer, the context of ssd1306_phy_send_co()
+ * @details Set 'buf', 'size', 'line' and 'trigger_gpio', then co_task_start() it. The
+ *          bit period is waited out with CO_AWAIT, other tasks run in between.
+ **/
+typedef struct
+{
+  const unsigned char* buf;
+  unsigned short       size;
+  unsigned char        bit;     // Bits of the current byte left to send
+  time_ns64_t          next_ns; // Earliest clock_now_ns() of the next pulse
+  uint8_t              line;    // Data line ID, gpio_add_device()
+  trigger_gpio_fp_t    trigger_gpio;
+} ssd1306_phy_tx_s;
+
+/** @brief Coroutine body sending 'size' bytes MSB first, one pulse per SSD1306_I2C_CLOCK ns */
+co_status_e
+ssd1306_phy_send_co(co_s* co, void* ctx);
+
 // physical layer
 static void
-ssd1306_phy_send_byte(unsigned char data, trigger_gpio_fp_t trigger_gpio);
+ssd1306_phy_send(unsigned char data);
 static void
-ssd1306_phy_send_bytes(const unsigned char*  buf,
-                       unsigned short        size,
-                       trigger_gpio_fp_t     trigger_gpio);
+ssd1306_phy_send_buffer(const unsigned char*  buf,
+                        unsigned short        size,
+                        trigger_gpio_fp_t     trigger_gpio);
 static void
 ssd1306_phy_start(void);
 static void
 ssd1306_phy_stop(void);
 static void
 ssd1306_phy_close();
+
+/** @brief Bring up LPI2C1 with DMA on pins 'scl' = 19 and 'sda' = 18, 'sa' is the SA0 level */
 void
 ssd1306_phy_init(char scl, char sda, char sa);
 
+/** @brief Use 'bus' for the interface, 'done' runs after every ssd1306_phy_stop() transfer */
+void
+ssd1306_lpi2c_init(lpi2c_s* bus, unsigned char addr, lpi2c_done_fp done, void* ctx);
+
+/**
+ * @brief   Write 'size' GDDRAM bytes without waiting, 'done' runs in interrupt context
+ * @return  0 if the bus is not set up or still busy, 'frame' stays untouched until 'done'
+ **/
+unsigned char
+ssd1306_send_frame(const unsigned char* frame,
+                   unsigned short       size,
+                   lpi2c_done_fp        done,
+                   void*                ctx);
+
 // abstracted layer
 ssd1306_intf*
 ssd1306_create_interface();
@@ -0,0 +1,131 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef COROUTINE_H
+#define COROUTINE_H
+
+#include <stdint.h>
+
+#include "devices/soft_timer.h"
+#include "sys/scheduler.h"
+
+/**
+ * @brief   Stackless coroutines (protothreads) for driver state machines
+ * @details A coroutine is a function whose body sits between CO_BEGIN and
+ *          CO_END. Every wait stores the source line in 'co_s' and returns, the
+ *          next call jumps back to that line through a switch, so a flow like
+ *          "send bit, wait, continue" reads top to bottom without a stack of its
+ *          own and without blocking the core:
+ *
+ *          static co_status_e tx_body(co_s* co, void* ctx)
+ *          {
+ *            tx_s* tx = (tx_s*)ctx;
+ *            CO_BEGIN(co);
+ *            for (tx->bit = 0; tx->bit < 8; tx->bit++)
+ *            {
+ *              pulse(tx);
+ *              CO_AWAIT(co, clock_now_ns() >= tx->next_ns); // Polled, for short waits
+ *            }
+ *            CO_AWAIT_TICKS(co, 2);                          // Sleeps on the soft timer wheel
+ *            CO_END(co);
+ *          }
+ *
+ *          co_task_start(&tx_task, &tx_body, &tx, 0x2);    // Runs on sys/scheduler.h
+ *
+ * @note    Locals do not survive a wait, keep state in 'ctx'. The macros use
+ *          a switch, so a body can not contain one spanning a wait, and two
+ *          waits can not share a source line.
+ **/
+#define CO_LINE_DONE 0xffff
+
+typedef enum
+{
+  CO_YIELDED,  // Run again on the next pass
+  CO_SLEEPING, // Run again once soft_timer_now() reaches co_s.wake
+  CO_DONE,     // Reached CO_END or CO_EXIT, further calls return CO_DONE
+} co_status_e;
+
+typedef struct
+{
+  uint16_t line; // Resume point, 0 before the first call
+  uint32_t wake; // Wheel tick CO_AWAIT_TICKS sleeps until
+} co_s;
+
+typedef co_status_e (*co_fp)(co_s* co, void* ctx);
+
+#define CO_RESET(co) ((co)->line = 0)
+
+#define CO_BEGIN(co) \
+  switch ((co)->line) \
+  {                   \
+  case 0:
+
+#define CO_END(co)             \
+  }                            \
+  (co)->line = CO_LINE_DONE;   \
+  return CO_DONE
+
+/** @brief Leave the coroutine for good from anywhere in its body */
+#define CO_EXIT(co)            \
+  do {                         \
+    (co)->line = CO_LINE_DONE; \
+    return CO_DONE;            \
+  } while (0)
+
+/** @brief Give the other tasks one pass */
+#define CO_YIELD(co)         \
+  do {                       \
+    (co)->line = __LINE__;   \
+    return CO_YIELDED;       \
+    case __LINE__:;          \
+  } while (0)
+
+/** @brief Yield until 'cond' holds, re-checked on every pass */
+#define CO_AWAIT(co, cond)                 \
+  do {                                     \
+    (co)->line = __LINE__;                 \
+    case __LINE__:                         \
+    if (!(cond)) { return CO_YIELDED; }    \
+  } while (0)
+
+/** @brief Sleep for 'ticks' soft timer wheel ticks, the runner arms a timer instead of polling */
+#define CO_AWAIT_TICKS(co, ticks)                                                 \
+  do {                                                                            \
+    (co)->wake = soft_timer_now() + (ticks);                                      \
+    (co)->line = __LINE__;                                                        \
+    case __LINE__:                                                                \
+    if ((int32_t)(soft_timer_now() - (co)->wake) < 0) { return CO_SLEEPING; }     \
+  } while (0)
+
+/** @brief A coroutine bound to a scheduler task, stepped from the main loop */
+typedef struct
+{
+  sched_task_s task;
+  co_s         co;
+  co_fp        body;
+  void*        ctx;
+  co_status_e  status; // Of the last step
+} co_task_s;
+
+/** @brief (Re)start 'body' from CO_BEGIN as a task of 'priority' and post its first step */
+void co_task_start(co_task_s* co_task, co_fp body, void* ctx, uint8_t priority);
+
+/** @brief Stop stepping, a sleeping coroutine's timer is stopped as well */
+void co_task_stop(co_task_s* co_task);
+
+/** @brief Step a waiting coroutine now, e.g. from the ISR its CO_AWAIT condition depends on */
+static inline void
+co_task_wake(co_task_s* co_task)
+{
+  sched_post(&co_task->task);
+}
+
+static inline uint8_t
+co_task_done(const co_task_s* co_task)
+{
+  return co_task->status == CO_DONE;
+}
+
+#endif // COROUTINE_H
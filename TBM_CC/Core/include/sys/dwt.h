@@ -0,0 +1,57 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef DWT_H
+#define DWT_H
+#include "sys/memory_map.h"
+
+/**
+ * @brief Data Watchpoint and Trace unit, used for its cycle counter
+ * NOTE:
+ * In Resources/./DDI0403E_d_armv7m_arm.pdf:
+ * C1.8 (DWT), C1.6.5 (DEMCR)
+ *
+ * In Resources/./DDI0489B_cortex_m7_trm.pdf:
+ * 9.1 (Cortex-M7 requires the DWT software lock to be released first)
+ *
+ * @note CYCCNT counts core clock cycles (600MHz on the teensy 4.1) and wraps
+ * every ~7s, only use it for differences of short intervals.
+ **/
+typedef struct
+{
+  vuint32_t CTRL;      // RW
+  vuint32_t CYCCNT;    // RW
+  vuint32_t CPICNT;    // RW
+  vuint32_t EXCCNT;    // RW
+  vuint32_t SLEEPCNT;  // RW
+  vuint32_t LSUCNT;    // RW
+  vuint32_t FOLDCNT;   // RW
+  vuint32_t PCSR;      // RO
+} SReg_DWT;
+
+#define DWT_BASE_ADDR MAP_32BIT_ANYREG(SReg_DWT, 0xe0001000)
+#define DWT_CTRL      (DWT_BASE_ADDR.CTRL)
+#define DWT_CYCCNT    (DWT_BASE_ADDR.CYCCNT)
+#define DWT_LAR       MAP_32BIT_ANYREG(vuint32_t, 0xe0001fb0) // Lock Access Register
+#define SCB_DEMCR     MAP_32BIT_ANYREG(vuint32_t, 0xe000edfc) // Debug Exception and Monitor Control
+
+#define DWT_LAR_UNLOCK     0xc5acce55
+#define DWT_CTRL_CYCCNTENA (0x1 << 0x0)
+#define SCB_DEMCR_TRCENA   (0x1 << 0x18)
+
+/** @brief Enable the trace block and start CYCCNT from 0 */
+static inline void
+dwt_enable_cycle_counter()
+{
+  SCB_DEMCR |= SCB_DEMCR_TRCENA;
+  DWT_LAR    = DWT_LAR_UNLOCK;
+  DWT_CYCCNT = 0;
+  DWT_CTRL  |= DWT_CTRL_CYCCNTENA;
+}
+
+/** @brief Current core cycle count, a single load */
+#define DWT_CYCLES() ((uint32_t)DWT_CYCCNT)
+
+#endif // DWT_H
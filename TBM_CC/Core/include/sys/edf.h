@@ -0,0 +1,112 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef EDF_H
+#define EDF_H
+
+#include <stdint.h>
+
+#include "containers/min_heap.h"
+#include "devices/tickless_timer.h"
+#include "sys/scheduler.h"
+
+/**
+ * @brief   Earliest-deadline-first dispatch of periodic jobs
+ * @details Every job declares a period, a relative deadline and a WCET budget,
+ *          all in PIT ticks. Jobs run to completion, so admission is the
+ *          non-preemptive EDF test: at every job's window min(deadline, period)
+ *          the summed density budget / window of the jobs with a window up to
+ *          it, plus the longest budget of a job with a longer window (which
+ *          may have just started) over the window, stays at or below 1.
+ *          Every admitted deadline is met then. Load can approach 100% when
+ *          budgets are small against the shortest deadline, long budgets
+ *          cost headroom at every shorter level.
+ *
+ *          Releases come from a tickless timer per job (tickless_timer.h), the
+ *          release pushes the job onto a min-heap keyed by its absolute deadline
+ *          and posts the dispatcher, a task of sys/scheduler.h. The dispatcher
+ *          runs the earliest deadline first and measures every run:
+ *
+ *          static edf_s     edf;
+ *          static edf_job_s ctrl;
+ *          edf_init(&edf, &tickless_now, 0x0);
+ *          edf_job_init(&ctrl, &ctrl_step, NULL, period, deadline, wcet);
+ *          if (edf_admit(&edf, &ctrl)) { edf_start(&edf, &ctrl, 0); }
+ *
+ *          - overruns: a run took longer than its budget
+ *          - misses:   a run ended after its deadline, or the next release came
+ *                      while the previous instance still waited (it is dropped)
+ *
+ * @note    A job blocks shorter deadlines for up to its own budget, which
+ *          admission accounts for. Keep budgets small against the shortest
+ *          deadline, or give long work its own kernel thread.
+ **/
+#define EDF_MAX_JOBS  16
+#define EDF_UTIL_ONE  0x10000 // Density 1.0 in Q16
+
+typedef void (*edf_job_fp)(void* ctx);
+typedef uint64_t (*edf_now_fp)(void);
+
+typedef struct edf_job_s
+{
+  mheap_node_s      node;         // key is the absolute deadline
+  tickless_timer_s  release_timer;
+  struct edf_s*     edf;
+  edf_job_fp        run;
+  void*             ctx;
+  uint32_t          period;
+  uint32_t          deadline;     // Relative to the release
+  uint32_t          budget;       // WCET
+  uint32_t          density_q16;  // budget / min(deadline, period)
+  uint32_t          releases;
+  uint32_t          runs;
+  uint32_t          overruns;
+  uint32_t          misses;
+  uint32_t          max_exec;     // Longest run, ticks
+  uint8_t           admitted;
+} edf_job_s;
+
+typedef struct edf_s
+{
+  mheap_s       ready;
+  mheap_node_s* storage[EDF_MAX_JOBS];
+  edf_job_s*    admitted[EDF_MAX_JOBS]; // First 'jobs' entries, for the admission test
+  sched_task_s  dispatcher;
+  edf_now_fp    now;
+  uint32_t      density_q16; // Sum over the admitted jobs
+  uint32_t      jobs;
+} edf_s;
+
+/** @brief Set up an empty dispatcher on the time base 'now' (PIT ticks), its task runs at 'priority' */
+void edf_init(edf_s* edf, edf_now_fp now, uint8_t priority);
+
+/** @brief Describe a job, times in ticks of the edf time base. 'deadline' 0 means 'period' */
+void edf_job_init(edf_job_s* job, edf_job_fp run, void* ctx, uint32_t period, uint32_t deadline, uint32_t budget);
+
+/**
+ * @brief   Admission control, non-preemptive density test at every deadline level
+ * @return  0 if the set with the job could miss a deadline, or EDF_MAX_JOBS are admitted
+ **/
+uint8_t edf_admit(edf_s* edf, edf_job_s* job);
+
+/** @brief Stop releasing 'job', drop a waiting instance and give its density back */
+void edf_remove(edf_s* edf, edf_job_s* job);
+
+/** @brief Release 'job' every period on its tickless timer, the first time 'phase' ticks from now */
+uint8_t edf_start(edf_s* edf, edf_job_s* job, uint32_t phase);
+
+/** @brief Release one instance now, what the release timer calls. ISR safe */
+void edf_release(edf_s* edf, edf_job_s* job);
+
+/** @brief Run the earliest deadline ready job, 1 if one ran. Thread context */
+uint8_t edf_dispatch_one(edf_s* edf);
+
+/** @brief Run ready jobs until none is left, returns the number run */
+uint32_t edf_dispatch(edf_s* edf);
+
+/** @brief Summed density of the admitted jobs, Q16 (EDF_UTIL_ONE is 100%) */
+uint32_t edf_density(const edf_s* edf);
+
+#endif // EDF_H
@@ -0,0 +1,90 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef IRQ_DISPATCH_H
+#define IRQ_DISPATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sys/irq_handler.h"
+#include "sys/memory_map.h"
+
+/**
+ * @brief   (handler, context) dispatch on top of the RAM vector table
+ * @details Every IRQ line has a chain of caller-owned slots. The vector entry of
+ *          a line with slots is a dispatcher which runs each slot's handler with
+ *          its context, so several timers or devices share one line and each
+ *          handler gets its own state instead of looking up a global:
+ *
+ *          static irq_slot_s slot;
+ *          irq_attach(&slot, IRQ_GPT2, &my_handler, &my_device);
+ *          NVIC_SET_PRIORITY(IRQ_GPT2, 0x0);
+ *          NVIC_ENABLE_IRQ(IRQ_GPT2);
+ *
+ *          Handlers on a shared line must check their own status flag, a
+ *          handler can run for another slot's interrupt.
+ *
+ *          The default dispatcher finds its line from IPSR. A hot line can get a
+ *          trampoline with the line number folded in instead, generated by
+ *          IRQ_DISPATCH_TRAMPOLINE() and installed with irq_dispatch_fast().
+ *
+ * @note    irq_dispatch_init() points VTOR at __vectors_ram__ (DTCM, see
+ *          startup.c), until then none of this is used by the core.
+ **/
+#define SCB_VTOR MAP_32BIT_ANYREG(vuint32_t, 0xe000ed08) // Vector Table Offset Register
+
+typedef void (*irq_handler_fp)(void* ctx);
+
+typedef struct irq_slot_s
+{
+  irq_handler_fp     handler;
+  void*              ctx;
+  struct irq_slot_s* next;
+  irq_num_e          irq;
+  uint8_t            attached;
+} irq_slot_s;
+
+/** @brief Slot chain per IRQ line, NULL for lines without slots */
+extern irq_slot_s* volatile g_irq_lines[NVIC_IRQs];
+
+/**
+ * @brief   Fill every empty vector with the unhandled trap and move VTOR to __vectors_ram__
+ * @details Entries already installed (add_to_irq_v()) are kept, stack pointer
+ *          and reset entries are taken from the boot table.
+ **/
+void irq_dispatch_init();
+
+/**
+ * @brief   Add 'slot' to the end of the chain of 'irq', installs the dispatcher on an empty line
+ * @details Attaching an already attached slot to the same line only updates its
+ *          handler and context, so repeated setup calls are harmless.
+ **/
+void irq_attach(irq_slot_s* slot, irq_num_e irq, irq_handler_fp handler, void* ctx);
+
+/** @brief Remove 'slot' from its line, the last slot puts the unhandled trap back in the vector */
+void irq_detach(irq_slot_s* slot);
+
+/** @brief Install a trampoline from IRQ_DISPATCH_TRAMPOLINE() as the vector of 'irq', after its first irq_attach() */
+void irq_dispatch_fast(irq_num_e irq, void_func trampoline);
+
+/** @brief Run every slot of 'irq', what the vector entries call. 'next' is read first so a handler may detach itself */
+static inline void
+irq_dispatch(irq_num_e irq)
+{
+  irq_slot_s* slot = g_irq_lines[irq];
+  while (slot != NULL)
+  {
+    irq_slot_s* next = slot->next;
+    slot->handler(slot->ctx);
+    slot = next;
+  }
+}
+
+/** @brief Defines 'name' as a vector entry for 'irq' which skips the IPSR lookup */
+#define IRQ_DISPATCH_TRAMPOLINE(name, irq) \
+  static void name(void) { irq_dispatch(irq); }
+
+#endif // IRQ_DISPATCH_H
@@ -6,6 +6,8 @@
 #ifndef IRQ_HANDLER_H
 #define IRQ_HANDLER_H
 
+#include <stdint.h>
+
 /**
  *  @brief 4.3 CM7 interrupts (p.43 - p.52), IMXRT1060 Processor Ref Manual
  *
@@ -232,8 +234,50 @@ remove_from_irq_v(irq_num_e irq)
   __asm__ volatile("" : : : "memory");
 }
 
-#define __disable_irq() __asm__ volatile("CPSID i" ::: "memory")
-#define __enable_irq()  __asm__ volatile("CPSIE i" ::: "memory")
+#if defined(__arm__)
+  #define __disable_irq() __asm__ volatile("CPSID i" ::: "memory")
+  #define __enable_irq()  __asm__ volatile("CPSIE i" ::: "memory")
+#else // Host builds (make hosttest), there is nothing to mask
+  #define __disable_irq() __asm__ volatile("" ::: "memory")
+  #define __enable_irq()  __asm__ volatile("" ::: "memory")
+#endif
+
+/**
+ * @brief   Nestable critical section, returns the previous PRIMASK
+ * @details Unlike a bare __disable_irq()/__enable_irq() pair this does not
+ *          re-enable interrupts when called from a context that already had
+ *          them masked (an ISR, or another critical section).
+ *
+ *          uint32_t primask = __irq_save__();
+ *          ...
+ *          __irq_restore__(primask);
+ **/
+static inline uint32_t
+__irq_save__(void) __attribute__((always_inline, unused));
+static inline uint32_t
+__irq_save__(void)
+{
+  uint32_t primask = 0;
+#if defined(__arm__)
+  __asm__ volatile("MRS %0, primask\n\tCPSID i" : "=r"(primask) : : "memory");
+#else
+  __asm__ volatile("" ::: "memory");
+#endif
+  return primask;
+}
+
+static inline void
+__irq_restore__(uint32_t primask) __attribute__((always_inline, unused));
+static inline void
+__irq_restore__(uint32_t primask)
+{
+#if defined(__arm__)
+  __asm__ volatile("MSR primask, %0" : : "r"(primask) : "memory");
+#else
+  (void)primask;
+  __asm__ volatile("" ::: "memory");
+#endif
+}
 
 // According to arm m7 architecture ref manual,
 // interrupt set enable and interrupt set clear are laid out in this manner:
@@ -0,0 +1,85 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef IRQ_LATENCY_H
+#define IRQ_LATENCY_H
+
+#include <stdint.h>
+
+/**
+ * @brief   Interrupt latency and jitter statistics, one table entry per NVIC priority
+ * @details A sample is the number of PIT ticks between the channel expiring and
+ *          the first instruction of its ISR: the PIT reloads LDVAL at expiry and
+ *          keeps counting down, so LDVAL - CVAL read on ISR entry is the latency.
+ *          Jitter is kept twice, as the RMS deviation of the latency and as a
+ *          histogram of the change between consecutive samples.
+ *
+ *          The hardware harness is tests/benchmarks_irq_latency.c, this part has
+ *          no register access so the mocktests drive it with a simulated PIT.
+ *
+ * @note    irq_latency_record() is meant for a single ISR, it takes no lock.
+ **/
+#define IRQ_LATENCY_LEVELS  16 // 4 priority bits on the i.MX RT1062, NVIC priority >> 4
+#define IRQ_LATENCY_BUCKETS 64 // 1 PIT tick wide, the last bucket also counts everything beyond
+
+typedef struct
+{
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint32_t last;
+  uint64_t sum;
+  uint64_t sum_sq;
+  uint32_t latency_hist[IRQ_LATENCY_BUCKETS];
+  uint32_t jitter_hist[IRQ_LATENCY_BUCKETS]; // |latency - previous latency|
+} irq_latency_stats_s;
+
+extern irq_latency_stats_s g_irq_latency[IRQ_LATENCY_LEVELS];
+
+/** @brief PIT ticks since expiry, from the LDVAL and CVAL read on ISR entry */
+static inline uint32_t
+irq_latency_from_cval(uint32_t ldval, uint32_t cval)
+{
+  return ldval - cval;
+}
+
+/** @brief Table entry of an NVIC priority (0x00..0xf0) */
+static inline irq_latency_stats_s*
+irq_latency_level(uint8_t nvic_priority)
+{
+  return &g_irq_latency[nvic_priority >> 0x4];
+}
+
+void irq_latency_init(irq_latency_stats_s* stats);
+
+/** @brief Clear every priority level */
+void irq_latency_init_all();
+
+/** @brief Add one sample in PIT ticks, ISR path, a handful of adds */
+static inline void
+irq_latency_record(irq_latency_stats_s* stats, uint32_t ticks)
+{
+  uint32_t step = (stats->count == 0) ? 0 : (ticks > stats->last) ? ticks - stats->last : stats->last - ticks;
+
+  stats->count++;
+  stats->sum    += ticks;
+  stats->sum_sq += (uint64_t)ticks * ticks;
+  stats->min     = (ticks < stats->min) ? ticks : stats->min;
+  stats->max     = (ticks > stats->max) ? ticks : stats->max;
+  stats->last    = ticks;
+  stats->latency_hist[(ticks < IRQ_LATENCY_BUCKETS) ? ticks : IRQ_LATENCY_BUCKETS - 1]++;
+  stats->jitter_hist[(step < IRQ_LATENCY_BUCKETS) ? step : IRQ_LATENCY_BUCKETS - 1]++;
+}
+
+/** @brief Mean latency in PIT ticks as Q24.8, 0 without samples */
+uint32_t irq_latency_mean_q8(const irq_latency_stats_s* stats);
+
+/** @brief RMS deviation of the latency in PIT ticks as Q24.8 */
+uint32_t irq_latency_jitter_q8(const irq_latency_stats_s* stats);
+
+/** @brief Smallest latency with at least 'permille' of the samples at or below it, from the histogram */
+uint32_t irq_latency_percentile(const irq_latency_stats_s* stats, uint32_t permille);
+
+#endif // IRQ_LATENCY_H
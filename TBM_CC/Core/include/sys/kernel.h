@@ -0,0 +1,154 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef KERNEL_H
+#define KERNEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "containers/intrusive_list.h"
+
+/**
+ * @brief   Preemptive fixed-priority kernel, PendSV context switch
+ * @details Threads have their own stack and priority (0 is the highest, as on
+ *          the NVIC). The highest priority ready thread always runs, threads of
+ *          equal priority are time sliced round robin on every tick. Choosing
+ *          the next thread is one CTZ on the ready bitmap plus the head of that
+ *          priority's queue, O(1) whatever the thread count.
+ *
+ *          The policy (ksched_*) is plain C, the same code runs in 'make
+ *          hosttest'. The port (kernel_*, kthread_create) builds the initial
+ *          stack frames, installs PendSV (lowest priority, does the switch) and
+ *          the tick (SysTick, or a PIT channel through pit_demux.h):
+ *
+ *          KERNEL_STACK(blink_stack, 256);
+ *          static kthread_s blink;
+ *          kernel_init();
+ *          kthread_create(&blink, &blink_main, NULL, 0x2, blink_stack, sizeof(blink_stack), "blink");
+ *          kernel_start(KERNEL_TICK_SYSTICK, 1000); // Does not return
+ *
+ *          PendSV saves r4-r11 and EXC_RETURN on the thread stack, and s16-s31
+ *          only for threads which used the FPU (EXC_RETURN bit 4 clear). The
+ *          caller-saved FPU registers are lazily stacked by the core (FPCCR
+ *          ASPEN | LSPEN), so threads without float code never pay for them.
+ *
+ * @note    .bss is in DTCM (see imxrt1062.ld), KERNEL_STACK places stacks
+ *          there. The idle thread takes the lowest priority and sleeps in WFI.
+ *          kthread_resume() may be called from an ISR, everything else only
+ *          from threads.
+ **/
+#define KERNEL_PRIORITIES        8 // Priority KERNEL_PRIORITIES - 1 is for the idle thread
+#define KERNEL_IDLE_PRIORITY     (KERNEL_PRIORITIES - 1)
+#define KERNEL_IDLE_STACK_WORDS  128
+#define KERNEL_MIN_STACK_BYTES   0x100
+#define KERNEL_CORE_HZ           600000000UL // SysTick runs on the core clock
+
+/** @brief Thread stack in .bss (DTCM), 8-byte aligned as AAPCS asks at every call */
+#define KERNEL_STACK(name, words) static uint64_t name[((words) + 1) >> 1] __attribute__((aligned(8)))
+
+typedef void (*kthread_fp)(void* arg);
+
+typedef enum
+{
+  KTHREAD_READY,     // In a ready queue, possibly running
+  KTHREAD_SLEEPING,  // Waiting for its wake tick
+  KTHREAD_SUSPENDED, // Waiting for kthread_resume()
+  KTHREAD_DEAD,      // Returned from its entry
+} kthread_state_e;
+
+typedef struct
+{
+  uint32_t*    sp;          // Saved stack pointer, first member, PendSV addresses it directly
+  ilist_node_s link;        // Ready queue or the sleep list
+  uint32_t     wake;        // Tick to leave KTHREAD_SLEEPING at
+  uint32_t     switches;    // Times switched in
+  uint64_t*    stack;
+  uint32_t     stack_bytes;
+  const char*  name;
+  uint8_t      priority;
+  uint8_t      state;       // kthread_state_e
+} kthread_s;
+
+typedef enum
+{
+  KERNEL_TICK_SYSTICK, // Core clock SysTick, exception 15
+  KERNEL_TICK_PIT,     // PIT channel 1 through the PIT demux, for SysTick-less debug setups
+} kernel_tick_e;
+
+/* Scheduling policy, hardware independent, callers hold a critical section (the port does) */
+
+/** @brief Reset the queues, 'idle' is made ready at KERNEL_IDLE_PRIORITY and must never block */
+void ksched_init(kthread_s* idle);
+
+/** @brief Make a new thread ready at the back of its priority */
+void ksched_add(kthread_s* thread);
+
+/** @brief Thread the last ksched_pick() chose, NULL before the first pick */
+kthread_s* ksched_current();
+
+/** @brief Highest priority ready thread, becomes current */
+kthread_s* ksched_pick();
+
+/** @brief 1 when ksched_pick() would choose another thread than the current one */
+uint8_t ksched_switch_pending();
+
+/** @brief Move the current thread behind its equal priority peers */
+void ksched_yield();
+
+/** @brief Take the current thread off the ready queues for 'ticks' ticks (at least 1) */
+void ksched_sleep(uint32_t ticks);
+
+/** @brief Take 'thread' off the ready or sleep queues until ksched_resume() */
+void ksched_suspend(kthread_s* thread);
+
+/** @brief Make a suspended or sleeping thread ready again, no-op otherwise */
+void ksched_resume(kthread_s* thread);
+
+/** @brief Retire the current thread */
+void ksched_exit();
+
+/**
+ * @brief   Advance one tick, wake due sleepers and rotate the current priority
+ * @return  1 if a switch is due (a woken thread outranks the current one, or a peer gets its slice)
+ **/
+uint8_t ksched_tick();
+
+uint32_t ksched_ticks();
+
+/* Port, Cortex-M7 */
+
+/** @brief Set up the scheduler and the idle thread, call before kthread_create() */
+void kernel_init();
+
+/**
+ * @brief   Build the initial frame of 'thread' on 'stack' and make it ready
+ * @param   stack       Bottom of the stack, 8-byte aligned (KERNEL_STACK)
+ * @param   stack_bytes At least KERNEL_MIN_STACK_BYTES
+ * @note    Returning from 'entry' retires the thread.
+ **/
+void kthread_create(kthread_s*  thread,
+                    kthread_fp  entry,
+                    void*       arg,
+                    uint8_t     priority,
+                    uint64_t*   stack,
+                    uint32_t    stack_bytes,
+                    const char* name);
+
+/** @brief Install PendSV and the tick, switch to the highest priority thread. Never returns */
+void kernel_start(kernel_tick_e source, uint32_t tick_hz) __attribute__((noreturn));
+
+/** @brief Give the CPU to the next ready thread of the same priority */
+void kernel_yield();
+
+/** @brief Block the calling thread for 'ticks' kernel ticks */
+void kernel_sleep(uint32_t ticks);
+
+void kthread_suspend(kthread_s* thread);
+
+/** @brief Make 'thread' ready again, ISR safe, preempts on return if it outranks the caller */
+void kthread_resume(kthread_s* thread);
+
+#endif // KERNEL_H
@@ -0,0 +1,116 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief   Scoped cycle probes with per-probe min/max/mean and a log2 histogram
+ * @details On target the time base is the DWT cycle counter (core cycles), on a
+ *          host build (no __arm__) it is CLOCK_MONOTONIC in ns, so the same
+ *          probes run in Linux benchmarks. PROF_SCOPE records from the point
+ *          it is declared to the end of the enclosing block:
+ *
+ *          prof_init();
+ *          void hwtick() { PROF_SCOPE("hwtick"); ... }
+ *          ...
+ *          prof_export(&dump_probe, NULL); // One call per probe, from thread context
+ *
+ *          A probe site looks its entry up by name once and caches it, after
+ *          that a scope costs two counter reads and one short critical section.
+ *          Sites sharing a name share an entry.
+ *
+ * @note    Probes compile to nothing unless TBM_PROFILE is defined ('make
+ *          PROFILE=1'). CYCCNT wraps every ~7s at 600MHz, longer scopes are
+ *          meaningless. Nested scopes include each other's overhead.
+ **/
+#define PROF_MAX_PROBES    32
+#define PROF_HIST_BUCKETS  32 // Bucket b counts samples in [2^b, 2^(b+1)), bucket 0 also counts 0
+
+#if defined(__arm__)
+  #define PROF_COUNTER_HZ 600000000UL // Core clock, CYCCNT
+#else
+  #define PROF_COUNTER_HZ 1000000000UL // CLOCK_MONOTONIC ns
+#endif
+
+typedef struct
+{
+  const char* name;
+  uint32_t    count;
+  uint32_t    min;
+  uint32_t    max;
+  uint64_t    total;
+  uint32_t    hist[PROF_HIST_BUCKETS];
+} prof_probe_s;
+
+typedef struct
+{
+  prof_probe_s* probe;
+  uint32_t      start;
+} prof_scope_s;
+
+/** @brief Called once per probe by prof_export(), 'snapshot' is a consistent copy */
+typedef void (*prof_export_fp)(const prof_probe_s* snapshot, uint32_t mean, void* ctx);
+
+/** @brief Start the time base (DWT on target) and clear the statistics, probes may register before this */
+void prof_init();
+
+/** @brief Clear the statistics, keeps the registered names */
+void prof_reset();
+
+/** @brief Current counter value, core cycles on target, ns on a host */
+uint32_t prof_now();
+
+/**
+ * @brief   Entry for 'name', registered on first use
+ * @return  NULL once PROF_MAX_PROBES names are taken, the scope is then not recorded
+ **/
+prof_probe_s* prof_probe(const char* name);
+
+/** @brief Add one sample of 'ticks' counter ticks, callable from any ISR */
+void prof_record(prof_probe_s* probe, uint32_t ticks);
+
+/** @brief Mean sample in counter ticks, rounded down, 0 without samples */
+uint32_t prof_mean(const prof_probe_s* probe);
+
+/** @brief Number of registered probes */
+uint32_t prof_probe_count();
+
+/** @brief Hand a snapshot of every probe with samples to 'fp', in registration order */
+void prof_export(prof_export_fp fp, void* ctx);
+
+/** @brief Used by PROF_SCOPE, resolves the cached site entry and takes the start stamp */
+static inline prof_scope_s
+prof_scope_begin(prof_probe_s** site, const char* name)
+{
+  if (*site == NULL) { *site = prof_probe(name); }
+  prof_scope_s scope = {*site, prof_now()};
+  return scope;
+}
+
+/** @brief Used by PROF_SCOPE, runs when the scope variable leaves its block */
+static inline void
+prof_scope_end(prof_scope_s* scope)
+{
+  uint32_t ticks = prof_now() - scope->start;
+  if (scope->probe != NULL) { prof_record(scope->probe, ticks); }
+}
+
+#define __PROF_CAT2__(a, b) a##b
+#define __PROF_CAT__(a, b)  __PROF_CAT2__(a, b)
+
+#if defined(TBM_PROFILE)
+  #define PROF_SCOPE(name)                                                                  \
+    static prof_probe_s* __PROF_CAT__(__prof_site_, __LINE__) = NULL;                       \
+    prof_scope_s __PROF_CAT__(__prof_scope_, __LINE__) __attribute__((cleanup(prof_scope_end))) \
+      = prof_scope_begin(&__PROF_CAT__(__prof_site_, __LINE__), (name))
+#else
+  #define PROF_SCOPE(name) do {} while (0)
+#endif
+
+#endif // PROFILER_H
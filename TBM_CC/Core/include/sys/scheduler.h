@@ -0,0 +1,94 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+
+#include "containers/intrusive_list.h"
+#include "devices/soft_timer.h"
+#include "typedefs/ttimer_mgr.h"
+
+/**
+ * @brief   Cooperative run-to-completion scheduler for the main loop
+ * @details Tasks are caller-owned and run from thread context, one at a time,
+ *          highest priority first (0 is the highest, as on the NVIC) and FIFO
+ *          within a priority. A task runs once per post, posting an already
+ *          queued task is a no-op, so a burst of interrupts costs one run.
+ *
+ *          ISRs post onto per-priority 'posted' queues. The loop moves them to
+ *          the ready queues in one batch (one critical section, one O(1)
+ *          splice per priority), the ready queues themselves are only touched
+ *          from thread context. Delayed and periodic posts ride on the soft
+ *          timer wheel (soft_timer.h), i.e. on the PIT tick. With nothing ready
+ *          the core sleeps in WFI until the next interrupt:
+ *
+ *          static sched_task_s blink;
+ *          sched_init();
+ *          sched_task_init(&blink, &blink_cb, &led, 0x3);
+ *          sched_post_periodic(&blink, generate_time_struct(PIT_SPEED_200MHz, MILLIS_E, 500));
+ *          sched_run(&pit_timer->keep_ticking);
+ *
+ * @note    Tasks must not block, a long task delays every other one. Priorities
+ *          only order the queue, a running task is never preempted by a task.
+ **/
+#define SCHED_PRIORITIES 8
+
+typedef void (*sched_task_fp)(void* ctx);
+
+typedef struct
+{
+  ilist_node_s  link;     // Posted or ready queue, self when not queued
+  soft_timer_s  timer;    // Delayed and periodic posts
+  sched_task_fp run;
+  void*         ctx;
+  uint32_t      runs;
+  uint8_t       priority;
+} sched_task_s;
+
+typedef struct
+{
+  uint32_t runs;    // Tasks run
+  uint32_t batches; // Non-empty moves from the posted to the ready queues
+  uint32_t sleeps;  // WFI entries of sched_run()
+} sched_stats_s;
+
+/** @brief Reset the queues and statistics, queued tasks are dropped (their timers keep running) */
+void sched_init();
+
+/** @brief Set up 'task' to call run(ctx), 'priority' is clamped to SCHED_PRIORITIES - 1 */
+void sched_task_init(sched_task_s* task, sched_task_fp run, void* ctx, uint8_t priority);
+
+/** @brief Queue 'task' once, from any context. A task may post itself while it runs */
+void sched_post(sched_task_s* task);
+
+/** @brief Post 'task' once after 'delay', rounded up to whole wheel ticks */
+void sched_post_delayed(sched_task_s* task, timer_datum_s delay);
+
+/** @brief Post 'task' once after 'ticks' raw wheel ticks, 0 is treated as 1 */
+void sched_post_ticks(sched_task_s* task, uint32_t ticks);
+
+/** @brief Post 'task' every 'period' until sched_cancel() */
+void sched_post_periodic(sched_task_s* task, timer_datum_s period);
+
+/** @brief Stop the timer of 'task' and take it off its queue, it may still be running */
+void sched_cancel(sched_task_s* task);
+
+/** @brief 1 while 'task' waits in a queue */
+uint8_t sched_task_queued(const sched_task_s* task);
+
+/**
+ * @brief   Move the posted batch over and run the highest priority ready task
+ * @return  1 if a task ran, 0 if nothing was ready
+ **/
+uint8_t sched_run_once();
+
+/** @brief Run tasks until '*keep_running' drops, sleeps in WFI whenever nothing is ready */
+void sched_run(const volatile uint8_t* keep_running);
+
+const sched_stats_s* sched_stats();
+
+#endif // SCHEDULER_H
@@ -8,6 +8,8 @@
 
 #include <stdint.h>
 
+#include "sys/irq_dispatch.h"
+
 /// GENERIC
 
 typedef enum
@@ -56,6 +58,19 @@ typedef enum
   NANOS_E   // nano-seconds,  10E-9
 } timetype_e;
 
+/**
+ * @brief   Fixed-point time for delta-times and unit conversions
+ * @details time_ns64_t is whole nano-seconds, every timetype_e unit is an exact
+ *          multiple of it and 64 bits do not wrap for ~584 years. time_q32_t is
+ *          seconds as Q32.32 (upper word seconds, lower word 1/2^32 fractions)
+ *          for code which scales by seconds. See utils/utimer_mgr.h.
+ **/
+typedef uint64_t time_ns64_t;
+typedef uint64_t time_q32_t;
+
+#define TIME_NS64_PER_S  1000000000ULL
+#define TIME_Q32_ONE     (1ULL << 0x20)
+
 typedef enum
 {
   FROMTIME_E,
@@ -81,6 +96,23 @@ typedef enum
   PIT_SPEED_200MHz = 0x3
 } pit_speed_e; // Speed Field
 
+/** @brief PIT_SPEED_50MHz..PIT_SPEED_200MHz -> 50..200 (MHz), i.e. ticks per micro-second */
+#define PIT_SPEED_MHZ(speed) (50UL * ((uint32_t)(speed) + 1UL))
+
+/**
+ * @brief   Ticks per time unit at one PIT speed, ticks = (value * mult) >> shift
+ * @details shift is 0 for whole ticks per unit (exact) and 32 for units shorter
+ *          than a tick (Q32 multiplier), max_val is the largest value whose
+ *          ticks fit 32 bits. den is the unit divisor used for the way back.
+ **/
+typedef struct
+{
+  uint64_t mult;
+  uint32_t max_val;
+  uint16_t den;
+  uint8_t  shift;
+} time_tick_scale_s;
+
 
 typedef struct 
 {
@@ -96,7 +128,7 @@ typedef struct
 } timer_datum_s;
 
 typedef void (*timer_manager_cb)(void);
-typedef void (*timer_manager_sick_cb)(float);
+typedef void (*timer_manager_sick_cb)(time_ns64_t delta_ns);
 
 typedef enum
 {
@@ -123,6 +155,7 @@ typedef struct
   clk_src_e              clk_src;
   timetype_e             time_type;
   uint8_t                keep_ticking;
+  irq_slot_s             irq_slot; // Its share of the IRQ line, see sys/irq_dispatch.h
 } timer_manager_s;
 
 
@@ -244,10 +277,4 @@ typedef struct
   pit_speed_e freq;
 } pit_context_s;
 
-typedef union
-{
-  int32_t AsInt32;
-  float AsFloat;
-} punned_float_u;
-
 #endif // T_TIMER_MGR_H
@@ -25,62 +25,6 @@
 uint32_t
 __time_clamp_24MHz__(uint32_t intime, timetype_e timetype);
 
-/**
- * @brief   Clamps values to fit 50MHz timer counter
- * @details Clamps values if they exceed max limit of the count cycle
- *          registers 50mhz cycles. Clamps them using arithmetic logic,
- *          instead of control-blocks
- *
- * @returns Either return a clamped value, or return the inputted value.
- *
- * @note    magic numbers calculated by:
- *          max_cycles_for_unit = max_register_value / cycle_rate_per_unit
- **/
-uint32_t
-__time_clamp_50MHz__(uint32_t intime, timetype_e timetype);
-
-/**
- * @brief   Clamps values to fit 100MHz timer counter
- * @details Clamps values if they exceed max limit of the count cycle
- *          registers 100mhz cycles. Clamps them using arithmetic logic,
- *          instead of control-blocks
- *
- * @returns Either return a clamped value, or return the inputted value.
- *
- * @note    magic numbers calculated by:
- *          max_cycles_for_unit = max_register_value / cycle_rate_per_unit
- **/
-uint32_t
-__time_clamp_100MHz__(uint32_t intime, timetype_e timetype);
-
-/**
- * @brief   Clamps values to fit 150MHz timer counter
- * @details Clamps values if they exceed max limit of the count cycle
- *          registers 150mhz cycles. Clamps them using arithmetic logic,
- *          instead of control-blocks
- *
- * @returns Either return a clamped value, or return the inputted value.
- *
- * @note    magic numbers calculated by:
- *          max_cycles_for_unit = max_register_value / cycle_rate_per_unit
- **/
-uint32_t
-__time_clamp_150MHz__(uint32_t intime, timetype_e timetype);
-
-/**
- * @brief   Clamps values to fit 200MHz timer counter
- * @details Clamps values if they exceed max limit of the count cycle
- *          registers 200mhz cycles. Clamps them using arithmetic logic,
- *          instead of control-blocks.
- *
- * @returns uint32_t - A clamped value or the inputted value.
- *
- * @note    magic numbers calculated by:
- *          max_cycles_for_unit = max_register_value / cycle_rate_per_unit
- **/
-uint32_t
-__time_clamp_200MHz__(uint32_t intime, timetype_e timetype);
-
 /**
  * @brief   Resolve time for 24MHz clocks
  * @details Resolve time the proper ldvalue based on the
@@ -96,59 +40,59 @@ uint32_t
 __resolve_time_24MHz__(uint32_t targetval, timetype_e timetype, ttconversiondir_e conversiondir);
 
 /**
- * @brief   Resolve time for 50MHz clocks
- * @details Resolve time the proper ldvalue based on the
- *          time-type of the timer manager.
- * 
- * @param   targetval     Value to resolve
- * @param   timetype      Selector that informs us 
- * @param   conversiondir To time from tick, or to ticks from time 
- * @return  uint32_t      Resolved time (to:50MHz)
- * 
- */
+ * @brief   Time to PIT ticks at runtime, one table lookup and one 64-bit multiply-shift
+ * @details Values which do not fit a 32-bit load value are clamped to the largest
+ *          one that does (same as the old TIMECLAMP macros). Units of a micro-second
+ *          and up are exact, sub micro-second units are at most one tick short.
+ *          Use the TICKS_* macros in macros/mtimer_mgr.h for literal arguments.
+ *
+ * @param   freq     PIT speed
+ * @param   timetype Unit of 'value'
+ * @param   value    Time in 'timetype' units
+ * @return  uint32_t PIT ticks
+ **/
 uint32_t
-__resolve_time_50MHz__(uint32_t targetval, timetype_e timetype, ttconversiondir_e conversiondir);
+time_to_ticks(pit_speed_e freq, timetype_e timetype, uint32_t value);
 
 /**
- * @brief   Resolve time for 100MHz clocks
- * @details Resolve time the proper ldvalue based on the
- *          time-type of the timer manager.
- * 
- * @param   targetval     Value to resolve
- * @param   timetype      Selector that informs us 
- * @param   conversiondir To time from tick, or to ticks from time 
- * @return  uint32_t      Resolved time (to:100MHz)
- * 
- */
+ * @brief   PIT ticks back to time, rounded down, only 32-bit divisions
+ * @return  uint32_t Time in 'timetype' units, clamped to 0xffffffff
+ **/
 uint32_t
-__resolve_time_100MHz__(uint32_t targetval, timetype_e timetype, ttconversiondir_e conversiondir);
+ticks_to_time(pit_speed_e freq, timetype_e timetype, uint32_t ticks);
 
 /**
- * @brief   Resolve time for 150MHz clocks
- * @details Resolve time the proper ldvalue based on the
- *          time-type of the timer manager.
- * 
- * @param   targetval     Value to resolve
- * @param   timetype      Selector that informs us 
- * @param   conversiondir To time from tick, or to ticks from time 
- * @return  uint32_t      Resolved time (to:150MHz)
- * 
- */
+ * @brief   64 by 32-bit restoring division, 'remainder' may be NULL
+ * @details The firmware links without libgcc, so there is no __aeabi_uldivmod.
+ *          ~64 iterations, keep it off the hot paths (setup, statistics, printing).
+ **/
+uint64_t
+time_udiv64_32(uint64_t dividend, uint32_t divisor, uint32_t* remainder);
+
+/** @brief floor(sqrt(value)) bit by bit, for jitter statistics, shifts and adds only */
 uint32_t
-__resolve_time_150MHz__(uint32_t targetval, timetype_e timetype, ttconversiondir_e conversiondir);
+time_isqrt64(uint64_t value);
 
 /**
- * @brief   Resolve time for 200MHz clocks
- * @details Resolve time the proper ldvalue based on the
- *          time-type of the timer manager.
- * 
- * @param   targetval     Value to resolve
- * @param   timetype      Selector that informs us 
- * @param   conversiondir To time from tick, or to ticks from time 
- * @return  uint32_t      Resolved time (to:200MHz)
- * 
- */
+ * @brief   Time in 'timetype' units to nano-seconds, exact for every unit
+ * @note    Saturates at 0xffffffffffffffff (~584 years), only reachable with days, hours or minutes
+ **/
+time_ns64_t
+time_to_ns64(timetype_e timetype, uint32_t value);
+
+/**
+ * @brief   Nano-seconds to whole 'timetype' units, rounded down
+ * @return  uint32_t Clamped to 0xffffffff
+ **/
 uint32_t
-__resolve_time_200MHz__(uint32_t targetval, timetype_e timetype, ttconversiondir_e conversiondir);
+time_from_ns64(timetype_e timetype, time_ns64_t ns);
+
+/** @brief Nano-seconds to Q32.32 seconds, rounded down */
+time_q32_t
+time_ns64_to_q32(time_ns64_t ns);
+
+/** @brief Q32.32 seconds to nano-seconds, rounded down */
+time_ns64_t
+time_q32_to_ns64(time_q32_t seconds);
 
 #endif // UTIMER_MGR_H
\ No newline at end of file
@@ -0,0 +1,106 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "min_heap.h"
+
+static inline void
+__mheap_place__(mheap_s* heap, mheap_node_s* node, uint32_t idx)
+{
+  heap->nodes[idx] = node;
+  node->slot       = idx + 1;
+}
+
+/** @brief Move the node at 'idx' towards the root, holes instead of swaps */
+static void
+__mheap_sift_up__(mheap_s* heap, uint32_t idx)
+{
+  mheap_node_s* node = heap->nodes[idx];
+  while (idx > 0)
+  {
+    uint32_t      parent_idx = (idx - 1) >> 0x1;
+    mheap_node_s* parent     = heap->nodes[parent_idx];
+    if (parent->key <= node->key) { break; }
+
+    __mheap_place__(heap, parent, idx);
+    idx = parent_idx;
+  }
+  __mheap_place__(heap, node, idx);
+}
+
+/** @brief Move the node at 'idx' towards the leaves */
+static void
+__mheap_sift_down__(mheap_s* heap, uint32_t idx)
+{
+  mheap_node_s* node = heap->nodes[idx];
+  for (;;)
+  {
+    uint32_t child_idx = (idx << 0x1) + 1;
+    if (child_idx >= heap->size) { break; }
+
+    // Pick the smaller of the two children
+    if (child_idx + 1 < heap->size && heap->nodes[child_idx + 1]->key < heap->nodes[child_idx]->key)
+    {
+      child_idx++;
+    }
+    if (node->key <= heap->nodes[child_idx]->key) { break; }
+
+    __mheap_place__(heap, heap->nodes[child_idx], idx);
+    idx = child_idx;
+  }
+  __mheap_place__(heap, node, idx);
+}
+
+void
+mheap_init(mheap_s* heap, mheap_node_s** storage, uint32_t capacity)
+{
+  heap->nodes    = storage;
+  heap->size     = 0;
+  heap->capacity = capacity;
+}
+
+uint8_t
+mheap_push(mheap_s* heap, mheap_node_s* node)
+{
+  if (heap->size >= heap->capacity) { return 0; }
+
+  __mheap_place__(heap, node, heap->size++);
+  __mheap_sift_up__(heap, heap->size - 1);
+  return 1;
+}
+
+mheap_node_s*
+mheap_pop(mheap_s* heap)
+{
+  mheap_node_s* root = mheap_peek(heap);
+  if (root != NULL) { mheap_remove(heap, root); }
+  return root;
+}
+
+void
+mheap_remove(mheap_s* heap, mheap_node_s* node)
+{
+  if (!mheap_queued(node)) { return; }
+
+  uint32_t      idx  = node->slot - 1;
+  mheap_node_s* last = heap->nodes[--heap->size];
+  node->slot         = 0;
+  if (last == node) { return; }
+
+  // Fill the hole with the last leaf, which may need to go either way
+  __mheap_place__(heap, last, idx);
+  if (idx > 0 && heap->nodes[(idx - 1) >> 0x1]->key > last->key) { __mheap_sift_up__(heap, idx); }
+  else { __mheap_sift_down__(heap, idx); }
+}
+
+void
+mheap_update(mheap_s* heap, mheap_node_s* node, uint64_t key)
+{
+  uint64_t old_key = node->key;
+  node->key        = key;
+  if (!mheap_queued(node)) { return; }
+
+  if (key < old_key) { __mheap_sift_up__(heap, node->slot - 1); }
+  else { __mheap_sift_down__(heap, node->slot - 1); }
+}
@@ -0,0 +1,179 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "clock_discipline.h"
+#include "utils/utimer_mgr.h"
+#include "sys/irq_handler.h"
+
+#include <stddef.h>
+
+/** @brief Loop gains as right shifts, Kp = 2^-kp_shift, Ki = 2^-ki_shift */
+#define DISCIPLINE_ACQUIRE_KP 0x1
+#define DISCIPLINE_ACQUIRE_KI 0x4
+#define DISCIPLINE_TRACK_KP   0x2
+#define DISCIPLINE_TRACK_KI   0x6
+
+typedef struct
+{
+  uint32_t    nominal_hz;
+  uint32_t    last_stamp;
+  int64_t     freq;       // Counter ticks per true second, Q32.32
+  int64_t     phase;      // Predicted minus actual edge, counter ticks Q32.32
+  int64_t     steer;      // Phase correction applied over the next second, Q32.32
+  int64_t     rate_q32;   // (freq - nominal) / nominal, Q32 fraction
+  int64_t     adjust_q32; // nominal / freq - 1, Q32 fraction
+  time_ns64_t anchor_raw;
+  time_ns64_t anchor_corrected;
+  uint32_t    rejected;
+  uint8_t     locked_edges;
+  uint8_t     kp_shift;
+  uint8_t     ki_shift;
+  uint8_t     primed;
+} discipline_s;
+
+static discipline_s g_discipline;
+
+/** @brief (value * q32) >> 32 for signed values, split so nothing overflows 64 bits */
+static int64_t
+__discipline_mul_q32__(uint64_t value, int64_t q32)
+{
+  uint64_t magnitude = (q32 < 0) ? (uint64_t)(-q32) : (uint64_t)q32;
+  uint64_t product   = (value >> 0x20) * magnitude + (((value & 0xffffffff) * magnitude) >> 0x20);
+  return (q32 < 0) ? -(int64_t)product : (int64_t)product;
+}
+
+void
+discipline_init(uint32_t nominal_hz)
+{
+  uint32_t primask = __irq_save__();
+
+  g_discipline.nominal_hz       = nominal_hz;
+  g_discipline.last_stamp       = 0;
+  g_discipline.freq             = (int64_t)nominal_hz << 0x20;
+  g_discipline.phase            = 0;
+  g_discipline.steer            = 0;
+  g_discipline.rate_q32         = 0;
+  g_discipline.adjust_q32       = 0;
+  g_discipline.anchor_raw       = 0;
+  g_discipline.anchor_corrected = 0;
+  g_discipline.rejected         = 0;
+  g_discipline.locked_edges     = 0;
+  g_discipline.kp_shift         = DISCIPLINE_ACQUIRE_KP;
+  g_discipline.ki_shift         = DISCIPLINE_ACQUIRE_KI;
+  g_discipline.primed           = 0;
+
+  __irq_restore__(primask);
+}
+
+/** @brief Recompute the rate terms from 'freq', divisions only happen here, once per PPS */
+static void
+__discipline_update_rate__(discipline_s* disc)
+{
+  int64_t  diff     = disc->freq - ((int64_t)disc->nominal_hz << 0x20);
+  uint64_t abs_diff = (diff < 0) ? (uint64_t)(-diff) : (uint64_t)diff;
+
+  // e = diff / nominal as a Q32 fraction, then nominal / freq - 1 = -e / (1 + e) ~ -e + e^2
+  int64_t rate   = (int64_t)time_udiv64_32(abs_diff, disc->nominal_hz, NULL);
+  rate           = (diff < 0) ? -rate : rate;
+  int64_t rate_sq = (rate * rate) >> 0x20;
+
+  disc->rate_q32   = rate;
+  disc->adjust_q32 = -rate + rate_sq;
+}
+
+discipline_result_e
+discipline_pps(uint32_t stamp, time_ns64_t raw_now_ns)
+{
+  discipline_s* disc = &g_discipline;
+
+  if (!disc->primed)
+  {
+    disc->primed           = 1;
+    disc->last_stamp       = stamp;
+    disc->anchor_raw       = raw_now_ns;
+    disc->anchor_corrected = raw_now_ns;
+    return DISCIPLINE_PRIMED;
+  }
+
+  uint32_t interval = stamp - disc->last_stamp; // Modulo 2^32
+  disc->last_stamp  = stamp;
+
+  uint32_t max_dev = (uint32_t)(((uint64_t)disc->nominal_hz * DISCIPLINE_MAX_PPM) >> 0x14); // ~ppm / 10^6
+  uint32_t dev     = (interval > disc->nominal_hz) ? interval - disc->nominal_hz : disc->nominal_hz - interval;
+  if (dev > max_dev)
+  {
+    disc->rejected++; // A single glitch does not widen the loop again
+    return DISCIPLINE_REJECTED;
+  }
+
+  // Type-2 loop: phase error of the predicted second, integral into freq, proportional into steer
+  int64_t phase = disc->phase + disc->freq + disc->steer - ((int64_t)interval << 0x20);
+  disc->freq   -= phase >> disc->ki_shift;
+  disc->steer   = -(phase >> disc->kp_shift);
+  disc->phase   = phase;
+
+  int64_t abs_phase = (phase < 0) ? -phase : phase;
+  if (abs_phase < ((int64_t)DISCIPLINE_LOCK_TICKS << 0x20))
+  {
+    if (disc->locked_edges < DISCIPLINE_LOCK_EDGES) { disc->locked_edges++; }
+  }
+  else
+  {
+    disc->locked_edges = 0;
+  }
+
+  uint8_t locked = (disc->locked_edges >= DISCIPLINE_LOCK_EDGES);
+  disc->kp_shift = locked ? DISCIPLINE_TRACK_KP : DISCIPLINE_ACQUIRE_KP;
+  disc->ki_shift = locked ? DISCIPLINE_TRACK_KI : DISCIPLINE_ACQUIRE_KI;
+
+  // Re-anchor with the old rate first so the corrected clock does not jump
+  uint32_t primask       = __irq_save__();
+  disc->anchor_corrected = discipline_correct_ns(raw_now_ns);
+  disc->anchor_raw       = raw_now_ns;
+  __discipline_update_rate__(disc);
+  __irq_restore__(primask);
+
+  return DISCIPLINE_TRACKING;
+}
+
+uint8_t
+discipline_locked()
+{
+  return g_discipline.locked_edges >= DISCIPLINE_LOCK_EDGES;
+}
+
+int32_t
+discipline_ppb()
+{
+  // rate (Q32) * 10^9 >> 32, 10^9 < 2^30 and |rate| < 2^23 at DISCIPLINE_MAX_PPM
+  return (int32_t)((g_discipline.rate_q32 * 1000000000LL) >> 0x20);
+}
+
+uint32_t
+discipline_freq_hz()
+{
+  return (uint32_t)(g_discipline.freq >> 0x20);
+}
+
+uint32_t
+discipline_rejected()
+{
+  return g_discipline.rejected;
+}
+
+time_ns64_t
+discipline_correct_ns(time_ns64_t raw_ns)
+{
+  time_ns64_t delta = raw_ns - g_discipline.anchor_raw;
+  return g_discipline.anchor_corrected + delta + __discipline_mul_q32__(delta, g_discipline.adjust_q32);
+}
+
+uint32_t
+discipline_compensate_ticks(uint32_t nominal_ticks)
+{
+  int64_t ticks = (int64_t)nominal_ticks + __discipline_mul_q32__(nominal_ticks, g_discipline.rate_q32);
+  if (ticks < 1) { return 1; }
+  return (ticks > 0xffffffff) ? 0xffffffff : (uint32_t)ticks;
+}
@@ -0,0 +1,99 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "edma.h"
+#include "sys/irq_handler.h"
+#include "sys/memory_map.h"
+#include "typedefs/ttimer_mgr.h"
+
+#include <stddef.h>
+
+void
+edma_channel_init(edma_channel_s* chan, volatile edma_regs_s* regs, volatile edma_tcd_s* tcd, uint8_t ch)
+{
+  chan->regs = regs;
+  chan->tcd  = tcd;
+  chan->done = NULL;
+  chan->ctx  = NULL;
+  chan->ch   = ch;
+  chan->busy = 0;
+}
+
+#if defined(__arm__)
+static void
+__edma_isr__(void* ctx)
+{
+  edma_service((edma_channel_s*)ctx);
+  __asm__ volatile("dsb");
+}
+#endif
+
+/** @brief Hardware setup, host builds (make hosttest) bind fake blocks with edma_channel_init() instead */
+void
+edma_enable(edma_channel_s* chan, uint8_t ch, uint8_t source, uint8_t nvic_priority)
+{
+  if (chan == NULL || ch >= EDMA_CHANNELS) { return; }
+#if defined(__arm__)
+  CCM_C_CGR5 |= (uint32_t)CLK_ON__NO_STOP << 0x6; // CG3, DMA
+
+  edma_channel_init(chan, EDMA_REGS, EDMA_TCD(ch), ch);
+  chan->regs->CERQ    = ch;
+  *EDMA_MUX_CHCFG(ch) = 0;
+  *EDMA_MUX_CHCFG(ch) = EDMA_MUX_ENBL | source;
+  chan->regs->SEEI    = ch;
+
+  irq_num_e lines[2] = {(irq_num_e)(IRQ_DMA_CH0_TX + (ch & 0xf)), IRQ_DMA_ERROR};
+  uint8_t   line;
+  for (line = 0; line < 2; line++)
+  {
+    irq_attach(&chan->slots[line], lines[line], &__edma_isr__, chan);
+    NVIC_SET_PRIORITY(lines[line], nvic_priority);
+    NVIC_ENABLE_IRQ(lines[line]);
+  }
+#else
+  (void)source;
+  (void)nvic_priority;
+#endif
+}
+
+uint8_t
+edma_start(edma_channel_s* chan, edma_done_fp done, void* ctx)
+{
+  if (chan->busy) { return 0; }
+
+  chan->done       = done;
+  chan->ctx        = ctx;
+  chan->busy       = 1;
+  chan->regs->CDNE = chan->ch;
+  __asm__ volatile("" : : : "memory"); // Callback visible to the ISR before the first request
+  chan->regs->SERQ = chan->ch;
+  return 1;
+}
+
+void
+edma_stop(edma_channel_s* chan)
+{
+  chan->regs->CERQ = chan->ch;
+  chan->busy       = 0;
+}
+
+void
+edma_service(edma_channel_s* chan)
+{
+  uint32_t bit   = 0x1UL << chan->ch;
+  uint8_t  error = (chan->regs->ERR & bit) != 0;
+  if (!error && !(chan->regs->INT & bit)) { return; } // Another channel on the line
+
+  if (error)
+  {
+    chan->regs->CERQ = chan->ch;
+    chan->regs->CERR = chan->ch;
+  }
+  chan->regs->CINT = chan->ch;
+
+  if (!chan->busy) { return; }
+  chan->busy = 0;
+  if (chan->done != NULL) { chan->done(chan->ctx, error); }
+}
@@ -0,0 +1,274 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "flexio.h"
+#include "sys/memory_map.h"
+#include "typedefs/ttimer_mgr.h"
+
+#include <stddef.h>
+
+/** @brief Baud divider for a shift clock of at most 'baud', half periods of div + 1 FlexIO clocks */
+static uint32_t
+__flexio_divider__(uint32_t flexio_hz, uint32_t baud)
+{
+  if (baud == 0) { return 0xff; }
+  uint32_t half = (flexio_hz + 2 * baud - 1) / (2 * baud);
+  if (half == 0) { return 0; }
+  return (half > 0x100) ? 0xff : half - 1;
+}
+
+static void
+__flexio_lane__(flexio_program_s* prog, uint8_t shifter, uint8_t timer, uint32_t flexio_hz, uint32_t div)
+{
+  prog->shifter = shifter;
+  prog->timer   = timer;
+  prog->hz      = flexio_hz / (2 * (div + 1));
+}
+
+void
+flexio_program_spi(flexio_program_s* prog,
+                   uint8_t           shifter,
+                   uint8_t           timer,
+                   uint8_t           mosi_pin,
+                   uint8_t           sck_pin,
+                   uint32_t          flexio_hz,
+                   uint32_t          baud)
+{
+  uint32_t div = __flexio_divider__(flexio_hz, baud);
+  __flexio_lane__(prog, shifter, timer, flexio_hz, div);
+
+  // Data out on the falling SCK edge, valid before the first rising one (CPHA 0)
+  prog->shiftctl = FLEXIO_SHIFTCTL_TIMSEL(timer) | FLEXIO_SHIFTCTL_TIMPOL_NEG |
+                   FLEXIO_SHIFTCTL_PINCFG(FLEXIO_PINCFG_OUTPUT) | FLEXIO_SHIFTCTL_PINSEL(mosi_pin) |
+                   FLEXIO_SHIFTCTL_SMOD_TX;
+  prog->shiftcfg = 0;
+  prog->timctl   = FLEXIO_TIMCTL_TRGSEL(FLEXIO_TRIGGER_SHIFTER(shifter)) | FLEXIO_TIMCTL_TRGPOL_LOW |
+                 FLEXIO_TIMCTL_TRGSRC_INT | FLEXIO_TIMCTL_PINCFG(FLEXIO_PINCFG_OUTPUT) |
+                 FLEXIO_TIMCTL_PINSEL(sck_pin) | FLEXIO_TIMCTL_TIMOD_BAUD;
+  prog->timcfg = FLEXIO_TIMCFG_TIMOUT_ZERO | FLEXIO_TIMCFG_TIMDIS_CMP | FLEXIO_TIMCFG_TIMENA_TRG |
+                 FLEXIO_TIMCFG_TSTOP_DIS | FLEXIO_TIMCFG_TSTART;
+  prog->timcmp = FLEXIO_TIMCMP_BAUD(8, div);
+  prog->unit   = 1;
+  prog->buf    = FLEXIO_BUF_BIS;
+}
+
+void
+flexio_program_8080(flexio_program_s* prog,
+                    uint8_t           shifter,
+                    uint8_t           timer,
+                    uint8_t           d0_pin,
+                    uint8_t           wr_pin,
+                    uint32_t          flexio_hz,
+                    uint32_t          strobe_hz)
+{
+  uint32_t div = __flexio_divider__(flexio_hz, strobe_hz);
+  __flexio_lane__(prog, shifter, timer, flexio_hz, div);
+
+  // Timer output rises with WR falling (inverted pin), the shifter moves on that edge
+  prog->shiftctl = FLEXIO_SHIFTCTL_TIMSEL(timer) | FLEXIO_SHIFTCTL_PINCFG(FLEXIO_PINCFG_OUTPUT) |
+                   FLEXIO_SHIFTCTL_PINSEL(d0_pin) | FLEXIO_SHIFTCTL_SMOD_TX;
+  prog->shiftcfg = FLEXIO_SHIFTCFG_PWIDTH(7) | FLEXIO_SHIFTCFG_LOAD_SHIFT;
+  prog->timctl   = FLEXIO_TIMCTL_TRGSEL(FLEXIO_TRIGGER_SHIFTER(shifter)) | FLEXIO_TIMCTL_TRGPOL_LOW |
+                 FLEXIO_TIMCTL_TRGSRC_INT | FLEXIO_TIMCTL_PINCFG(FLEXIO_PINCFG_OUTPUT) |
+                 FLEXIO_TIMCTL_PINSEL(wr_pin) | FLEXIO_TIMCTL_PINPOL_LOW | FLEXIO_TIMCTL_TIMOD_BAUD;
+  prog->timcfg = FLEXIO_TIMCFG_TIMOUT_ZERO | FLEXIO_TIMCFG_TIMDIS_CMP | FLEXIO_TIMCFG_TIMENA_TRG;
+  prog->timcmp = FLEXIO_TIMCMP_BAUD(4, div); // Four bytes per 32-bit buffer
+  prog->unit   = 4;
+  prog->buf    = FLEXIO_BUF;
+}
+
+void
+flexio_program_ws2812(flexio_program_s* prog,
+                      uint8_t           shifter,
+                      uint8_t           timer,
+                      uint8_t           data_pin,
+                      uint32_t          flexio_hz)
+{
+  uint32_t div = __flexio_divider__(flexio_hz, FLEXIO_WS2812_HZ);
+  __flexio_lane__(prog, shifter, timer, flexio_hz, div);
+
+  // No clock pin, the timer only paces the shifter. No start/stop bits so words follow back to back
+  prog->shiftctl = FLEXIO_SHIFTCTL_TIMSEL(timer) | FLEXIO_SHIFTCTL_PINCFG(FLEXIO_PINCFG_OUTPUT) |
+                   FLEXIO_SHIFTCTL_PINSEL(data_pin) | FLEXIO_SHIFTCTL_SMOD_TX;
+  prog->shiftcfg = FLEXIO_SHIFTCFG_LOAD_SHIFT;
+  prog->timctl   = FLEXIO_TIMCTL_TRGSEL(FLEXIO_TRIGGER_SHIFTER(shifter)) | FLEXIO_TIMCTL_TRGPOL_LOW |
+                 FLEXIO_TIMCTL_TRGSRC_INT | FLEXIO_TIMCTL_PINCFG(FLEXIO_PINCFG_OFF) |
+                 FLEXIO_TIMCTL_TIMOD_BAUD;
+  prog->timcfg = FLEXIO_TIMCFG_TIMOUT_ZERO | FLEXIO_TIMCFG_TIMDIS_CMP | FLEXIO_TIMCFG_TIMENA_TRG;
+  prog->timcmp = FLEXIO_TIMCMP_BAUD(32, div);
+  prog->unit   = 4;
+  prog->buf    = FLEXIO_BUF_BIS;
+}
+
+uint32_t
+flexio_ws2812_encode(const uint8_t* grb, uint32_t bytes, uint32_t* words)
+{
+  // 4 data bits to 12 symbol bits, 1 -> 110, 0 -> 100
+  static const uint16_t nibble[16] = {
+    0x924, 0x926, 0x934, 0x936, 0x9a4, 0x9a6, 0x9b4, 0x9b6,
+    0xd24, 0xd26, 0xd34, 0xd36, 0xda4, 0xda6, 0xdb4, 0xdb6,
+  };
+  uint64_t acc   = 0;
+  uint32_t nbits = 0;
+  uint32_t count = 0;
+  uint32_t i;
+  for (i = 0; i < bytes; i++)
+  {
+    acc    = (acc << 24) | ((uint32_t)nibble[grb[i] >> 0x4] << 12) | nibble[grb[i] & 0xf];
+    nbits += 24;
+    if (nbits >= 32)
+    {
+      nbits          -= 32;
+      words[count++]  = (uint32_t)(acc >> nbits);
+    }
+  }
+  if (nbits != 0) { words[count++] = (uint32_t)(acc << (32 - nbits)); } // Low padding, part of the reset gap
+  return count;
+}
+
+void
+flexio_init(flexio_s* io, volatile flexio_regs_s* regs, uint32_t flexio_hz)
+{
+  io->regs   = regs;
+  io->hz     = flexio_hz;
+  io->loaded = 0;
+
+  regs->CTRL = FLEXIO_CTRL_SWRST;
+  regs->CTRL = 0;
+  regs->CTRL = FLEXIO_CTRL_FLEXEN;
+}
+
+/** @brief Hardware setup, host builds (make hosttest) use flexio_init() on a fake block instead */
+void
+flexio_enable(flexio_s* io, uint8_t n)
+{
+  if (io == NULL || n == 0 || n > 3) { return; }
+#if defined(__arm__)
+  // Root clock from pll3_sw_clk, both dividers / 2, gated off while it changes
+  if (n == 1)
+  {
+    CCM_C_CGR5 &= ~(0x3UL << 0x2); // CG1, FlexIO1
+    CCM_C_DCDR  = (CCM_C_DCDR & ~((0x3UL << 0x7) | (0x7UL << 0x9) | (0x7UL << 0xc))) |
+                 (0x3UL << 0x7) | (0x1UL << 0x9) | (0x1UL << 0xc);
+    CCM_C_CGR5 |= (uint32_t)CLK_ON__NO_STOP << 0x2;
+  }
+  else
+  {
+    CCM_C_CGR3  &= ~0x3UL;          // CG0, FlexIO2
+    CCM_C_CGR7  &= ~(0x3UL << 0xc); // CG6, FlexIO3, same root
+    CCM_C_SCMR2  = (CCM_C_SCMR2 & ~(0x3UL << 0x13)) | (0x3UL << 0x13);
+    CCM_C_S1CDR  = (CCM_C_S1CDR & ~((0x7UL << 0x9) | (0x7UL << 0x19))) | (0x1UL << 0x9) | (0x1UL << 0x19);
+    CCM_C_CGR3  |= (uint32_t)CLK_ON__NO_STOP;
+    CCM_C_CGR7  |= (uint32_t)CLK_ON__NO_STOP << 0xc;
+  }
+
+  io->port = n;
+  flexio_init(io, FLEXIO_PORT(n), FLEXIO_CLOCK_HZ);
+#endif
+}
+
+void
+flexio_release(flexio_s* io)
+{
+  if (!io->loaded) { return; }
+
+  io->regs->TIMCTL[io->prog.timer]     = 0;
+  io->regs->SHIFTCTL[io->prog.shifter] = 0;
+  io->regs->SHIFTSDEN                 &= ~(0x1UL << io->prog.shifter);
+  io->loaded                           = 0;
+}
+
+void
+flexio_load(flexio_s* io, const flexio_program_s* prog)
+{
+  flexio_release(io);
+  io->prog = *prog;
+
+  volatile flexio_regs_s* regs = io->regs;
+  regs->SHIFTCFG[prog->shifter] = prog->shiftcfg;
+  regs->SHIFTCTL[prog->shifter] = prog->shiftctl;
+  regs->TIMCMP[prog->timer]     = prog->timcmp;
+  regs->TIMCFG[prog->timer]     = prog->timcfg;
+  regs->TIMCTL[prog->timer]     = prog->timctl; // TIMOD last, arms the timer
+  regs->SHIFTERR                = 0x1UL << prog->shifter;
+  regs->TIMSTAT                 = 0x1UL << prog->timer;
+  io->loaded                    = 1;
+}
+
+volatile void*
+flexio_tx_register(const flexio_s* io)
+{
+  volatile uint32_t* reg = (io->prog.buf == FLEXIO_BUF_BIS) ? &io->regs->SHIFTBUFBIS[io->prog.shifter]
+                                                            : &io->regs->SHIFTBUF[io->prog.shifter];
+  // A byte unit has to land in the bits the shifter sends first
+  if (io->prog.unit == 1 && io->prog.buf == FLEXIO_BUF_BIS) { return (volatile uint8_t*)reg + 3; }
+  return reg;
+}
+
+uint32_t
+flexio_write(flexio_s* io, const uint8_t* data, uint32_t len)
+{
+  uint8_t unit = io->prog.unit;
+  if (!io->loaded || (len % unit) != 0) { return 0; }
+
+  volatile uint32_t* reg = (io->prog.buf == FLEXIO_BUF_BIS) ? &io->regs->SHIFTBUFBIS[io->prog.shifter]
+                                                            : &io->regs->SHIFTBUF[io->prog.shifter];
+  uint32_t bit = 0x1UL << io->prog.shifter;
+  uint32_t i;
+  for (i = 0; i < len; i += unit)
+  {
+    uint32_t value;
+    if (unit == 1) { value = (io->prog.buf == FLEXIO_BUF_BIS) ? (uint32_t)data[i] << 24 : data[i]; }
+    else
+    {
+      value = (uint32_t)data[i] | ((uint32_t)data[i + 1] << 8) | ((uint32_t)data[i + 2] << 16) |
+              ((uint32_t)data[i + 3] << 24);
+    }
+    while (!(io->regs->SHIFTSTAT & bit)) {}
+    *reg = value;
+  }
+  return len;
+}
+
+uint8_t
+flexio_write_dma(flexio_s* io, edma_channel_s* dma, const void* data, uint32_t len, edma_done_fp done, void* ctx)
+{
+  uint8_t  unit  = io->prog.unit;
+  uint32_t count = len / unit;
+  if (!io->loaded || dma->busy || len == 0 || (len % unit) != 0 || count > EDMA_MAX_ITER) { return 0; }
+  if (io->prog.shifter >= FLEXIO_DMA_SHIFTERS) { return 0; }
+
+  edma_tcd_mem_to_periph(dma->tcd,
+                         (uint32_t)(uintptr_t)data,
+                         (uint32_t)(uintptr_t)flexio_tx_register(io),
+                         (unit == 1) ? EDMA_SIZE_8BIT : EDMA_SIZE_32BIT,
+                         (uint16_t)count);
+  io->regs->SHIFTSDEN |= 0x1UL << io->prog.shifter;
+  return edma_start(dma, done, ctx);
+}
+
+uint8_t
+flexio_dma_source(uint8_t n, uint8_t shifter)
+{
+  if (shifter >= FLEXIO_DMA_SHIFTERS) { return 0xff; }
+  if (n == 1) { return (shifter < 2) ? EDMA_SOURCE_FLEXIO1_01 : EDMA_SOURCE_FLEXIO1_23; }
+  if (n == 2) { return (shifter < 2) ? EDMA_SOURCE_FLEXIO2_01 : EDMA_SOURCE_FLEXIO2_23; }
+  return 0xff;
+}
+
+void
+flexio_flush(flexio_s* io)
+{
+  if (!io->loaded) { return; }
+
+  uint32_t sbit = 0x1UL << io->prog.shifter;
+  uint32_t tbit = 0x1UL << io->prog.timer;
+  while (!(io->regs->SHIFTSTAT & sbit)) {}
+  io->regs->TIMSTAT = tbit;
+
+  // Half periods of the frame plus start/stop bits, each div + 1 clocks. A register read takes at least one
+  uint32_t bound = (((io->prog.timcmp >> 0x8) & 0xff) + 1 + 4) * ((io->prog.timcmp & 0xff) + 1);
+  while (!(io->regs->TIMSTAT & tbit) && bound != 0) { bound--; }
+}
@@ -4,41 +4,71 @@
  */
 
 #include "gpio_handler.h"
+#include "monotonic_clock.h"
 
+#include "sys/irq_handler.h"
 #include "sys/registers.h"
 
-/**
- * @brief TODO GPIO_HANDLER
- * 1. Only use ID's in span [0,8]
- *  2. Keep an array of uninitialized devices, current_gpio_devices[9] and then
- *     keep the corresponding pin to the corresponding index.
- *  3. Whenever an interface needs to trigger gpio, then use aforementioned
- *     device-ID and access current_gpio_devices[ID] to do the stuff needed
- **/
-
 // Function pointer to send through some interfaces,
 // for now it only regards display driver interface
 trigger_gpio_fp_t tgpio_fp = trigger_gpio;
-gpiodev_s current_gpio_devices[9]; // Make addDevice/removeDevice functions
 
 void
 trigger_gpio(const uint8_t gpio_device_id, const unsigned char pulse)
 {
+  gpio_line_write(gpio_device_id, pulse); // Precomputed DR_SET/DR_CLEAR store, see gpio_registry.h
+}
+
+uint8_t
+gpio_add_device(const gpiodev_s* gpio_device)
+{
+  if (gpio_device == NULL || gpio_device->base_mux_device == NULL) { return GPIO_LINE_NONE; }
+  if (gpio_device->pin == 0 || gpio_device->pin > GPIO_PORTS) { return GPIO_LINE_NONE; }
 
-  // Uncomment below codeblock after I have written add_device and rem_device;
-  // current_gpio_devices[gpio_device_id] device;
-  // uint8_t dir = device.base_mux_device->ctrl_pos;
-  // set_gpr_gdir()
-  // set_gpio_datar(&GPIO7_DR_SET, dir);
-  // while (some_condition) { // Select GPIOxx macros
-  //    if (pulse){ // conditions might need to be flipped for some devices
-  //       // Set PIN 13 LOW
-  //       clr_gpio_datar(&GPIOxx_DR_CLEAR, dir);
-  //    } else {
-  //       // Set PIN 13 HIGH,
-  //       set_gpio_datar(&GPIOxx_DR_SET, dir);
-  //    }
-  // }
+  // The module named by 'pin' is the one set_gpr_gdir() routed the pad to
+  gpio_pin_s pin;
+  pin.port = GPIO_PORT(gpio_device->pin);
+  pin.mask = 0x1UL << gpio_device->base_mux_device->ctrl_pos;
+  return gpio_line_add(&pin);
+}
+
+void
+gpio_remove_device(const uint8_t gpio_device_id)
+{
+  gpio_line_remove(gpio_device_id);
+}
+
+/** @brief Entry of a port's line(s), stamps the edges before anything else runs */
+static void
+__gpio_irq_isr__(void* ctx)
+{
+  gpio_irq_service((gpio_irq_s*)ctx, clock_now_ticks());
+  __asm__ volatile("dsb"); // ISR clears land before the exception returns, no re-entry
+}
+
+void
+gpio_irq_enable(gpio_irq_s* irq, uint8_t port, uint8_t nvic_priority)
+{
+  static const irq_num_e port_lines[GPIO_FAST_OFFSET][2] = {
+    {IRQ_GPIO1_0_15, IRQ_GPIO1_16_31},
+    {IRQ_GPIO2_0_15, IRQ_GPIO2_16_31},
+    {IRQ_GPIO3_0_15, IRQ_GPIO3_16_31},
+    {IRQ_GPIO4_0_15, IRQ_GPIO4_16_31},
+    {IRQ_GPIO5_0_15, IRQ_GPIO5_16_31},
+  };
+  if (irq == NULL || port == 0 || port > GPIO_PORTS) { return; }
+
+  gpio_irq_init(irq, GPIO_PORT(port));
+
+  uint8_t lines = (port > GPIO_FAST_OFFSET) ? 1 : 2;
+  uint8_t line;
+  for (line = 0; line < lines; line++)
+  {
+    irq_num_e num = (port > GPIO_FAST_OFFSET) ? IRQ_GPIO6789 : port_lines[port - 1][line];
+    irq_attach(&irq->slots[line], num, &__gpio_irq_isr__, irq);
+    NVIC_SET_PRIORITY(num, nvic_priority);
+    NVIC_ENABLE_IRQ(num);
+  }
 }
 
 /**
@@ -135,41 +165,47 @@ init_gpio(gpiodev_s*       gpio_device,
   set_gpr_gdir(gpio_device);
 }
 
+/** @brief IOMUXC_GPR_GPR26-29, the module select of pad banks 1-4 */
+static vuint32_t* const g_gpio_route_gpr[GPIO_FAST_OFFSET - 1] = {
+  &IOMUXC_GPR_GPR26,
+  &IOMUXC_GPR_GPR27,
+  &IOMUXC_GPR_GPR28,
+  &IOMUXC_GPR_GPR29,
+};
+
+void
+gpio_route_pin(uint8_t port, uint8_t bit, uint8_t fast)
+{
+  uint8_t bank = gpio_route_bank(port);
+  if (bank == 0 || bank >= GPIO_FAST_OFFSET || bit > 31) { return; }
+
+  vuint32_t* gpr     = g_gpio_route_gpr[bank - 1];
+  uint32_t   primask = __irq_save__();
+  *gpr               = fast ? (*gpr | (0x1UL << bit)) : (*gpr & ~(0x1UL << bit));
+  __irq_restore__(primask);
+}
+
+uint8_t
+gpio_pin_configure(const gpio_pin_config_s* config, gpio_pin_s* pin)
+{
+  uint8_t output = (config->io_type == GDIR_OUT);
+  uint8_t module = gpio_route_module(config->port, output, config->route);
+  if (module == 0 || module > GPIO_PORTS || config->bit > 31) { return 0; }
+
+  // Direction on the module about to take the pad first, so an output never glitches through the other one
+  pin->port = GPIO_PORT(module);
+  pin->mask = 0x1UL << config->bit;
+  gpio_port_direction(pin->port, pin->mask, output);
+  gpio_route_pin(config->port, config->bit, module > GPIO_FAST_OFFSET);
+  return module;
+}
+
 /**
- * @brief: Set all MUX bits in the correct General Purpose Register (GPR)
+ * @brief: Route the device's pin to the module named by 'pin' (GPR26-29) and set its direction
  **/
 void
 set_gpr_gdir(gpiodev_s* gpio_device)
 {
-  uint8_t     LOW_HIGH = 0x0; // 0001 low, 0000 high
-  vuint32_t * gdir_addr = ((vuint32_t*)0);
-  switch (gpio_device->pin) {
-      // GPR26 [GPIO1,GPIO6]
-    case 0x1:
-    case 0x6:
-      //  Set all MUX bits to either GPIO1 or GPIO6
-      IOMUXC_GPR_GPR26 = 0xffffffff * (gpio_device->pin == 0x6);
-      break;
-      // GPR27 [GPIO2,GPIO7]
-    case 0x2:
-    case 0x7:
-      // Set all MUX bits to either GPIO2 or GPIO7
-      IOMUXC_GPR_GPR27 = 0xffffffff * (gpio_device->pin == 0x7);
-      break;
-      // GPR28 [GPIO3,GPIO8]
-    case 0x3:
-    case 0x8:
-      // Set all MUX bits to either GPIO3 or GPIO8
-      IOMUXC_GPR_GPR28 = 0xffffffff * (gpio_device->pin == 0x8);
-      break;
-      // GPR29 [GPIO4,GPIO9]
-    case 0x4:
-    case 0x9:
-      // Set all MUX bits to either GPIO4 or GPIO9
-      IOMUXC_GPR_GPR29 = 0xffffffff * (gpio_device->pin == 0x9);
-      break;
-  }
-
   // Setting gpio direction for either output or input
   vuint32_t* redirector = &GPIO1_DIRR;
   switch (gpio_device->pin) {
@@ -185,6 +221,11 @@ set_gpr_gdir(gpiodev_s* gpio_device)
   }
   SET_GPIO_GDIR(
       redirector, gpio_device->io_type, gpio_device->base_mux_device->ctrl_pos);
+
+  // Only this pin's GPR bit, other pins of the bank keep their module
+  gpio_route_pin(gpio_device->pin,
+                 gpio_device->base_mux_device->ctrl_pos,
+                 gpio_device->pin > GPIO_FAST_OFFSET);
 }
 
 /**
@@ -194,7 +235,7 @@ set_gpr_gdir(gpiodev_s* gpio_device)
 void
 callback_toggle_led()
 {
-  SET_GPIO_REGISTER(GPIO7_DR_TOGGLE, 0x3);
+  gpio_port_toggle(GPIO_PORT(7), 0x1 << 0x3);
   PIT_TFLG0_CLR;
   __asm__ volatile("dsb");
 }
@@ -203,12 +244,12 @@ gpiodev_s*
 init_onboard_led()
 {
   // inits mux with alt5, and sets pad at DSE 0x7, in pad-group B0 at control
-  // register position 3, then sets GPR27 to control, due to pin being 0x7, and
-  // will set it to input based on the io_type member
+  // register position 3, then routes bit 3 of GPR27 to GPIO7 (output, fast
+  // module) and sets the direction based on the io_type member
   gpiodev_s* heap_gpio_device = (gpiodev_s*)malloc_(sizeof(gpiodev_s));
 
-  heap_gpio_device->pin = 0x7;
   heap_gpio_device->io_type = GDIR_OUT;
+  heap_gpio_device->pin     = gpio_route_module(0x2, 1, GPIO_ROUTE_AUTO); // GPIO7, pad bank 2 on the fast module
   init_gpio(heap_gpio_device, GDIR_DIR_REG, GPIO_B0, PAD_DSE_R07, 0x3);
 
   return heap_gpio_device;
@@ -230,13 +271,23 @@ timer_context_s* generate_led_device_context()
   return timer_context;
 }
 
-// Polling callback
+// Polling callback, calls the tick callback once per timerdatum period measured on the monotonic clock
 void timer_poll(timer_manager_s* pit_mgr, timer_datum_s* timerdatum)
 {
-  // Our range is between 0 to 100 remaining pollings for a triggering the tick callback   
-  if (PIT_CVAL0 < 100) 
+  static time_ns64_t due_ns  = 0; // Phase-locked to the period, an early or late poll does not shift it
+  static time_ns64_t last_ns = 0;
+
+  time_ns64_t now_ns    = clock_now_ns();
+  time_ns64_t period_ns = clock_ticks_to_ns_at(timerdatum->val, timerdatum->freq);
+
+  // Polled at the same period, so a poll up to half a period early still takes its tick
+  if (now_ns + (period_ns >> 0x1) >= due_ns) 
   {
-    float fDeltaSeconds = resolve_time_as_float(timerdatum->freq, MILLIS_E, timerdatum->val - PIT_CVAL0, FROMTICKS_E);
-    pit_mgr->tick_callback(fDeltaSeconds);
+    due_ns += period_ns;
+    if (now_ns >= due_ns) { due_ns = now_ns + period_ns; } // A whole period missed, resync instead of bursting
+
+    time_ns64_t delta_ns = now_ns - last_ns;
+    last_ns              = now_ns;
+    pit_mgr->tick_callback(delta_ns); // Integer nano-seconds, no FPU divide and no drift
   }
 }
\ No newline at end of file
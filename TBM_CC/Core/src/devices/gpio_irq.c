@@ -0,0 +1,94 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "gpio_irq.h"
+#include "sys/irq_handler.h"
+
+#include <stddef.h>
+
+void
+gpio_irq_init(gpio_irq_s* irq, volatile gpio_port_regs_s* regs)
+{
+  uint32_t pin;
+  for (pin = 0; pin < GPIO_IRQ_PINS; pin++)
+  {
+    irq->entries[pin].handler  = NULL;
+    irq->entries[pin].ctx      = NULL;
+    irq->entries[pin].last     = 0;
+    irq->entries[pin].debounce = 0;
+  }
+  irq->regs     = regs;
+  irq->attached = 0;
+  irq->primed   = 0;
+  irq->bounced  = 0;
+  irq->spurious = 0;
+}
+
+void
+gpio_irq_attach(gpio_irq_s*     irq,
+                uint32_t        pin,
+                gpio_irq_edge_e edge,
+                gpio_irq_fp     handler,
+                void*           ctx,
+                uint64_t        debounce)
+{
+  if (pin >= GPIO_IRQ_PINS || handler == NULL) { return; }
+
+  volatile gpio_port_regs_s* regs  = irq->regs;
+  volatile uint32_t*         icr   = (pin < 16) ? &regs->ICR1 : &regs->ICR2;
+  uint32_t                   shift = (pin & 0xf) << 0x1;
+  uint32_t                   bit   = 0x1UL << pin;
+
+  uint32_t primask = __irq_save__();
+  regs->IMR &= ~bit;
+
+  irq->entries[pin].handler  = handler;
+  irq->entries[pin].ctx      = ctx;
+  irq->entries[pin].debounce = debounce;
+  irq->primed               &= ~bit;
+  irq->attached             |= bit;
+
+  if (edge == GPIO_IRQ_BOTH)
+  {
+    regs->EDGE_SEL |= bit;
+  }
+  else
+  {
+    regs->EDGE_SEL &= ~bit;
+    *icr            = (*icr & ~(0x3UL << shift)) | ((uint32_t)edge << shift);
+  }
+
+  regs->ISR  = bit; // A trigger change can flag the pin
+  regs->IMR |= bit;
+  __irq_restore__(primask);
+}
+
+void
+gpio_irq_detach(gpio_irq_s* irq, uint32_t pin)
+{
+  if (pin >= GPIO_IRQ_PINS) { return; }
+
+  uint32_t bit     = 0x1UL << pin;
+  uint32_t primask = __irq_save__();
+  irq->regs->IMR              &= ~bit;
+  irq->regs->ISR               = bit;
+  irq->attached               &= ~bit;
+  irq->primed                 &= ~bit;
+  irq->entries[pin].handler    = NULL;
+  irq->entries[pin].ctx        = NULL;
+  __irq_restore__(primask);
+}
+
+uint32_t
+gpio_irq_service(gpio_irq_s* irq, uint64_t now)
+{
+  uint32_t pending = gpio_irq_collect(irq->regs);
+  if (pending == 0)
+  {
+    irq->spurious++; // The other half of the port, or another port on IRQ_GPIO6789
+    return 0;
+  }
+  return gpio_irq_dispatch(irq, pending, now);
+}
@@ -0,0 +1,75 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "gpio_registry.h"
+#include "containers/bitset.h"
+#include "sys/irq_handler.h"
+
+#include <stddef.h>
+
+static volatile uint32_t g_gpio_line_sink; // Target of free entries
+static uint32_t          g_gpio_lines_used;
+
+#if GPIO_LINES != 16
+#error "Extend the g_gpio_lines initialiser to GPIO_LINES + 1 entries"
+#endif
+
+#define __GPIO_LINE_FREE__  {{&g_gpio_line_sink, &g_gpio_line_sink}, 0}
+#define __GPIO_LINE_FREE4__ __GPIO_LINE_FREE__, __GPIO_LINE_FREE__, __GPIO_LINE_FREE__, __GPIO_LINE_FREE__
+
+// Free from the start (not .bss), an ID written before any gpio_line_add() never stores to address 0.
+// The last entry is GPIO_LINE_SINK, never handed out
+gpio_line_s g_gpio_lines[GPIO_LINES + 1] = {
+  __GPIO_LINE_FREE4__, __GPIO_LINE_FREE4__, __GPIO_LINE_FREE4__, __GPIO_LINE_FREE4__, __GPIO_LINE_FREE__};
+
+static void
+__gpio_line_free__(gpio_line_s* line)
+{
+  line->reg[0] = &g_gpio_line_sink;
+  line->reg[1] = &g_gpio_line_sink;
+  line->mask   = 0;
+}
+
+uint8_t
+gpio_line_add(const gpio_pin_s* pin)
+{
+  uint32_t primask = __irq_save__();
+  uint32_t free = ~g_gpio_lines_used & ((GPIO_LINES < 32) ? ((0x1UL << GPIO_LINES) - 1) : 0xffffffffUL);
+  if (pin == NULL || free == 0)
+  {
+    __irq_restore__(primask);
+    return GPIO_LINE_NONE;
+  }
+
+  uint32_t     id   = bits_ffs32(free);
+  gpio_line_s* line = &g_gpio_lines[id];
+  line->reg[0]      = &pin->port->DR_CLEAR;
+  line->reg[1]      = &pin->port->DR_SET;
+  line->mask        = pin->mask;
+  g_gpio_lines_used |= 0x1UL << id;
+
+  __irq_restore__(primask);
+  return (uint8_t)id;
+}
+
+void
+gpio_line_remove(uint8_t id)
+{
+  if (id >= GPIO_LINES) { return; }
+
+  uint32_t primask = __irq_save__();
+  if (g_gpio_lines_used & (0x1UL << id))
+  {
+    __gpio_line_free__(&g_gpio_lines[id]);
+    g_gpio_lines_used &= ~(0x1UL << id);
+  }
+  __irq_restore__(primask);
+}
+
+uint32_t
+gpio_line_used()
+{
+  return g_gpio_lines_used;
+}
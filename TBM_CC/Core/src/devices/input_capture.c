@@ -0,0 +1,144 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "input_capture.h"
+#include "utils/utimer_mgr.h"
+
+#include <stddef.h>
+
+void
+capture_ring_init(capture_ring_s* ring)
+{
+  ring->head     = 0;
+  ring->tail     = 0;
+  ring->overruns = 0;
+}
+
+uint32_t
+capture_ring_push_block(capture_ring_s* ring, const uint32_t* stamps, uint32_t count)
+{
+  uint32_t head  = ring->head;
+  uint32_t space = CAPTURE_RING_SIZE - (head - ring->tail);
+  uint32_t idx;
+
+  if (count > space)
+  {
+    ring->overruns += count - space;
+    count = space;
+  }
+
+  for (idx = 0; idx < count; idx++) { ring->stamps[(head + idx) & CAPTURE_RING_MASK] = stamps[idx]; }
+  __asm__ volatile("" : : : "memory");
+  ring->head = head + count;
+  return count;
+}
+
+uint8_t
+capture_ring_pop(capture_ring_s* ring, uint32_t* stamp)
+{
+  uint32_t tail = ring->tail;
+  if (tail == ring->head) { return 0; }
+
+  *stamp = ring->stamps[tail & CAPTURE_RING_MASK];
+  __asm__ volatile("" : : : "memory"); // Stamp read before the slot is released
+  ring->tail = tail + 1;
+  return 1;
+}
+
+uint32_t
+capture_ring_count(const capture_ring_s* ring)
+{
+  return ring->head - ring->tail;
+}
+
+void
+capture_stats_init(capture_stats_s* stats)
+{
+  stats->count      = 0;
+  stats->last_stamp = 0;
+  stats->reference  = 0;
+  stats->min        = 0xffffffff;
+  stats->max        = 0;
+  stats->sum_dev    = 0;
+  stats->sum_dev_sq = 0;
+  stats->span       = 0;
+  stats->primed     = 0;
+}
+
+void
+capture_stats_add(capture_stats_s* stats, uint32_t stamp)
+{
+  if (!stats->primed)
+  {
+    stats->primed     = 1;
+    stats->last_stamp = stamp;
+    return;
+  }
+
+  uint32_t interval = stamp - stats->last_stamp; // Modulo 2^32, survives counter wraps
+  stats->last_stamp = stamp;
+
+  if (stats->count == 0) { stats->reference = interval; }
+
+  int64_t dev = (int64_t)interval - (int64_t)stats->reference;
+  stats->sum_dev    += dev;
+  stats->sum_dev_sq += (uint64_t)(dev * dev);
+  stats->span       += interval;
+  stats->count++;
+
+  if (interval < stats->min) { stats->min = interval; }
+  if (interval > stats->max) { stats->max = interval; }
+}
+
+/** @brief floor(value / divisor) for a signed 'value', only unsigned 64/32 divisions */
+static int64_t
+__capture_sdiv__(int64_t value, uint32_t divisor)
+{
+  if (value >= 0) { return (int64_t)time_udiv64_32((uint64_t)value, divisor, NULL); }
+
+  uint32_t rem;
+  int64_t  quotient = -(int64_t)time_udiv64_32((uint64_t)(-value), divisor, &rem);
+  return (rem != 0) ? quotient - 1 : quotient;
+}
+
+uint32_t
+capture_stats_mean(const capture_stats_s* stats)
+{
+  if (stats->count == 0) { return 0; }
+  return (uint32_t)((int64_t)stats->reference + __capture_sdiv__(stats->sum_dev, stats->count));
+}
+
+uint32_t
+capture_stats_jitter(const capture_stats_s* stats)
+{
+  if (stats->count < 2) { return 0; }
+
+  // var = E[dev^2] - E[dev]^2, both relative to the first interval
+  uint64_t mean_sq  = time_udiv64_32(stats->sum_dev_sq, stats->count, NULL);
+  uint64_t abs_sum  = (stats->sum_dev < 0) ? (uint64_t)(-stats->sum_dev) : (uint64_t)stats->sum_dev;
+  uint64_t mean_dev = time_udiv64_32(abs_sum, stats->count, NULL);
+  uint64_t variance = (mean_sq > mean_dev * mean_dev) ? mean_sq - mean_dev * mean_dev : 0;
+  return time_isqrt64(variance);
+}
+
+uint32_t
+capture_stats_freq_mhz(const capture_stats_s* stats, uint32_t counter_hz)
+{
+  if (stats->count == 0 || stats->span == 0) { return 0; }
+
+  // counter_hz * 1000 / (span / count), with the mean scaled up by 2^shift so
+  // short intervals keep their fraction. 'num << shift' stays below 2^64.
+  uint64_t num       = (uint64_t)counter_hz * 1000ULL;
+  uint32_t mean_int  = (uint32_t)time_udiv64_32(stats->span, stats->count, NULL);
+  uint8_t  shift     = 0;
+
+  while (shift < 25 && (mean_int >> (31 - shift)) == 0) { shift++; }
+
+  uint64_t mean_q = time_udiv64_32(stats->span << shift, stats->count, NULL);
+  if (mean_q == 0) { return 0xffffffff; }
+
+  uint64_t freq = time_udiv64_32(num << shift, (uint32_t)mean_q, NULL);
+  return (freq > 0xffffffff) ? 0xffffffff : (uint32_t)freq;
+}
@@ -2,4 +2,40 @@
  * @authors   Ario Amin @ Permadev, 
  * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
  */
-#include "iomux_manager.h"
\ No newline at end of file
+#include "iomux_manager.h"
+
+pinmux_s g_iomux;
+
+static uint8_t g_iomux_ready;
+
+static const pinmux_entry_s g_board_pinmux[] = {
+  IOMUX_LED_PIN13,
+  IOMUX_GPT2_CAPIN1_PIN15,
+  IOMUX_LPI2C1_SCL_PIN19,
+  IOMUX_LPI2C1_SDA_PIN18,
+};
+
+static void
+__iomux_init__()
+{
+  if (!g_iomux_ready)
+  {
+    pinmux_init(&g_iomux, PINMUX_MUX_BASE, PINMUX_PAD_BASE);
+    g_iomux_ready = 1;
+  }
+}
+
+uint32_t
+iomux_board_init()
+{
+  __iomux_init__();
+  return pinmux_apply(&g_iomux, g_board_pinmux, PINMUX_COUNT(g_board_pinmux));
+}
+
+uint8_t
+iomux_route(const pinmux_entry_s* entry)
+{
+  __iomux_init__();
+  if (pinmux_owned(&g_iomux, entry->pad)) { return 0; }
+  return pinmux_apply(&g_iomux, entry, 1) == 0;
+}
@@ -0,0 +1,294 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "lpi2c.h"
+#include "sys/irq_handler.h"
+#include "sys/memory_map.h"
+#include "typedefs/ttimer_mgr.h"
+
+#include <stddef.h>
+
+uint8_t
+lpi2c_timing(uint32_t src_hz, uint32_t scl_hz, lpi2c_timing_s* timing)
+{
+  const uint8_t filt = 1; // Glitch filter, adds to the SCL latency
+  uint8_t       prescale;
+  if (scl_hz == 0) { return 0; }
+
+  for (prescale = 0; prescale < 8; prescale++)
+  {
+    uint32_t cycles  = (src_hz + (scl_hz << prescale) - 1) / (scl_hz << prescale);
+    uint32_t latency = (2 + filt) >> prescale; // SCL_LATENCY, ROUNDDOWN((2 + FILTSCL) / 2^PRESCALE)
+    if (cycles < 2 + latency + 2) { cycles = 2 + latency + 2; }
+
+    uint32_t avail = cycles - 2 - latency;
+    uint32_t clklo = (avail * 3 + 4) / 5;
+    uint32_t clkhi = avail - clklo;
+    if (clklo > 0x3f || clkhi > 0x3f) { continue; }
+
+    timing->clklo    = (uint8_t)clklo;
+    timing->clkhi    = (uint8_t)clkhi;
+    timing->sethold  = (uint8_t)(clklo > 1 ? clklo - 1 : 1); // START hold, STOP/repeated START setup
+    timing->datavd   = (uint8_t)(clklo / 3 ? clklo / 3 : 1);
+    timing->prescale = prescale;
+    timing->filt     = filt;
+    timing->busidle  = (uint16_t)((clklo + timing->sethold + 2) * 2);
+    timing->hz       = src_hz / ((clklo + clkhi + 2 + latency) << prescale);
+    return 1;
+  }
+  return 0;
+}
+
+void
+lpi2c_init(lpi2c_s* bus, volatile lpi2c_regs_s* regs, uint32_t src_hz, uint32_t scl_hz)
+{
+  lpi2c_timing_s timing;
+  if (!lpi2c_timing(src_hz, scl_hz, &timing)) { lpi2c_timing(src_hz, LPI2C_STANDARD_HZ, &timing); }
+
+  bus->regs      = regs;
+  bus->dma       = NULL;
+  bus->done      = NULL;
+  bus->ctx       = NULL;
+  bus->hz        = timing.hz;
+  bus->transfers = 0;
+  bus->errors    = 0;
+  bus->phase     = LPI2C_IDLE;
+  bus->status    = LPI2C_OK;
+  bus->fifo      = (uint8_t)(0x1 << (regs->PARAM & 0xf)); // MTXFIFO, log2 of the depth
+
+  regs->MCR    = LPI2C_MCR_RST;
+  regs->MCR    = 0;
+  regs->MCFGR1 = LPI2C_MCFGR1_PRESCALE(timing.prescale);
+  regs->MCFGR2 = LPI2C_MCFGR2_BUSIDLE(timing.busidle) | LPI2C_MCFGR2_FILTSCL(timing.filt) |
+                 LPI2C_MCFGR2_FILTSDA(timing.filt);
+  regs->MCCR0  = LPI2C_MCCR0_CLKLO(timing.clklo) | LPI2C_MCCR0_CLKHI(timing.clkhi) |
+                LPI2C_MCCR0_SETHOLD(timing.sethold) | LPI2C_MCCR0_DATAVD(timing.datavd);
+  regs->MFCR   = LPI2C_MFCR_TXWATER(bus->fifo >> 1); // Refill at half empty
+  regs->MIER   = 0;
+  regs->MDER   = 0;
+  regs->MCR    = LPI2C_MCR_MEN;
+}
+
+#if defined(__arm__)
+static void
+__lpi2c_isr__(void* ctx)
+{
+  lpi2c_service((lpi2c_s*)ctx);
+  __asm__ volatile("dsb");
+}
+#endif
+
+/** @brief Hardware setup, host builds (make hosttest) use lpi2c_init() on a fake block instead */
+void
+lpi2c_enable(lpi2c_s* bus, uint8_t n, uint32_t scl_hz, uint8_t nvic_priority)
+{
+  // CCGR2 CG3-CG5 for LPI2C1-3, CCGR6 CG12 for LPI2C4
+  static const uint8_t gate_shift[LPI2C_PORTS] = {0x6, 0x8, 0xa, 0x18};
+  if (bus == NULL || n == 0 || n > LPI2C_PORTS) { return; }
+#if defined(__arm__)
+  // Shared root, oscillator (LPI2C_CLK_SEL) with LPI2C_CLK_PODF at / 1
+  CCM_C_SCDR2 = (CCM_C_SCDR2 & ~(0x3fUL << 0x13)) | (0x1UL << 0x12);
+  if (n < LPI2C_PORTS) { CCM_C_CGR2 |= (uint32_t)CLK_ON__NO_STOP << gate_shift[n - 1]; }
+  else                 { CCM_C_CGR6 |= (uint32_t)CLK_ON__NO_STOP << gate_shift[n - 1]; }
+
+  lpi2c_init(bus, LPI2C_PORT(n), LPI2C_CLOCK_HZ, scl_hz);
+
+  irq_num_e irq = (irq_num_e)(IRQ_LPI2C1 + n - 1);
+  irq_attach(&bus->slot, irq, &__lpi2c_isr__, bus);
+  NVIC_SET_PRIORITY(irq, nvic_priority);
+  NVIC_ENABLE_IRQ(irq);
+#else
+  (void)gate_shift;
+  (void)scl_hz;
+  (void)nvic_priority;
+#endif
+}
+
+void
+lpi2c_attach_dma(lpi2c_s* bus, edma_channel_s* dma)
+{
+  bus->dma = dma;
+}
+
+static void
+__lpi2c_finish__(lpi2c_s* bus, lpi2c_status_e status)
+{
+  bus->regs->MIER = 0;
+  bus->status     = (uint8_t)status;
+  bus->phase      = LPI2C_IDLE;
+  bus->transfers++;
+  if (status != LPI2C_OK) { bus->errors++; }
+  if (bus->done != NULL) { bus->done(bus->ctx, status); }
+}
+
+static void
+__lpi2c_abort__(lpi2c_s* bus, lpi2c_status_e status)
+{
+  volatile lpi2c_regs_s* regs = bus->regs;
+  if (bus->phase == LPI2C_DMA && bus->dma != NULL) { edma_stop(bus->dma); }
+  regs->MDER  = 0;
+  regs->MCR  |= LPI2C_MCR_RTF; // Drop what is still queued
+  regs->MSR   = LPI2C_MSR_ERRORS;
+  if (status == LPI2C_NACK) { regs->MTDR = LPI2C_CMD_STOP; } // Still owns the bus, release it
+  __lpi2c_finish__(bus, status);
+}
+
+/** @brief Queue as many words as the FIFO takes, STOP after the last byte */
+static void
+__lpi2c_fill__(lpi2c_s* bus)
+{
+  volatile lpi2c_regs_s* regs  = bus->regs;
+  uint32_t               queued = LPI2C_MFSR_TXCOUNT(regs->MFSR);
+  uint32_t               free   = (queued < bus->fifo) ? bus->fifo - queued : 0;
+
+  while (free != 0)
+  {
+    if (bus->start)
+    {
+      regs->MTDR = LPI2C_CMD_START | ((uint32_t)bus->addr << 0x1);
+      bus->start = 0;
+    }
+    else if (bus->head_len != 0)
+    {
+      regs->MTDR = LPI2C_CMD_TX | *bus->head++;
+      bus->head_len--;
+    }
+    else if (bus->data_len != 0)
+    {
+      regs->MTDR = LPI2C_CMD_TX | *bus->data++;
+      bus->data_len--;
+    }
+    else
+    {
+      regs->MTDR = LPI2C_CMD_STOP;
+      bus->phase = LPI2C_STOP;
+      regs->MIER = LPI2C_MSR_SDF | LPI2C_MSR_ERRORS;
+      return;
+    }
+    free--;
+  }
+}
+
+/** @brief DMA completion, the last data byte is in the FIFO, STOP goes in behind it */
+static void
+__lpi2c_dma_done__(void* ctx, uint8_t error)
+{
+  lpi2c_s* bus    = (lpi2c_s*)ctx;
+  bus->regs->MDER = 0;
+  if (bus->phase != LPI2C_DMA) { return; } // Aborted already
+  if (error)
+  {
+    __lpi2c_abort__(bus, LPI2C_DMA_ERROR);
+    return;
+  }
+
+  bus->phase      = LPI2C_FIFO;
+  bus->regs->MIER = LPI2C_MIER_TDIE | LPI2C_MSR_ERRORS;
+  __lpi2c_fill__(bus);
+}
+
+uint8_t
+lpi2c_write_async(lpi2c_s*       bus,
+                  uint8_t        addr,
+                  const uint8_t* head,
+                  uint16_t       head_len,
+                  const uint8_t* data,
+                  uint16_t       len,
+                  lpi2c_done_fp  done,
+                  void*          ctx)
+{
+  if (bus->phase != LPI2C_IDLE || addr > 0x7f) { return 0; }
+  if ((head_len != 0 && head == NULL) || (len != 0 && data == NULL)) { return 0; }
+
+  volatile lpi2c_regs_s* regs = bus->regs;
+  bus->addr     = addr;
+  bus->head     = head;
+  bus->head_len = head_len;
+  bus->data     = data;
+  bus->data_len = len;
+  bus->done     = done;
+  bus->ctx      = ctx;
+  bus->status   = LPI2C_OK;
+  bus->start    = 1;
+  regs->MSR     = regs->MSR & LPI2C_MSR_W1C; // Flags of the previous transfer
+
+  edma_channel_s* dma = bus->dma;
+  if (dma != NULL && !dma->busy && len >= LPI2C_DMA_MIN && len <= EDMA_MAX_ITER && head_len <= LPI2C_HEAD_MAX)
+  {
+    // START and head straight into the empty FIFO, the data block follows by DMA
+    regs->MTDR = LPI2C_CMD_START | ((uint32_t)addr << 0x1);
+    while (bus->head_len != 0)
+    {
+      regs->MTDR = LPI2C_CMD_TX | *bus->head++;
+      bus->head_len--;
+    }
+    bus->start    = 0;
+    bus->data_len = 0;
+    bus->phase    = LPI2C_DMA;
+
+    edma_tcd_mem_to_periph(dma->tcd, (uint32_t)(uintptr_t)data, (uint32_t)(uintptr_t)&regs->MTDR, EDMA_SIZE_8BIT, len);
+    regs->MIER = LPI2C_MSR_ERRORS;
+    regs->MDER = LPI2C_MDER_TDDE;
+    edma_start(dma, &__lpi2c_dma_done__, bus);
+    return 1;
+  }
+
+  uint32_t primask = __irq_save__(); // The interrupt may fire between the first fill and this
+  bus->phase       = LPI2C_FIFO;
+  regs->MIER       = LPI2C_MIER_TDIE | LPI2C_MSR_ERRORS;
+  __lpi2c_fill__(bus);
+  __irq_restore__(primask);
+  return 1;
+}
+
+void
+lpi2c_service(lpi2c_s* bus)
+{
+  volatile lpi2c_regs_s* regs = bus->regs;
+  uint32_t               msr  = regs->MSR;
+  if (bus->phase == LPI2C_IDLE) { return; }
+
+  if (msr & LPI2C_MSR_ERRORS)
+  {
+    lpi2c_status_e status = (msr & LPI2C_MSR_NDF)   ? LPI2C_NACK
+                            : (msr & LPI2C_MSR_ALF) ? LPI2C_ARBITRATION
+                            : (msr & LPI2C_MSR_FEF) ? LPI2C_FIFO_ERROR
+                                                    : LPI2C_PIN_LOW;
+    __lpi2c_abort__(bus, status);
+    return;
+  }
+
+  if (bus->phase == LPI2C_STOP)
+  {
+    if (msr & LPI2C_MSR_SDF)
+    {
+      regs->MSR = LPI2C_MSR_SDF;
+      __lpi2c_finish__(bus, LPI2C_OK);
+    }
+    return;
+  }
+
+  if (bus->phase == LPI2C_FIFO && (msr & LPI2C_MSR_TDF)) { __lpi2c_fill__(bus); }
+}
+
+lpi2c_status_e
+lpi2c_wait(lpi2c_s* bus)
+{
+  while (bus->phase != LPI2C_IDLE)
+  {
+    uint32_t primask = __irq_save__();
+    if (bus->phase == LPI2C_DMA && bus->dma != NULL) { edma_service(bus->dma); }
+    lpi2c_service(bus);
+    __irq_restore__(primask);
+  }
+  return (lpi2c_status_e)bus->status;
+}
+
+lpi2c_status_e
+lpi2c_write(lpi2c_s* bus, uint8_t addr, const uint8_t* head, uint16_t head_len, const uint8_t* data, uint16_t len)
+{
+  if (!lpi2c_write_async(bus, addr, head, head_len, data, len, NULL, NULL)) { return LPI2C_FIFO_ERROR; }
+  return lpi2c_wait(bus);
+}
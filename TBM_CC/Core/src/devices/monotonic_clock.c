@@ -0,0 +1,62 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "monotonic_clock.h"
+#include "timer_manager.h"
+
+static pit_speed_e g_clock_freq = PIT_SPEED_200MHz;
+
+void
+init_monotonic_clock(pit_speed_e freq)
+{
+  g_clock_freq = freq;
+  __pit_enable_clock__();
+
+  // Stop both before loading, a chained channel only decrements on the previous channel's expiry
+  PIT_TCTRL3 = 0;
+  PIT_TCTRL2 = 0;
+  PIT_LDVAL3 = 0xffffffff;
+  PIT_LDVAL2 = 0xffffffff;
+  PIT_TFLG3  = 1;
+  PIT_TFLG2  = 1;
+
+  PIT_TCTRL3 = PIT_TCTRL_CHAIN(PIT_CHAINED, 0x0) | 0x1; // Chained to channel 2, no interrupt
+  PIT_TCTRL2 = 0x1;                                     // Free running, no interrupt
+}
+
+uint64_t
+clock_now_ticks()
+{
+  uint32_t hi       = PIT_CVAL3;
+  uint32_t lo       = PIT_CVAL2;
+  uint32_t hi_again = PIT_CVAL3;
+
+  // Channel 2 expired in between, its reloaded value belongs to the new high word
+  if (hi != hi_again)
+  {
+    lo = PIT_CVAL2;
+    hi = hi_again;
+  }
+
+  return ~((((uint64_t)hi) << 0x20) | lo); // Down-counter, elapsed = max - value
+}
+
+time_ns64_t
+clock_ticks_to_ns(uint64_t ticks)
+{
+  return clock_ticks_to_ns_at(ticks, g_clock_freq);
+}
+
+time_ns64_t
+clock_now_ns()
+{
+  return clock_ticks_to_ns_at(clock_now_ticks(), g_clock_freq);
+}
+
+pit_speed_e
+clock_speed()
+{
+  return g_clock_freq;
+}
@@ -0,0 +1,59 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "pinmux.h"
+#include "sys/irq_handler.h"
+
+void
+pinmux_init(pinmux_s* mux, vuint32_t* mux_base, vuint32_t* pad_base)
+{
+  mux->mux_base  = mux_base;
+  mux->pad_base  = pad_base;
+  mux->conflicts = 0;
+  bitset_zero(mux->owned, BITSET_WORDS(PINMUX_PADS));
+}
+
+uint32_t
+pinmux_apply(pinmux_s* mux, const pinmux_entry_s* table, uint32_t count)
+{
+  uint32_t skipped = 0;
+  uint32_t idx;
+
+  uint32_t primask = __irq_save__(); // Claim and write as one step, drivers may route from an ISR
+  for (idx = 0; idx < count; idx++)
+  {
+    const pinmux_entry_s* entry = &table[idx];
+    if (entry->pad >= PINMUX_PADS || bitset_test(mux->owned, entry->pad))
+    {
+      skipped++;
+      continue;
+    }
+    bitset_set(mux->owned, entry->pad);
+
+    if (entry->daisy != NULL) { *entry->daisy = entry->daisy_value; }
+    mux->pad_base[entry->pad] = entry->config;
+    mux->mux_base[entry->pad] = entry->alt;
+  }
+  mux->conflicts += skipped;
+  __irq_restore__(primask);
+
+  return skipped;
+}
+
+void
+pinmux_release(pinmux_s* mux, uint32_t pad)
+{
+  if (pad >= PINMUX_PADS) { return; }
+
+  uint32_t primask = __irq_save__();
+  bitset_clear(mux->owned, pad);
+  __irq_restore__(primask);
+}
+
+uint8_t
+pinmux_owned(const pinmux_s* mux, uint32_t pad)
+{
+  return (pad < PINMUX_PADS) && bitset_test(mux->owned, pad);
+}
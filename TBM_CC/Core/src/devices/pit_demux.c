@@ -0,0 +1,57 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "pit_demux.h"
+#include "sys/irq_handler.h"
+
+#include <stddef.h>
+
+void
+pit_demux_init(pit_demux_s* demux)
+{
+  uint32_t channel;
+  for (channel = 0; channel < PIT_DEMUX_CHANNELS; channel++)
+  {
+    demux->entries[channel].handler = NULL;
+    demux->entries[channel].ctx     = NULL;
+  }
+  demux->attached = 0;
+  demux->spurious = 0;
+}
+
+void
+pit_demux_attach(pit_demux_s* demux, uint32_t channel, pit_channel_fp handler, void* ctx)
+{
+  if (channel >= PIT_DEMUX_CHANNELS || handler == NULL) { return; }
+
+  // The ISR must never see the new handler with the old context
+  uint32_t primask                = __irq_save__();
+  demux->entries[channel].handler = handler;
+  demux->entries[channel].ctx     = ctx;
+  demux->attached                |= 0x1 << channel;
+  __irq_restore__(primask);
+}
+
+void
+pit_demux_detach(pit_demux_s* demux, uint32_t channel)
+{
+  if (channel >= PIT_DEMUX_CHANNELS) { return; }
+
+  uint32_t primask = __irq_save__();
+  demux->attached &= ~(0x1 << channel);
+  __irq_restore__(primask);
+}
+
+uint32_t
+pit_demux_service(pit_demux_s* demux, volatile pit_channel_regs_s* regs)
+{
+  uint32_t pending = pit_demux_collect(regs);
+  if (pending == 0)
+  {
+    demux->spurious++;
+    return 0;
+  }
+  return pit_demux_dispatch(demux, pending);
+}
@@ -0,0 +1,235 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "soft_timer.h"
+#include "sys/irq_handler.h"
+
+static soft_timer_wheel_s g_soft_timer_wheel;
+
+/** @brief Ceiling division without the (a + b - 1) overflow, 32-bit only (no __aeabi_uldivmod) */
+static inline uint32_t
+__div_round_up__(uint32_t dividend, uint32_t divisor)
+{
+  return (dividend / divisor) + ((dividend % divisor) != 0);
+}
+
+/**
+ * @brief   Hash a timer into its slot, caller holds the critical section
+ * @details Level is picked from the highest set bit of the delta, so no loop
+ *          over the levels: delta < 64 -> 0, < 4096 -> 1, < 2^18 -> 2, else 3.
+ *          Deltas beyond the wheel are parked in the last level at the
+ *          furthest slot, and re-hashed on cascade until they are in range.
+ *          Expiry and 'now' are 64-bit, so late and far-future timers are told
+ *          apart by a compare and not by the sign of a 32-bit difference.
+ **/
+static void
+__soft_timer_enqueue__(soft_timer_wheel_s* wheel, soft_timer_s* timer)
+{
+  uint32_t delta = 0; // Already due (late cascade), fire on this tick
+  if (timer->expires > wheel->now)
+  {
+    uint64_t ahead = timer->expires - wheel->now;
+    delta = (ahead > SOFT_TIMER_MAX_DELTA) ? SOFT_TIMER_MAX_DELTA : (uint32_t)ahead;
+  }
+
+  uint32_t level = (delta < SOFT_TIMER_SLOTS) ? 0 : bits_fls32(delta) / SOFT_TIMER_SLOT_BITS;
+  uint32_t slot  = (((uint32_t)wheel->now + delta) >> (level * SOFT_TIMER_SLOT_BITS)) & SOFT_TIMER_SLOT_MASK;
+
+  timer->level = (uint8_t)level;
+  timer->slot  = (uint8_t)slot;
+  ilist_push_back(&wheel->slots[level][slot], &timer->link);
+  bitset_set(wheel->occupied[level], slot);
+}
+
+/** @brief Unlink from the owning slot, caller holds the critical section */
+static void
+__soft_timer_dequeue__(soft_timer_wheel_s* wheel, soft_timer_s* timer)
+{
+  ilist_unlink(&timer->link);
+  wheel->pending--;
+
+  // The slot may have been spliced out by soft_timer_tick() already, only
+  // clear the occupancy bit when nothing else lives in it
+  if (ilist_empty(&wheel->slots[timer->level][timer->slot]))
+  {
+    bitset_clear(wheel->occupied[timer->level], timer->slot);
+  }
+}
+
+/** @brief Re-hash every timer of level 'level' at the current position into lower levels */
+static void
+__soft_timer_cascade__(soft_timer_wheel_s* wheel, uint32_t level)
+{
+  uint32_t slot = ((uint32_t)wheel->now >> (level * SOFT_TIMER_SLOT_BITS)) & SOFT_TIMER_SLOT_MASK;
+  ilist_s  moving;
+
+  ilist_init(&moving);
+  ilist_splice_back(&moving, &wheel->slots[level][slot]);
+  bitset_clear(wheel->occupied[level], slot);
+
+  ilist_node_s* node;
+  while ((node = ilist_pop_front(&moving)) != NULL)
+  {
+    __soft_timer_enqueue__(wheel, ILIST_ENTRY(node, soft_timer_s, link));
+  }
+}
+
+void
+soft_timer_wheel_init(const timer_datum_s* tick_datum)
+{
+  soft_timer_wheel_s* wheel = &g_soft_timer_wheel;
+  uint32_t primask = __irq_save__();
+
+  for (uint32_t level = 0; level < SOFT_TIMER_LEVELS; level++)
+  {
+    for (uint32_t slot = 0; slot < SOFT_TIMER_SLOTS; slot++) { ilist_init(&wheel->slots[level][slot]); }
+    bitset_zero(wheel->occupied[level], BITSET_WORDS(SOFT_TIMER_SLOTS));
+  }
+
+  uint32_t tick_us = tick_datum->val / PIT_SPEED_MHZ(tick_datum->freq);
+  wheel->tick_us = (tick_us == 0) ? 1 : tick_us; // Sub-micro ticks are clamped, the wheel is not meant for them
+  wheel->now     = 0;
+  wheel->pending = 0;
+
+  __irq_restore__(primask);
+}
+
+void
+soft_timer_init(soft_timer_s* timer)
+{
+  ilist_node_init(&timer->link);
+  timer->expires  = 0;
+  timer->period   = 0;
+  timer->callback = NULL;
+  timer->ctx      = NULL;
+  timer->level    = 0;
+  timer->slot     = 0;
+}
+
+uint8_t
+soft_timer_pending(const soft_timer_s* timer)
+{
+  // A zeroed (.bss) timer has a NULL link, soft_timer_init() leaves it self-pointing
+  return timer->link.next != NULL && ilist_node_linked(&timer->link);
+}
+
+uint32_t
+soft_timer_datum_to_ticks(const timer_datum_s* datum)
+{
+  uint32_t tick_us = (g_soft_timer_wheel.tick_us == 0) ? 1 : g_soft_timer_wheel.tick_us;
+  uint32_t us      = __div_round_up__(datum->val, PIT_SPEED_MHZ(datum->freq));
+  uint32_t ticks   = __div_round_up__(us, tick_us);
+  return (ticks == 0) ? 1 : ticks;
+}
+
+void
+soft_timer_start_ticks(
+  soft_timer_s* timer,
+  uint32_t      delay,
+  uint32_t      period,
+  soft_timer_cb callback,
+  void*         ctx)
+{
+  soft_timer_wheel_s* wheel = &g_soft_timer_wheel;
+  uint32_t primask = __irq_save__();
+
+  if (soft_timer_pending(timer)) { __soft_timer_dequeue__(wheel, timer); }
+
+  // Tick processing increments 'now' before expiring its slot, so a delay of
+  // 0 would land in the slot that has already been run for this tick
+  timer->expires  = wheel->now + ((delay == 0) ? 1 : delay);
+  timer->period   = period;
+  timer->callback = callback;
+  timer->ctx      = ctx;
+  __soft_timer_enqueue__(wheel, timer);
+  wheel->pending++;
+
+  __irq_restore__(primask);
+}
+
+void
+soft_timer_start(
+  soft_timer_s* timer,
+  timer_datum_s delay,
+  soft_timer_cb callback,
+  void*         ctx)
+{
+  soft_timer_start_ticks(timer, soft_timer_datum_to_ticks(&delay), 0, callback, ctx);
+}
+
+void
+soft_timer_start_periodic(
+  soft_timer_s* timer,
+  timer_datum_s period,
+  soft_timer_cb callback,
+  void*         ctx)
+{
+  uint32_t ticks = soft_timer_datum_to_ticks(&period);
+  soft_timer_start_ticks(timer, ticks, ticks, callback, ctx);
+}
+
+void
+soft_timer_stop(soft_timer_s* timer)
+{
+  uint32_t primask = __irq_save__();
+  if (soft_timer_pending(timer)) { __soft_timer_dequeue__(&g_soft_timer_wheel, timer); }
+  __irq_restore__(primask);
+}
+
+uint32_t
+soft_timer_now()
+{
+  return (uint32_t)g_soft_timer_wheel.now;
+}
+
+void
+soft_timer_tick()
+{
+  soft_timer_wheel_s* wheel = &g_soft_timer_wheel;
+  if (wheel->tick_us == 0) { return; } // Not initialized, the slot lists are not set up
+
+  ilist_s  expired;
+  uint32_t primask = __irq_save__();
+
+  uint32_t now  = (uint32_t)++wheel->now;
+  uint32_t slot = now & SOFT_TIMER_SLOT_MASK;
+
+  // Level n + 1 only moves when level n wrapped, stop at the first non-zero index
+  for (uint32_t level = 1; level < SOFT_TIMER_LEVELS; level++)
+  {
+    if (((now >> ((level - 1) * SOFT_TIMER_SLOT_BITS)) & SOFT_TIMER_SLOT_MASK) != 0) { break; }
+    __soft_timer_cascade__(wheel, level);
+  }
+
+  ilist_init(&expired);
+  ilist_splice_back(&expired, &wheel->slots[0][slot]);
+  bitset_clear(wheel->occupied[0], slot);
+
+  // Pop one at a time with interrupts masked, callbacks run unmasked and are
+  // free to stop timers still waiting in 'expired'
+  ilist_node_s* node;
+  while ((node = ilist_pop_front(&expired)) != NULL)
+  {
+    soft_timer_s* timer = ILIST_ENTRY(node, soft_timer_s, link);
+    soft_timer_cb callback = timer->callback;
+    void*         ctx      = timer->ctx;
+
+    if (timer->period != 0)
+    {
+      timer->expires += timer->period; // Anchored to the deadline, no drift from late ticks
+      __soft_timer_enqueue__(wheel, timer);
+    }
+    else
+    {
+      wheel->pending--;
+    }
+
+    __irq_restore__(primask);
+    if (callback != NULL) { callback(ctx); }
+    primask = __irq_save__();
+  }
+
+  __irq_restore__(primask);
+}
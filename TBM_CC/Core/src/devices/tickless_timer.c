@@ -0,0 +1,184 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "tickless_timer.h"
+#include "sys/irq_handler.h"
+
+typedef struct
+{
+  const tickless_hw_s* hw;
+  pit_speed_e          freq;
+  mheap_s              heap;
+  uint64_t             base;    // Absolute PIT ticks at the last arm() / expiry
+  uint32_t             armed;   // Distance programmed by the last arm()
+  uint32_t             wakeups;
+} tickless_sched_s;
+
+static mheap_node_s*    g_tickless_storage[TICKLESS_MAX_TIMERS];
+static tickless_sched_s g_tickless;
+
+/** @brief Current absolute time, caller holds the critical section */
+static inline uint64_t
+__tickless_now__(tickless_sched_s* sched)
+{
+  return sched->base + sched->hw->elapsed();
+}
+
+/** @brief Program the channel for the earliest deadline, caller holds the critical section */
+static void
+__tickless_reprogram__(tickless_sched_s* sched)
+{
+  uint64_t      now   = __tickless_now__(sched);
+  mheap_node_s* next  = mheap_peek(&sched->heap);
+  uint64_t      delta = TICKLESS_MAX_ARM;
+
+  if (next != NULL) { delta = (next->key > now) ? next->key - now : 1; }
+  if (delta > TICKLESS_MAX_ARM) { delta = TICKLESS_MAX_ARM; } // Far deadlines take a few wraps
+
+  // Counted up to the restart, the ticks since 'now' are not lost on every rearm
+  sched->armed  = (uint32_t)delta;
+  sched->base  += sched->hw->arm(sched->armed);
+}
+
+uint32_t
+tickless_datum_to_ticks(const timer_datum_s* datum, pit_speed_e freq)
+{
+  if (datum->freq == freq) { return datum->val; }
+
+  // val * to / from, split so only 32-bit divisions are needed (no __aeabi_uldivmod)
+  uint32_t from  = PIT_SPEED_MHZ(datum->freq);
+  uint32_t to    = PIT_SPEED_MHZ(freq);
+  uint64_t ticks = (uint64_t)(datum->val / from) * to + ((datum->val % from) * to) / from;
+  return (ticks > TICKLESS_MAX_ARM) ? TICKLESS_MAX_ARM : (uint32_t)ticks;
+}
+
+void
+tickless_init(const tickless_hw_s* hw, pit_speed_e freq)
+{
+  uint32_t primask = __irq_save__();
+
+  mheap_init(&g_tickless.heap, g_tickless_storage, TICKLESS_MAX_TIMERS);
+  g_tickless.hw      = hw;
+  g_tickless.freq    = freq;
+  g_tickless.base    = 0;
+  g_tickless.wakeups = 0;
+  g_tickless.armed   = TICKLESS_MAX_ARM;
+  hw->arm(g_tickless.armed);
+
+  __irq_restore__(primask);
+}
+
+void
+tickless_timer_init(tickless_timer_s* timer)
+{
+  mheap_node_init(&timer->node);
+  timer->period   = 0;
+  timer->callback = NULL;
+  timer->ctx      = NULL;
+}
+
+uint8_t
+tickless_start_ticks(
+  tickless_timer_s* timer,
+  uint32_t          delay,
+  uint32_t          period,
+  tickless_cb       callback,
+  void*             ctx)
+{
+  tickless_sched_s* sched = &g_tickless;
+  uint8_t  queued  = 1;
+  uint32_t primask = __irq_save__();
+
+  mheap_remove(&sched->heap, &timer->node);
+  timer->node.key = __tickless_now__(sched) + delay;
+  timer->period   = period;
+  timer->callback = callback;
+  timer->ctx      = ctx;
+
+  queued = mheap_push(&sched->heap, &timer->node);
+
+  // Only a new earliest deadline needs the channel touched
+  if (queued && mheap_peek(&sched->heap) == &timer->node) { __tickless_reprogram__(sched); }
+
+  __irq_restore__(primask);
+  return queued;
+}
+
+uint8_t
+tickless_start(
+  tickless_timer_s* timer,
+  timer_datum_s     delay,
+  tickless_cb       callback,
+  void*             ctx)
+{
+  return tickless_start_ticks(timer, tickless_datum_to_ticks(&delay, g_tickless.freq), 0, callback, ctx);
+}
+
+uint8_t
+tickless_start_periodic(
+  tickless_timer_s* timer,
+  timer_datum_s     period,
+  tickless_cb       callback,
+  void*             ctx)
+{
+  uint32_t ticks = tickless_datum_to_ticks(&period, g_tickless.freq);
+  return tickless_start_ticks(timer, ticks, ticks, callback, ctx);
+}
+
+void
+tickless_stop(tickless_timer_s* timer)
+{
+  uint32_t primask = __irq_save__();
+  mheap_remove(&g_tickless.heap, &timer->node);
+  __irq_restore__(primask);
+}
+
+uint64_t
+tickless_now()
+{
+  uint32_t primask = __irq_save__();
+  uint64_t now     = __tickless_now__(&g_tickless);
+  __irq_restore__(primask);
+  return now;
+}
+
+uint32_t
+tickless_wakeups()
+{
+  return g_tickless.wakeups;
+}
+
+void
+tickless_expire()
+{
+  tickless_sched_s* sched = &g_tickless;
+  uint32_t primask = __irq_save__();
+
+  // The channel reloaded itself at the expiry, elapsed() now counts from there
+  sched->base += sched->armed;
+  sched->wakeups++;
+
+  mheap_node_s* node;
+  while ((node = mheap_peek(&sched->heap)) != NULL && node->key <= __tickless_now__(sched))
+  {
+    tickless_timer_s* timer = MHEAP_ENTRY(node, tickless_timer_s, node);
+    tickless_cb callback    = timer->callback;
+    void*       ctx         = timer->ctx;
+
+    mheap_pop(&sched->heap);
+    if (timer->period != 0)
+    {
+      timer->node.key += timer->period; // Anchored to the deadline, not to the late ISR
+      mheap_push(&sched->heap, &timer->node);
+    }
+
+    __irq_restore__(primask);
+    if (callback != NULL) { callback(ctx); }
+    primask = __irq_save__();
+  }
+
+  __tickless_reprogram__(sched);
+  __irq_restore__(primask);
+}
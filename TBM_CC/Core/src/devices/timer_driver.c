@@ -0,0 +1,158 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "timer_driver.h"
+#include "utils/utimer_mgr.h"
+#include "sys/irq_handler.h"
+
+#include <stddef.h>
+
+static timer_channel_s* g_timer_pool[TIMER_POOL_MAX];
+static uint8_t          g_timer_pool_size;
+
+/** @brief ns * ticks_per_ns (Q32.32) without overflowing, split on the high and low ns word */
+static inline uint64_t
+__timer_ns_to_ticks64__(const timer_channel_s* ch, time_ns64_t ns)
+{
+  uint64_t ns_hi = ns >> 0x20;
+  uint64_t ns_lo = ns & 0xffffffff;
+  return ns_hi * ch->ticks_per_ns + ((ns_lo * ch->ticks_per_ns) >> 0x20);
+}
+
+void
+timer_channel_setup(
+  timer_channel_s*          ch,
+  const timer_driver_ops_s* ops,
+  timer_type_e              type,
+  uint8_t                   unit,
+  uint8_t                   index,
+  uint8_t                   caps,
+  uint32_t                  freq_hz,
+  uint32_t                  max_ticks)
+{
+  ch->ops          = ops;
+  ch->type         = type;
+  ch->unit         = unit;
+  ch->index        = index;
+  ch->caps         = caps;
+  ch->allocated    = 0;
+  ch->config       = 0;
+  ch->freq_hz      = freq_hz;
+  ch->max_ticks    = max_ticks;
+  ch->ticks_per_ns = time_ns64_to_q32(freq_hz) + 1; // hz * 2^32 / 10^9, rounded up so deadlines never fire early
+  ch->callback     = NULL;
+  ch->ctx          = NULL;
+  ch->irq_slot.attached = 0;
+}
+
+uint32_t
+timer_channel_ns_to_ticks(const timer_channel_s* ch, time_ns64_t ns)
+{
+  uint64_t ticks = __timer_ns_to_ticks64__(ch, ns);
+  if (ticks > ch->max_ticks) { return ch->max_ticks; }
+  return (ticks == 0) ? 1 : (uint32_t)ticks;
+}
+
+uint8_t
+timer_channel_reaches(const timer_channel_s* ch, time_ns64_t ns)
+{
+  return __timer_ns_to_ticks64__(ch, ns) <= ch->max_ticks;
+}
+
+void
+timer_channel_arm_ns(timer_channel_s* ch, time_ns64_t ns, timer_channel_cb callback, void* ctx)
+{
+  uint32_t primask = __irq_save__();
+  ch->callback     = callback;
+  ch->ctx          = ctx;
+  ch->ops->arm(ch, timer_channel_ns_to_ticks(ch, ns));
+  __irq_restore__(primask);
+}
+
+void
+timer_channel_cancel(timer_channel_s* ch)
+{
+  uint32_t primask = __irq_save__();
+  ch->ops->cancel(ch);
+  ch->callback = NULL;
+  __irq_restore__(primask);
+}
+
+void
+timer_channel_expired(timer_channel_s* ch)
+{
+  timer_channel_cb callback = ch->callback;
+  if (callback != NULL) { callback(ch->ctx); }
+}
+
+uint8_t
+timer_pool_add(timer_channel_s* ch)
+{
+  if (g_timer_pool_size >= TIMER_POOL_MAX) { return 0; }
+
+  ch->allocated = 0;
+  ch->ops->configure(ch);
+  g_timer_pool[g_timer_pool_size++] = ch;
+  return 1;
+}
+
+/**
+ * @brief   a covers a longer time than b (max_ticks / freq)
+ * @details Cross multiplied so no division is needed, both products fit 64 bits.
+ **/
+static inline uint8_t
+__timer_longer_range__(const timer_channel_s* a, const timer_channel_s* b)
+{
+  return (uint64_t)a->max_ticks * b->freq_hz > (uint64_t)b->max_ticks * a->freq_hz;
+}
+
+timer_channel_s*
+timer_pool_alloc(time_ns64_t ns, uint8_t caps)
+{
+  timer_channel_s* best_fit   = NULL; // Reaches 'ns', finest resolution
+  timer_channel_s* best_range = NULL; // Fallback, longest range
+  uint8_t idx;
+
+  uint32_t primask = __irq_save__();
+
+  for (idx = 0; idx < g_timer_pool_size; idx++)
+  {
+    timer_channel_s* ch = g_timer_pool[idx];
+    if (ch->allocated || (ch->caps & caps) != caps || (ch->caps & TIMER_CAP_RESETS)) { continue; }
+
+    if (timer_channel_reaches(ch, ns))
+    {
+      if (best_fit == NULL
+          || ch->freq_hz > best_fit->freq_hz
+          || (ch->freq_hz == best_fit->freq_hz && __timer_longer_range__(best_fit, ch)))
+      {
+        best_fit = ch;
+      }
+    }
+
+    if (best_range == NULL || __timer_longer_range__(ch, best_range)) { best_range = ch; }
+  }
+
+  timer_channel_s* chosen = (best_fit != NULL) ? best_fit : best_range;
+  if (chosen != NULL) { chosen->allocated = 1; }
+
+  __irq_restore__(primask);
+  return chosen;
+}
+
+void
+timer_pool_free(timer_channel_s* ch)
+{
+  timer_channel_cancel(ch);
+  ch->allocated = 0;
+}
+
+void
+timer_pool_reset()
+{
+  uint32_t primask  = __irq_save__();
+  g_timer_pool_size = 0;
+  __irq_restore__(primask);
+}
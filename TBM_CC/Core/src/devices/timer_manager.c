@@ -10,6 +10,7 @@
 #include "sys/registers.h"
 
 #include "iomux_controller.h"
+#include "iomux_manager.h"
 
 // Globals
 timer_manager_s glob_gptman[6];
@@ -27,7 +28,17 @@ init_gptman(timer_manager_s* restrict gptman,
             timer_manager_cb interrupt_callback)
 {
   void* context = gptman->timer_ctx->context;
-  CONTEXT_TO_GPT(context)->gpt_x = gpt_x;
+  CONTEXT_TO_GPT(context)->gpt_x   = gpt_x;
+  CONTEXT_TO_GPT(context)->ocr_ch  = ocr_ch;
+  CONTEXT_TO_GPT(context)->gpt_clk = gpt_clk;
+
+  gptman->clk_src            = gpt_clk;
+  gptman->time_type          = time_type;
+  gptman->targetval          = compval;
+  gptman->interrupt_callback = interrupt_callback;
+  gptman->tick_callback      = NULL;
+  gptman->keep_ticking       = 1;
+  gptman->irq_slot.attached  = 0;
 }
 /**
  *
@@ -92,6 +103,22 @@ __set_callback_gpt__(timer_manager_s* restrict gptman,
   gptman->interrupt_callback = interrupt_callback;
 }
 
+/** @brief GPT line slot of a timer_manager_s, only its own compare channel */
+static void
+__gpt_manager_isr__(void* ctx)
+{
+  timer_manager_s* gptman  = (timer_manager_s*)ctx;
+  gpt_context_s*   gpt_ctx = CONTEXT_TO_GPT(gptman->timer_ctx->context);
+  uint32_t         bit     = 0x1 << ((uint8_t)gpt_ctx->ocr_ch % 3); // OF1..OF3
+
+  if (GPT_REGS(gpt_ctx->gpt_x).SR & GPT_REGS(gpt_ctx->gpt_x).IR & bit)
+  {
+    GPT_REGS(gpt_ctx->gpt_x).SR = bit; // Write 1 to clear
+    if (gptman->interrupt_callback != NULL) { gptman->interrupt_callback(); }
+  }
+  __asm__ volatile("dsb");
+}
+
 void
 __set_comparator_gpt__(timer_manager_s* restrict gptman)
 {
@@ -100,11 +127,7 @@ __set_comparator_gpt__(timer_manager_s* restrict gptman)
     case GPT1_E:
       // set GPT1f_IR fields: {ROVIE,IF1IE,IF2IE,OF1IE,OF2IE,OF3IE} = 1
       GPT1_IR_EN(ENABLE);
-
-      /**
-       * @todo @at Point to internal callback in irq vector table
-       **/
-      // add_to_irq_v(IRQ_GPT2, callback_gpt2);
+      irq_attach(&gptman->irq_slot, IRQ_GPT1, &__gpt_manager_isr__, gptman);
 
       switch (CONTEXT_TO_GPT(context)->ocr_ch) 
       {
@@ -130,11 +153,7 @@ __set_comparator_gpt__(timer_manager_s* restrict gptman)
     case GPT2_E:
       // set GPT2_IR fields: {ROVIE,IF1IE,IF2IE,OF1IE,OF2IE,OF3IE} = 1
       GPT2_IR_EN(ENABLE);
-
-      /**
-       * @todo @at Point to internal callback in irq vector table
-       **/
-      // add_to_irq_v(IRQ_GPT2, callback_gpt2);
+      irq_attach(&gptman->irq_slot, IRQ_GPT2, &__gpt_manager_isr__, gptman);
 
       switch (CONTEXT_TO_GPT(context)->ocr_ch) 
       {
@@ -187,17 +206,21 @@ set_time(timer_manager_s* restrict gptman,
                     // and 2 maybe
 }
 
+void
+__route_gpt2_capin1__()
+{
+  // Connect GPS 1PPS signal to pin 15 (GPIO_AD_B1_03), a no-op once the board table has it
+  static const pinmux_entry_s capin1 = IOMUX_GPT2_CAPIN1_PIN15;
+  iomux_route(&capin1);
+}
+
 void
 __setup_gpt2__()
 {
   // pinMode(13, OUTPUT);
   // analogWriteFrequency(14, 100);  // test with PWM
   // analogWrite(14, 128); // jumper pwm 14  to pin 15  Serial3 on T4B2 breakout
-  // Connect GPS 1PPS signal to pin 15 (GPIO_AD_B1_03)
-  IOMUXC_GPT2_IPP_IND_CAPIN1__SLCT_IN_DR = 0x1; // remap GPT2 capture 1
-  IOMUXC_MUX_PAD_GPIO_AD_B1_CR03 = 0x8;         // GPT2 Capture1
-  IOMUXC_PAD_PAD_GPIO_AD_B1_CR03 = PAD_HYST_ENABLED | PAD_100KOHM_DOWN |
-                                   PAD_SLCT_PULLER | PAD_PULLKEEP_ENABLED;
+  // Pin 15 is muxed by iomux_board_init(), set_time() no longer re-muxes it on every call
 
   GPT2_CR = DISABLE;
   GPT2_PR = DISABLE;
@@ -242,73 +265,88 @@ init_pitman(timer_manager_s* restrict pitman,
   pitman->keep_ticking = 1; // keep tick alive, and be used to kill the tick within itself if some condition is met
 
   pitman->tick_callback      = tick_callback;
+  pitman->irq_slot.attached  = 0;
   
-  pitman->targetval = resolve_time(timerdatum->freq, timerdatum->type, timerdatum->val, FROMTIME_E);
+  pitman->targetval = (timerdatum->val > 0) ? timerdatum->val - 1 : 0; // LDVAL, already ticks (generate_time_struct)
 }
 
-//
-// Work-around until I figure out my mistake in the resolve time functions
-#define base_div(x) (24)*(x); targetval *= 10;
 uint32_t resolve_time(pit_speed_e freq, timetype_e time_type, uint32_t targetval, ttconversiondir_e conversiondir)
 {
-  switch (freq) 
+  switch (conversiondir)
   {
-    case PIT_SPEED_50MHz:
-      targetval  = __resolve_time_50MHz__(targetval, time_type, conversiondir); 
-      // targetval /= base_div(1);
-      break;
-    case PIT_SPEED_100MHz:
-      targetval  = __resolve_time_100MHz__(targetval, time_type, conversiondir);
-      // targetval /= base_div(2);
-      break;
-    case PIT_SPEED_150MHz:
-      targetval  = __resolve_time_150MHz__(targetval, time_type, conversiondir);
-      // targetval /= base_div(3);
-      break;
-    case PIT_SPEED_200MHz:
-      targetval  = __resolve_time_200MHz__(targetval, time_type, conversiondir);
-      // targetval /= base_div(4);
-      break;
+    default:
+    case FROMTIME_E:  return time_to_ticks(freq, time_type, targetval);
+    case FROMTICKS_E: return ticks_to_time(freq, time_type, targetval);
+  }
+}
 
-    default: break;
-  }  
+timer_datum_s generate_time_struct(pit_speed_e freq, timetype_e type, uint32_t timeval)
+{
+  timeval                  = resolve_time(freq, type, timeval, FROMTIME_E);
+  timer_datum_s timerdatum = {.type = type, .freq = freq, .val = timeval};
+  return timerdatum;
+}
+
+void dummy_tick(time_ns64_t dummy){ return; };
 
-  return targetval;
+// Every PIT channel shares IRQ_PIT, the tick path skips the IPSR lookup
+IRQ_DISPATCH_TRAMPOLINE(__pit_line_isr__, IRQ_PIT)
+
+static pit_demux_s g_pit_demux;
+static irq_slot_s  g_pit_demux_slot;
+
+/** @brief The one slot on IRQ_PIT, scans the four channels and runs their handlers */
+static void
+__pit_demux_isr__(void* ctx)
+{
+  pit_demux_service((pit_demux_s*)ctx, &PIT_CHANNEL(PIT_TIMER_00));
+  __asm__ volatile("dsb"); // Flag clears reach the PIT before the exception returns
 }
 
-float resolve_time_as_float(pit_speed_e freq, timetype_e time_resolution, uint32_t targetval, ttconversiondir_e conversiondir)
+void
+pit_channel_attach(pit_timer_e pit_timerx, pit_channel_fp handler, void* ctx)
 {
-    float fDeltaTime = resolve_time(freq, time_resolution, targetval, conversiondir);
-    punned_float_u punned_float = {.AsInt32 = fDeltaTime};
+  if (!g_pit_demux_slot.attached)
+  {
+    pit_demux_init(&g_pit_demux);
+    irq_attach(&g_pit_demux_slot, IRQ_PIT, &__pit_demux_isr__, &g_pit_demux);
+    irq_dispatch_fast(IRQ_PIT, &__pit_line_isr__);
+    NVIC_SET_PRIORITY(IRQ_PIT, 0x0);
+    NVIC_ENABLE_IRQ(IRQ_PIT);
+  }
+  pit_demux_attach(&g_pit_demux, (uint32_t)pit_timerx, handler, ctx);
+}
 
-    float fDivisor = 1.0;
-    switch (time_resolution)
-    {
-    case DAYS_E: fDivisor = 1.f / 86400.f; break;
-    case HOURS_E: fDivisor = 1.f / 3600.f; break;
-    case MINUTES_E: fDivisor = 1.f / 60.f; break;
-    case MILLIS_E: fDivisor = 1000.f; break; // milli-seconds, 10E-3
-    case MICROS_E: fDivisor = 1000000.f; break; // micro-seconds, 10E-6
-    case ZETTOS_E: fDivisor = 10000000.f; break; // zetto-seconds, 10E-7
-    case YOTTOS_E: fDivisor = 100000000.f; break; // yotto-seconds, 10E-8
-    case NANOS_E: fDivisor = 1000000000.f; break;  // nano-seconds,  10E-9
-    default: break;
-    }
+void
+pit_channel_detach(pit_timer_e pit_timerx)
+{
+  pit_demux_detach(&g_pit_demux, (uint32_t)pit_timerx);
+}
 
-    return punned_float.AsFloat / fDivisor; // convert from milliseconds to seconds  
+void
+pit_channel_start(pit_timer_e pit_timerx, uint32_t ldval, pit_channel_fp handler, void* ctx)
+{
+  __pit_enable_clock__();
+  pit_channel_attach(pit_timerx, handler, ctx);
+  pit_rearm(pit_timerx, ldval);
 }
 
+void
+pit_channel_stop(pit_timer_e pit_timerx)
+{
+  PIT_CHANNEL(pit_timerx).TCTRL = 0;
+  PIT_CHANNEL(pit_timerx).TFLG  = 0x1;
+  pit_channel_detach(pit_timerx);
+}
 
-timer_datum_s generate_time_struct(pit_speed_e freq, timetype_e type, uint32_t timeval)
+/** @brief PIT channel handler of a timer_manager_s, the demux has cleared the flag already */
+static void
+__pit_manager_isr__(void* ctx)
 {
-  timeval                  = resolve_time(freq, type, timeval, FROMTIME_E);
-  timer_datum_s timerdatum = {.type = type, .freq = freq, .val = timeval};
-  return timerdatum;
+  ((timer_manager_s*)ctx)->interrupt_callback();
 }
 
-timer_manager_cb*       GCachedInterruptCallbackPIT;
-void dummy_tick(float dummy){ return; };
-void setup_PITx(timer_manager_s* restrict pitman)
+void pit_configure(timer_manager_s* restrict pitman)
 {
   //
   // Resolve the previously stored timer context
@@ -318,14 +356,7 @@ void setup_PITx(timer_manager_s* restrict pitman)
   // Set the interrupt callback and enable the interrupt vector
   if (pitman->interrupt_callback != NULL) 
   { 
-    if ((&pitman->interrupt_callback) != GCachedInterruptCallbackPIT) 
-    {
-      GCachedInterruptCallbackPIT = &pitman->interrupt_callback;
-      add_to_irq_v(IRQ_PIT, pitman->interrupt_callback);
-    }
-
-    NVIC_SET_PRIORITY(IRQ_PIT, 0x0);
-    NVIC_ENABLE_IRQ(IRQ_PIT);
+    pit_channel_attach(PIT_TIMER_00, &__pit_manager_isr__, pitman); // Re-attaching only swaps the entry
   }
 
   // Select an appropriate clock root
@@ -364,71 +395,458 @@ void setup_PITx(timer_manager_s* restrict pitman)
   IOMUXC_PAD_PAD_GPIO_AD_B0_CR04 &= (~(0x3 << 0x6) | (freq << 0x6)); 
 
   // Reset pit registers due to bootimage config, p200 ref man
+  // Channels 2 and 3 are left alone, they are the monotonic clock (monotonic_clock.h)
   PIT_MCR = 1;
-  PIT_LDVAL0 = PIT_LDVAL1 = PIT_LDVAL2 = PIT_LDVAL3 = 0;
-  PIT_TCTRL0 = PIT_TCTRL1 = PIT_TCTRL2 = PIT_TCTRL3 = 0;
-  PIT_TFLG0  = PIT_TFLG1  = PIT_TFLG2  = PIT_TFLG3  = 1;
+  PIT_LDVAL0 = PIT_LDVAL1 = 0;
+  PIT_TCTRL0 = PIT_TCTRL1 = 0;
+  PIT_TFLG0  = PIT_TFLG1  = 1;
 
   IOMUXC_GPR_GPR01 &= ~(0x1 << 0xc) | (0x1 << 0xc); // Set bit at idx 0xc (12)
   PIT_MCR_SET(MCR_RESET);
 
   // Set the PIT load value and enable the timer
-  PIT_LDVAL0 = PIT_LDVAL1 = PIT_LDVAL2 = PIT_LDVAL3 = pitman->targetval;
-  PIT_TCTRL0 = 3; PIT_TCTRL1 = PIT_TCTRL2 = PIT_TCTRL3 = 2; // Only enable Timer 1, figure out proper abstractions later
+  PIT_LDVAL0 = PIT_LDVAL1 = pitman->targetval;
+  PIT_TCTRL0 = 3; PIT_TCTRL1 = 2; // Only enable Timer 1, figure out proper abstractions later
 }
 
 void
 setup_pit_irq(timer_manager_s* restrict pitman, pit_timer_e pit_timerx)
 {
-  add_to_irq_v(IRQ_PIT, pitman->interrupt_callback);
+  pit_channel_attach(pit_timerx, &__pit_manager_isr__, pitman);
   reset_pit(pitman, pit_timerx);
 }
 
 void
 reset_pit(timer_manager_s* restrict pitman, pit_timer_e pit_timerx)
 {
-  // turn on PIT
-  PIT_MCR_SET(MCR_RESET);
-  // Push callback to interrupt vector
-  pit_context_s* restrict pitctx = CONTEXT_TO_PIT(pitman->timer_ctx->context);
+  PIT_MCR_SET(MCR_RESET); // turn on PIT
+  pit_rearm(pit_timerx, pitman->targetval); // Resolved once in init_pitman()
+}
 
-  switch (pitctx->freq)
+
+void
+__pit_enable_clock__()
+{
+  CCM_SLCT_PERCLK_SRC(IPG_ROOT);
+  CCM_SCMUX1_DIV_SET(PC_DIV7);
+  CCM_SET_PIT_ENABLE(CLK_ON_ALL_MODES);
+  PIT_MCR_SET(MCR_RESET); // MDIS = 0, the module runs
+}
+
+/* Tickless scheduler backend on PIT channel 0, see tickless_timer.h */
+
+static uint32_t
+__tickless_pit0_elapsed__(void)
+{
+  uint32_t ldval   = PIT_LDVAL0;
+  uint32_t flag    = PIT_TFLG0 & 0x1;
+  uint32_t cval    = PIT_CVAL0;
+
+  // Expired between the two flag reads, 'cval' may be from either side of the reload
+  if ((PIT_TFLG0 & 0x1) != flag)
   {
-  case PIT_SPEED_50MHz:  
-    PIT_LOADVAL0_SET(
-        __resolve_time_50MHz__(pitman->targetval, pitman->time_type, FROMTIME_E));
-    break;
-  case PIT_SPEED_100MHz:
-    PIT_LOADVAL0_SET(
-        __resolve_time_100MHz__(pitman->targetval, pitman->time_type, FROMTIME_E));
-    break;
-  case PIT_SPEED_150MHz: 
-    PIT_LOADVAL0_SET(
-        __resolve_time_150MHz__(pitman->targetval, pitman->time_type, FROMTIME_E));
-    break;
-  case PIT_SPEED_200MHz:
-    PIT_LOADVAL0_SET(
-        __resolve_time_200MHz__(pitman->targetval, pitman->time_type, FROMTIME_E));
-    break;
+    flag = 0x1;
+    cval = PIT_CVAL0;
+  }
+
+  // Expired but not handled yet (called with interrupts masked), the count has already reloaded
+  return flag ? ldval + 1 + (ldval - cval) : ldval - cval;
+}
+
+static uint32_t
+__tickless_pit0_arm__(uint32_t ticks)
+{
+  uint32_t elapsed = __tickless_pit0_elapsed__(); // Last read before the count restarts
+  pit_rearm(PIT_TIMER_00, ticks - 1); // Counts LDVAL..0, i.e. LDVAL + 1 ticks per period
+  return elapsed;
+}
+
+static void
+__tickless_pit0_isr__(void* ctx)
+{
+  // Only runs for a set TIF, a rearm from thread context which left the NVIC request pending is dropped by the demux
+  tickless_expire();
+}
+
+void
+init_tickless_PIT0(pit_speed_e freq)
+{
+  static const tickless_hw_s pit0_hw = {
+    .arm     = &__tickless_pit0_arm__,
+    .elapsed = &__tickless_pit0_elapsed__,
+  };
+
+  __pit_enable_clock__();
+  PIT_TCTRL0 = 0;
+  PIT_TFLG0  = 1;
+
+  pit_channel_attach(PIT_TIMER_00, &__tickless_pit0_isr__, NULL);
+
+  tickless_init(&pit0_hw, freq);
+}
+
+
+/* Generic timer driver backends, see timer_driver.h */
+
+static uint8_t g_gpt_channel_mask[2]; // Configured compare channels per GPT, the first one resets the module
+
+// PIT
+
+static void
+__pit_channel_isr__(void* ctx)
+{
+  timer_channel_s* ch = (timer_channel_s*)ctx;
+  PIT_CHANNEL(ch->index).TCTRL = 0; // One-shot, the PIT would reload and fire again
+  timer_channel_expired(ch);
+}
+
+static void
+__pit_channel_configure__(timer_channel_s* ch)
+{
+  __pit_enable_clock__();
+  PIT_CHANNEL(ch->index).TCTRL = 0;
+  PIT_CHANNEL(ch->index).TFLG  = 0x1;
+
+  pit_channel_attach((pit_timer_e)ch->index, &__pit_channel_isr__, ch);
+}
+
+static void
+__pit_channel_arm__(timer_channel_s* ch, uint32_t ticks)
+{
+  pit_rearm((pit_timer_e)ch->index, ticks - 1);
+}
+
+static void
+__pit_channel_cancel__(timer_channel_s* ch)
+{
+  PIT_CHANNEL(ch->index).TCTRL = 0;
+  PIT_CHANNEL(ch->index).TFLG  = 0x1;
+}
+
+static uint32_t
+__pit_channel_read__(timer_channel_s* ch)
+{
+  return PIT_CHANNEL(ch->index).LDVAL - PIT_CHANNEL(ch->index).CVAL; // Down-counter, ticks since arm
+}
+
+static const timer_driver_ops_s g_pit_ops = {
+  .configure = &__pit_channel_configure__,
+  .arm       = &__pit_channel_arm__,
+  .cancel    = &__pit_channel_cancel__,
+  .read      = &__pit_channel_read__,
+  .capture   = NULL,
+};
+
+void
+timer_channel_pit(timer_channel_s* ch, pit_timer_e pit_timerx, pit_speed_e freq)
+{
+  timer_channel_setup(ch, &g_pit_ops, PIT_E, 0, (uint8_t)pit_timerx & 0x1,
+                      TIMER_CAP_ONESHOT | TIMER_CAP_READ,
+                      PIT_SPEED_MHZ(freq) * 1000000UL, 0xffffffff);
+}
+
+// GPT
+
+static void
+__gpt_channel_isr__(void* ctx)
+{
+  timer_channel_s* ch    = (timer_channel_s*)ctx;
+  gptx_e           gpt_x = (gptx_e)ch->unit;
+  uint32_t         bit   = 0x1 << ch->index; // OF1..OF3
+
+  if (!(GPT_REGS(gpt_x).SR & GPT_REGS(gpt_x).IR & bit)) { return; }
+
+  GPT_REGS(gpt_x).SR  = bit; // Write 1 to clear
+  GPT_REGS(gpt_x).IR &= ~bit; // One-shot
+  timer_channel_expired(ch);
+  __asm__ volatile("dsb");
+}
+
+static void
+__gpt_channel_configure__(timer_channel_s* ch)
+{
+  gptx_e    gpt_x = (gptx_e)ch->unit;
+  irq_num_e irq   = (gpt_x == GPT1_E) ? IRQ_GPT1 : IRQ_GPT2;
+
+  // The three compare channels share the counter, only the first one resets the module
+  if (g_gpt_channel_mask[gpt_x] == 0)
+  {
+    if (gpt_x == GPT1_E) { CCM_C_GPT1_EN; } else { CCM_C_GPT2_EN; }
+
+    GPT_REGS(gpt_x).CR = 0;
+    GPT_REGS(gpt_x).IR = 0;
+    GPT_REGS(gpt_x).CR = GPT_CR_RESET;
+    while (GPT_REGS(gpt_x).CR & GPT_CR_RESET) {}
+
+    GPT_REGS(gpt_x).PR = 0; // 24M prescaler /1
+    GPT_REGS(gpt_x).SR = 0x3f;
+    GPT_REGS(gpt_x).CR = GPT_CR_CLKSRC(0x0, SRC_IPG_CLK_24M) | GPT_CR_EN_24M | GPT_CR_FRR;
+    GPT_REGS(gpt_x).CR = GPT_CR_SET_EN(GPT_REGS(gpt_x).CR, ENABLE);
+
+    NVIC_SET_PRIORITY(irq, 0x0);
+    NVIC_ENABLE_IRQ(irq);
   }
 
-  switch (pit_timerx)
+  // Capture on the rising edge, harmless until the pad is muxed (see __setup_gpt2__())
+  if (ch->index < 2) { GPT_REGS(gpt_x).CR |= (0x1 << (0x10 + (ch->index << 0x1))); }
+
+  g_gpt_channel_mask[gpt_x] |= (uint8_t)(0x1 << ch->index);
+  irq_attach(&ch->irq_slot, irq, &__gpt_channel_isr__, ch);
+}
+
+static void
+__gpt_channel_arm__(timer_channel_s* ch, uint32_t ticks)
+{
+  gptx_e   gpt_x = (gptx_e)ch->unit;
+  uint32_t bit   = 0x1 << ch->index;
+
+  GPT_REGS(gpt_x).IR &= ~bit;
+  GPT_REGS(gpt_x).OCR[ch->index] = GPT_REGS(gpt_x).CNT + ticks; // Free-run, compare against the shared counter
+  GPT_REGS(gpt_x).SR  = bit;
+  GPT_REGS(gpt_x).IR |= bit;
+}
+
+static void
+__gpt_channel_cancel__(timer_channel_s* ch)
+{
+  gptx_e   gpt_x = (gptx_e)ch->unit;
+  uint32_t bit   = 0x1 << ch->index;
+
+  GPT_REGS(gpt_x).IR &= ~bit;
+  GPT_REGS(gpt_x).SR  = bit;
+}
+
+static uint32_t
+__gpt_channel_read__(timer_channel_s* ch)
+{
+  return GPT_REGS((gptx_e)ch->unit).CNT;
+}
+
+static uint32_t
+__gpt_channel_capture__(timer_channel_s* ch)
+{
+  return (ch->index < 2) ? GPT_REGS((gptx_e)ch->unit).ICR[ch->index] : 0;
+}
+
+static const timer_driver_ops_s g_gpt_ops = {
+  .configure = &__gpt_channel_configure__,
+  .arm       = &__gpt_channel_arm__,
+  .cancel    = &__gpt_channel_cancel__,
+  .read      = &__gpt_channel_read__,
+  .capture   = &__gpt_channel_capture__,
+};
+
+void
+timer_channel_gpt(timer_channel_s* ch, gptx_e gpt_x, gpt_ocr_e ocr_ch)
+{
+  uint8_t caps = TIMER_CAP_ONESHOT | TIMER_CAP_READ | ((ocr_ch < OCR_CH3) ? TIMER_CAP_CAPTURE : 0);
+  timer_channel_setup(ch, &g_gpt_ops, GPT_E, (uint8_t)gpt_x & 0x1, (uint8_t)ocr_ch % 3,
+                      caps, TIMER_GPT_HZ, 0xffffffff);
+}
+
+// QuadTimer
+
+/** @brief CCM_CCGR6 gate bit offset per unit (TMR1..TMR4) */
+static const uint8_t g_qtimer_ccgr6_shift[4] = {0x1a, 0x1c, 0x1e, 0x10};
+
+static void
+__qtimer_channel_isr__(void* ctx)
+{
+  timer_channel_s* ch    = (timer_channel_s*)ctx;
+  uint16_t         sctrl = QTIMER_CHANNEL(ch->unit, ch->index).SCTRL;
+
+  if ((sctrl & TMR_SCTRL_TCF) && (sctrl & TMR_SCTRL_TCFIE))
   {
-  case PIT_TIMER_00:
-    PIT_TCTRL0_IRQ_EN(ENABLE);   // enable Timer 1 interrupts
-    PIT_TCTRL0_TIMER_EN(ENABLE); // start Timer 1
-    break;
-  case PIT_TIMER_01:
-    PIT_TCTRL1_IRQ_EN(ENABLE);   // enable Timer 2 interrupts
-    PIT_TCTRL1_TIMER_EN(ENABLE); // start Timer 2
-    break;
-  case PIT_TIMER_02:
-    PIT_TCTRL2_IRQ_EN(ENABLE);   // enable Timer 3 interrupts
-    PIT_TCTRL2_TIMER_EN(ENABLE); // start Timer 3
-    break;
-  case PIT_TIMER_03:
-    PIT_TCTRL3_IRQ_EN(ENABLE);   // enable Timer 4 interrupts
-    PIT_TCTRL3_TIMER_EN(ENABLE); // start Timer 4
-    break;    
+    QTIMER_CHANNEL(ch->unit, ch->index).CTRL  = 0;
+    QTIMER_CHANNEL(ch->unit, ch->index).SCTRL = sctrl & ~(TMR_SCTRL_TCF | TMR_SCTRL_TCFIE);
+    timer_channel_expired(ch);
+  }
+  __asm__ volatile("dsb");
+}
+
+static void
+__qtimer_channel_configure__(timer_channel_s* ch)
+{
+  irq_num_e irq = (irq_num_e)(IRQ_QTIMER1 + ch->unit);
+
+  CCM_C_CGR6 |= (uint32_t)CLK_ON__NO_STOP << g_qtimer_ccgr6_shift[ch->unit];
+
+  QTIMER_CHANNEL(ch->unit, ch->index).CTRL   = 0;
+  QTIMER_CHANNEL(ch->unit, ch->index).CSCTRL = 0;
+  QTIMER_CHANNEL(ch->unit, ch->index).LOAD   = 0;
+  QTIMER_CHANNEL(ch->unit, ch->index).CNTR   = 0;
+  QTIMER_CHANNEL(ch->unit, ch->index).SCTRL  = TMR_SCTRL_CAPTURE_MODE(0x1); // Capture on the rising edge
+  QTIMER_CHANNEL(ch->unit, 0).ENBL |= (uint16_t)(0x1 << ch->index);
+
+  irq_attach(&ch->irq_slot, irq, &__qtimer_channel_isr__, ch);
+  NVIC_SET_PRIORITY(irq, 0x0);
+  NVIC_ENABLE_IRQ(irq);
+}
+
+static void
+__qtimer_channel_arm__(timer_channel_s* ch, uint32_t ticks)
+{
+  QTIMER_CHANNEL(ch->unit, ch->index).CTRL   = 0;
+  QTIMER_CHANNEL(ch->unit, ch->index).SCTRL  = (QTIMER_CHANNEL(ch->unit, ch->index).SCTRL & ~TMR_SCTRL_TCF) | TMR_SCTRL_TCFIE;
+  QTIMER_CHANNEL(ch->unit, ch->index).CNTR   = 0;
+  QTIMER_CHANNEL(ch->unit, ch->index).COMP1  = (uint16_t)ticks;
+  QTIMER_CHANNEL(ch->unit, ch->index).CTRL   = TMR_CTRL_CM(0x1) | TMR_CTRL_PCS(0x8 + ch->config)
+                                             | TMR_CTRL_ONCE | TMR_CTRL_LENGTH; // Count up to COMP1 once
+}
+
+static void
+__qtimer_channel_cancel__(timer_channel_s* ch)
+{
+  QTIMER_CHANNEL(ch->unit, ch->index).CTRL  = 0;
+  QTIMER_CHANNEL(ch->unit, ch->index).SCTRL &= ~(TMR_SCTRL_TCF | TMR_SCTRL_TCFIE);
+}
+
+static uint32_t
+__qtimer_channel_read__(timer_channel_s* ch)
+{
+  return QTIMER_CHANNEL(ch->unit, ch->index).CNTR;
+}
+
+static uint32_t
+__qtimer_channel_capture__(timer_channel_s* ch)
+{
+  return QTIMER_CHANNEL(ch->unit, ch->index).CAPT;
+}
+
+static const timer_driver_ops_s g_qtimer_ops = {
+  .configure = &__qtimer_channel_configure__,
+  .arm       = &__qtimer_channel_arm__,
+  .cancel    = &__qtimer_channel_cancel__,
+  .read      = &__qtimer_channel_read__,
+  .capture   = &__qtimer_channel_capture__,
+};
+
+void
+timer_channel_qtimer(timer_channel_s* ch, uint8_t unit, uint8_t index, uint8_t prescale_log2)
+{
+  timer_channel_setup(ch, &g_qtimer_ops, QUAD_E, unit & 0x3, index & 0x3,
+                      TIMER_CAP_ONESHOT | TIMER_CAP_READ | TIMER_CAP_CAPTURE,
+                      TIMER_IPG_HZ >> (prescale_log2 & 0x7), 0xffff);
+  ch->config = prescale_log2 & 0x7; // IPG bus clock / 2^n, PCS 0x8..0xf
+}
+
+// RTWDOG
+
+/** @brief Open the 255 bus clock update window, caller holds the critical section */
+static inline void
+__rtwdog_unlock__(void)
+{
+  RTWDOG_REGS.CNT = RTWDOG_UNLOCK_KEY;
+  while (!(RTWDOG_REGS.CS & RTWDOG_CS_ULK)) {}
+}
+
+static void
+__rtwdog_channel_isr__(void* ctx)
+{
+  RTWDOG_REGS.CS |= RTWDOG_CS_FLG; // Write 1 to clear, the reset follows regardless
+  timer_channel_expired((timer_channel_s*)ctx);
+  __asm__ volatile("dsb");
+}
+
+static void
+__rtwdog_channel_configure__(timer_channel_s* ch)
+{
+  CCM_C_CGR5 |= (uint32_t)CLK_ON__NO_STOP << 0x4; // CG2, wdog3
+
+  uint32_t primask = __irq_save__();
+  __rtwdog_unlock__();
+  RTWDOG_REGS.TOVAL = 0xffff;
+  RTWDOG_REGS.CS    = RTWDOG_CS_UPDATE | RTWDOG_CS_CMD32EN | RTWDOG_CS_CLK_LPO; // Stopped, reconfigurable
+  __irq_restore__(primask);
+
+  irq_attach(&ch->irq_slot, IRQ_RTWDOG, &__rtwdog_channel_isr__, ch);
+  NVIC_SET_PRIORITY(IRQ_RTWDOG, 0x0);
+  NVIC_ENABLE_IRQ(IRQ_RTWDOG);
+}
+
+static void
+__rtwdog_channel_arm__(timer_channel_s* ch, uint32_t ticks)
+{
+  __rtwdog_unlock__();
+  RTWDOG_REGS.TOVAL = ticks;
+  RTWDOG_REGS.CS    = RTWDOG_CS_EN | RTWDOG_CS_INT | RTWDOG_CS_UPDATE | RTWDOG_CS_CMD32EN | RTWDOG_CS_CLK_LPO;
+  RTWDOG_REGS.CNT   = RTWDOG_REFRESH_KEY;
+}
+
+static void
+__rtwdog_channel_cancel__(timer_channel_s* ch)
+{
+  __rtwdog_unlock__();
+  RTWDOG_REGS.CS = RTWDOG_CS_UPDATE | RTWDOG_CS_CMD32EN | RTWDOG_CS_CLK_LPO;
+}
+
+static uint32_t
+__rtwdog_channel_read__(timer_channel_s* ch)
+{
+  return RTWDOG_REGS.CNT;
+}
+
+static const timer_driver_ops_s g_rtwdog_ops = {
+  .configure = &__rtwdog_channel_configure__,
+  .arm       = &__rtwdog_channel_arm__,
+  .cancel    = &__rtwdog_channel_cancel__,
+  .read      = &__rtwdog_channel_read__,
+  .capture   = NULL,
+};
+
+void
+timer_channel_rtwdog(timer_channel_s* ch)
+{
+  timer_channel_setup(ch, &g_rtwdog_ops, RTWDOG_E, 0, 0,
+                      TIMER_CAP_ONESHOT | TIMER_CAP_READ | TIMER_CAP_RESETS,
+                      TIMER_RTWDOG_HZ, 0xffff);
+}
+
+/* Input capture on GPT2 (1PPS on pin 15), see input_capture.h */
+
+void
+capture_poll_GPT2(capture_ring_s* ring)
+{
+  uint32_t status = GPT_REGS(GPT2_E).SR & (GPT_SR_IF1 | GPT_SR_IF2);
+  if (status == 0) { return; }
+
+  GPT_REGS(GPT2_E).SR = status; // Write 1 to clear
+  if (status & GPT_SR_IF1) { capture_ring_push(ring, GPT_REGS(GPT2_E).ICR[0]); }
+  if (status & GPT_SR_IF2) { capture_ring_push(ring, GPT_REGS(GPT2_E).ICR[1]); }
+}
+
+static void
+__capture_gpt2_isr__(void* ctx)
+{
+  capture_poll_GPT2((capture_ring_s*)ctx); // Only IF1/IF2, the compare channels on the line ack their own flags
+  __asm__ volatile("dsb");
+}
+
+void
+init_capture_GPT2(capture_ring_s* ring, capture_mode_e mode)
+{
+  static irq_slot_s capture_slot;
+  capture_ring_init(ring);
+
+  __route_gpt2_capin1__();
+  CCM_C_GPT2_EN;
+
+  GPT_REGS(GPT2_E).CR = 0;
+  GPT_REGS(GPT2_E).IR = 0;
+  GPT_REGS(GPT2_E).CR = GPT_CR_RESET;
+  while (GPT_REGS(GPT2_E).CR & GPT_CR_RESET) {}
+
+  // Free-running 24MHz counter, capture 1 on the rising edge
+  GPT_REGS(GPT2_E).PR = 0;
+  GPT_REGS(GPT2_E).SR = 0x3f;
+  GPT_REGS(GPT2_E).CR = GPT_CR_CLKSRC(0x0, SRC_IPG_CLK_24M) | GPT_CR_EN_24M | GPT_CR_FRR | (0x1 << 0x10);
+  GPT_REGS(GPT2_E).CR = GPT_CR_SET_EN(GPT_REGS(GPT2_E).CR, ENABLE);
+
+  if (mode == CAPTURE_IRQ)
+  {
+    GPT_REGS(GPT2_E).IR = GPT_SR_IF1 | GPT_SR_IF2;
+    irq_attach(&capture_slot, IRQ_GPT2, &__capture_gpt2_isr__, ring);
+    NVIC_SET_PRIORITY(IRQ_GPT2, 0x0);
+    NVIC_ENABLE_IRQ(IRQ_GPT2);
   }
 }
@@ -4,79 +4,165 @@
  */
 
 #include "io/display_driver.h"
+#include "devices/iomux_manager.h"
+#include "devices/monotonic_clock.h"
+
+#include <stddef.h>
+
+static ssd1306_lpi2c_s g_ssd1306;
 
 // Abstracted layer
 ssd1306_intf *
 ssd1306_create_interface()
 {
-  return ((ssd1306_intf *)0); // return null, placeholder
+  static ssd1306_intf intf = {&ssd1306_phy_start, &ssd1306_phy_stop, &ssd1306_phy_send, &ssd1306_phy_send_buffer};
+  return (g_ssd1306.bus != NULL) ? &intf : ((ssd1306_intf *)0);
 }
 
 void
 ssd1306_set_address_mode(ssd1603_addr_mode_e memory_mode)
 {
-  ssd1306_send_command_byte(0x20);
-  ssd1306_send_data_byte(memory_mode);
+  ssd1306_set_command_register_byte(E_SET_MEM_ADDR_MODE, memory_mode);
+}
+
+/** Arguments of a command are command bytes as well, one transfer */
+void
+ssd1306_set_command_register_byte(ssd1306_cmd_registers_e cmd_hex,
+                                  unsigned char           value)
+{
+  ssd1306_phy_start();
+  ssd1306_phy_send(SSD1306_CTRL_CMD);
+  ssd1306_phy_send((unsigned char)cmd_hex);
+  ssd1306_phy_send(value);
+  ssd1306_phy_stop();
+  ssd1306_phy_close();
+}
+
+void
+ssd1306_send_command_byte(ssd1306_cmd_registers_e cmd_hex)
+{
+  ssd1306_phy_start();
+  ssd1306_phy_send(SSD1306_CTRL_CMD);
+  ssd1306_phy_send((unsigned char)cmd_hex);
+  ssd1306_phy_stop();
+  ssd1306_phy_close();
 }
 
 void
-ssd1306_set_command_register(ssd1306_cmd_registers_e cmd_hex,
-                             unsigned char           value)
+ssd1306_send_data_byte(unsigned char data)
+{
+  ssd1306_phy_start();
+  ssd1306_phy_send(SSD1306_CTRL_DATA);
+  ssd1306_phy_send(data);
+  ssd1306_phy_stop();
+  ssd1306_phy_close();
+}
+
+unsigned char
+ssd1306_send_frame(const unsigned char* frame,
+                   unsigned short       size,
+                   lpi2c_done_fp        done,
+                   void*                ctx)
 {
-  ssd1306_send_command_byte(cmd_hex);
-  ssd1306_send_data_byte(value);
+  static const uint8_t ctrl = SSD1306_CTRL_DATA;
+  if (g_ssd1306.bus == NULL) { return 0; }
+  return lpi2c_write_async(g_ssd1306.bus, g_ssd1306.addr, &ctrl, 1, frame, size, done, ctx);
 }
 
 // Physical layer
-static void
-ssd1306_phy_send_byte(unsigned char data, trigger_gpio_fp_t trigger_gpio)
+co_status_e
+ssd1306_phy_send_co(co_s* co, void* ctx)
 {
+  ssd1306_phy_tx_s* tx = (ssd1306_phy_tx_s*)ctx;
 
-  unsigned char i;
-  for (i = 8; i > 0; i--) {
-    // Send write-bit pulse
-    trigger_gpio(0, i); // null addr is placeholder
-    // then wait before sending next bit, I think it was a couple of microsecs
+  CO_BEGIN(co);
+  for (; tx->size != 0; tx->size--, tx->buf++)
+  {
+    for (tx->bit = 8; tx->bit > 0; tx->bit--)
+    {
+      tx->trigger_gpio(tx->line, (*tx->buf >> (tx->bit - 1)) & 0x1);
+      tx->next_ns = clock_now_ns() + SSD1306_I2C_CLOCK;
+      CO_AWAIT(co, clock_now_ns() >= tx->next_ns); // Was a busy wait, other tasks run meanwhile
+    }
   }
-  // generating confirmation impulse
+  CO_END(co);
 }
 
 static void
-ssd1306_phy_send_bytes(const unsigned char * buf,
-                       unsigned short        size,
-                       trigger_gpio_fp_t     trigger_gpio)
+ssd1306_phy_send(unsigned char data)
 {
-  while (size--) {
-    ssd1306_phy_send_byte(*buf, trigger_gpio);
-    ++buf;
-  }
+  if (g_ssd1306.data != NULL || g_ssd1306.head_len >= SSD1306_HEAD_MAX) { return; }
+  g_ssd1306.head[g_ssd1306.head_len++] = data;
+}
+
+/** The DMA reads 'buf' in place, the trigger of the bit-banged interface is not needed */
+static void
+ssd1306_phy_send_buffer(const unsigned char * buf,
+                        unsigned short        size,
+                        trigger_gpio_fp_t     trigger_gpio)
+{
+  (void)trigger_gpio;
+  if (g_ssd1306.data != NULL) { return; }
+  g_ssd1306.data = buf;
+  g_ssd1306.len  = size;
 }
 
-/** SCL remains HIGH on EXIT, Low SDA means start transmission */
+/** Waits out the previous transfer, its bytes are still read from the staging buffer */
 static void
 ssd1306_phy_start(void)
 {
+  if (g_ssd1306.bus == NULL) { return; }
+  lpi2c_wait(g_ssd1306.bus);
+  g_ssd1306.data     = NULL;
+  g_ssd1306.len      = 0;
+  g_ssd1306.head_len = 0;
 }
 
+/** START, address, collected bytes and STOP go out from here on without the CPU */
 static void
 ssd1306_phy_stop(void)
 {
+  if (g_ssd1306.bus == NULL || (g_ssd1306.head_len == 0 && g_ssd1306.len == 0)) { return; }
+  lpi2c_write_async(g_ssd1306.bus,
+                    g_ssd1306.addr,
+                    g_ssd1306.head,
+                    g_ssd1306.head_len,
+                    g_ssd1306.data,
+                    g_ssd1306.len,
+                    g_ssd1306.done,
+                    g_ssd1306.ctx);
 }
 
 static void
 ssd1306_phy_close()
 {
+  if (g_ssd1306.bus != NULL) { lpi2c_wait(g_ssd1306.bus); }
+}
+
+void
+ssd1306_lpi2c_init(lpi2c_s* bus, unsigned char addr, lpi2c_done_fp done, void* ctx)
+{
+  g_ssd1306.bus      = bus;
+  g_ssd1306.addr     = addr;
+  g_ssd1306.done     = done;
+  g_ssd1306.ctx      = ctx;
+  g_ssd1306.data     = NULL;
+  g_ssd1306.len      = 0;
+  g_ssd1306.head_len = 0;
 }
 
 void
 ssd1306_phy_init(char scl, char sda, char sa)
 {
-  // Placeholder/dummy body to get armgcc to compile right now
-  const unsigned char buf_dummy[] = "1234\0";
-  unsigned short      size = 0;
-  trigger_gpio_fp_t   temp = ((trigger_gpio_fp_t)0);
-  ssd1306_phy_start();
-  ssd1306_phy_send_bytes(buf_dummy, size, temp);
-  ssd1306_phy_stop();
-  ssd1306_phy_close();
+  static const pinmux_entry_s pins[2] = {IOMUX_LPI2C1_SCL_PIN19, IOMUX_LPI2C1_SDA_PIN18};
+  static lpi2c_s              bus;
+  static edma_channel_s       dma;
+  if (scl != 19 || sda != 18) { return; } // Only pads of LPI2C1 on the Teensy header
+
+  iomux_route(&pins[0]);
+  iomux_route(&pins[1]);
+  lpi2c_enable(&bus, 1, SSD1306_I2C_HZ, SSD1306_NVIC_PRIO);
+  edma_enable(&dma, SSD1306_DMA_CHANNEL, EDMA_SOURCE_LPI2C1, SSD1306_NVIC_PRIO);
+  lpi2c_attach_dma(&bus, &dma);
+  ssd1306_lpi2c_init(&bus, (unsigned char)(SSD1306_I2C_ADDR | (sa ? 0x1 : 0x0)), NULL, NULL);
 }
@@ -4,10 +4,18 @@
  */
 
 #include "gpio_handler.h"
+#include "iomux_manager.h"
+#include "monotonic_clock.h"
+#include "soft_timer.h"
 #include "sys/memory_map.h"
+#include "sys/profiler.h"
+#include "sys/scheduler.h"
 #include "timer_manager.h"
 
 #include "containers/trb_tree.h"
+#include "benchmarks_pit.h"
+#include "benchmarks_irq_latency.h"
+#include "benchmarks_gpio.h"
 #include "mocktests_trb_tree.h"
 
 
@@ -18,10 +26,14 @@ start_PITx(
   timer_manager_sick_cb tick_callback);
 
 static timer_manager_s* g_timer_manager = NULL;
-static int g_timer_toggle = 1;
+static timer_datum_s g_poll_datum;
+static sched_task_s  g_poll_task;
 
-// @todo Write a structure to handle signal scheduling, keep this here in main.c as a reminder 
-struct { float dummy; } timerschedule_s;
+// Main loop job, was the body of the busy loop in execute()
+static void poll_task(void* ctx)
+{
+  timer_poll((timer_manager_s*)ctx, &g_poll_datum);
+}
 
 void tree_tests(bool should_test)
 {
@@ -35,19 +47,39 @@ void tree_tests(bool should_test)
   }
 }
 
+void pit_benchmarks(bool should_bench, timer_manager_s* pit_timer)
+{
+  if (should_bench)
+  {
+    bench_pit_tick_path(pit_timer); // Results in g_bench_pit
+    bench_irq_latency_sweep(PIT_SPEED_200MHz, 1000, 1); // Results in g_irq_latency, LED pin shows the jitter
+    bench_gpio_toggle(0x2, 0x3); // Results in g_bench_gpio, LED pin on GPIO2 against GPIO7
+  }
+}
+
 int execute()
 {
   tree_tests(false);  
+  iomux_board_init(); // Every pad of the board in one pass, see devices/iomux_manager.h
+  prof_init(); // PROF_SCOPE probes, only recorded with 'make PROFILE=1'
 
-  timer_datum_s     timerdatum = generate_time_struct(PIT_SPEED_200MHz, MILLIS_E, 100);
-  timer_manager_s*  pit_timer  = start_PITx(&timerdatum, &hwtick, &polltick); 
+  timer_datum_s     timerdatum = TIMER_DATUM_MS(100, PIT_SPEED_200MHz); // Folded at compile time, see macros/mtimer_mgr.h
+  init_monotonic_clock(PIT_SPEED_200MHz); // PIT channels 2+3, timer_poll() measures against it
+  soft_timer_wheel_init(&timerdatum); // Signal scheduling runs on the PIT tick, see soft_timer.h
+  timer_manager_s*  pit_timer  = NULL;
+  {
+    PROF_SCOPE("start_PITx");
+    pit_timer = start_PITx(&timerdatum, &hwtick, &polltick);
+  }
   g_timer_manager = pit_timer;
+  pit_benchmarks(false, pit_timer);
 
   /** @note @ArioA This calls a polling timer that runs concurrently as the interrupt timers. Interrupt timers take precedent */ 
-  for (;pit_timer->keep_ticking;)
-  {
-    timer_poll(pit_timer, &timerdatum);
-  }
+  sched_init(); // Main loop jobs, posted from the PIT tick through the soft timer wheel, see sys/scheduler.h
+  g_poll_datum = timerdatum;
+  sched_task_init(&g_poll_task, &poll_task, pit_timer, SCHED_PRIORITIES - 1);
+  sched_post_periodic(&g_poll_task, timerdatum);
+  sched_run(&pit_timer->keep_ticking); // Sleeps in WFI between ticks instead of spinning
 
   g_timer_manager = NULL;
   return 0;
@@ -56,45 +88,24 @@ int execute()
 // Interrupt/hardware trigger tick and software polling timer tick
 void hwtick()
 {
-  polltick(0.0); // Interrupt based, will not have or need deltatime
-
-  PIT_TCTRL0 = 3; 
-  PIT_TFLG0_CLR;
-  NVIC_ENABLE_IRQ(IRQ_PIT);
-  __asm__ volatile("dsb");
+  PROF_SCOPE("hwtick");
+  polltick(0); // Interrupt based, will not have or need deltatime
+  soft_timer_tick(); // LDVAL0 reloads on its own and the PIT demux has cleared TIF0, see pit_demux.h
 }
 
-// Tick: Currently only setting PIN 13 LOW (GPIO7_DR_CLEAR), // Setting PIN 13 HIGH (GPIO7_DR_TOGGLE), 
-void polltick(const float delta_time)
+// Tick: Toggles PIN 13 (GPIO7_DR_TOGGLE)
+void polltick(const time_ns64_t delta_ns)
 {
+  PROF_SCOPE("polltick");
   uint8_t ctrl_pos = (g_timer_manager->timer_ctx != NULL) 
     ? ((gpiodev_s*)g_timer_manager->timer_ctx->base_gpio_device)->base_mux_device->ctrl_pos 
     : 0x3; // Fallback to default LED control position
 
-  led_toggle(delta_time, ctrl_pos);
-
-  // Reset pit timer for PIT_0
-  // TODO: Investigate. NOTE: Does not seem to reset the timer!
-  PIT_TCTRL0 = 3; 
-  PIT_TFLG0_CLR;
-  setup_PITx(g_timer_manager);
+  led_toggle(delta_ns, ctrl_pos);
 }
 
 
-void led_toggle(const float delta_time, vuint32_t ctrl_pos)
+void led_toggle(const time_ns64_t delta_ns, vuint32_t ctrl_pos)
 {
-  switch (g_timer_toggle)
-  {
-    case 0:
-      g_timer_toggle = 1;
-      SET_GPIO_REGISTER(GPIO7_DR_SET, ctrl_pos);
-      break;
-    case 1:
-      g_timer_toggle = 0;
-      SET_GPIO_REGISTER(GPIO7_DR_CLEAR, ctrl_pos);
-      break;
-    default: 
-      g_timer_toggle = 0;
-    break;
-  }
+  gpio_port_toggle(GPIO_PORT(7), 0x1 << ctrl_pos); // DR_TOGGLE, no state to keep in sync with the pad
 }
\ No newline at end of file
@@ -0,0 +1,51 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "coroutine.h"
+
+/** @brief Scheduler entry of a co_task_s, one step of the body then the next post */
+static void
+__co_task_step__(void* ctx)
+{
+  co_task_s* co_task = (co_task_s*)ctx;
+  co_task->status    = co_task->body(&co_task->co, co_task->ctx);
+
+  switch (co_task->status)
+  {
+  case CO_YIELDED:
+    sched_post(&co_task->task);
+    break;
+
+  case CO_SLEEPING:
+  {
+    uint32_t left = co_task->co.wake - soft_timer_now();
+    sched_post_ticks(&co_task->task, ((int32_t)left > 0) ? left : 1);
+    break;
+  }
+
+  case CO_DONE:
+    break;
+  }
+}
+
+void
+co_task_start(co_task_s* co_task, co_fp body, void* ctx, uint8_t priority)
+{
+  if (co_task->task.run != NULL) { sched_cancel(&co_task->task); } // Restart, zeroed storage was never queued
+  sched_task_init(&co_task->task, &__co_task_step__, co_task, priority);
+  CO_RESET(&co_task->co);
+  co_task->co.wake = 0;
+  co_task->body    = body;
+  co_task->ctx     = ctx;
+  co_task->status  = CO_YIELDED;
+  sched_post(&co_task->task);
+}
+
+void
+co_task_stop(co_task_s* co_task)
+{
+  sched_cancel(&co_task->task);
+  co_task->status = CO_DONE;
+}
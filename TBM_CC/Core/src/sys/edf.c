@@ -0,0 +1,205 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "edf.h"
+#include "sys/irq_handler.h"
+#include "utils/utimer_mgr.h"
+
+#include <stddef.h>
+
+/** @brief Dispatcher task, posted by every release */
+static void
+__edf_dispatch_task__(void* ctx)
+{
+  edf_dispatch((edf_s*)ctx);
+}
+
+/** @brief Release timer callback, runs in the PIT ISR */
+static void
+__edf_release_timer__(void* ctx)
+{
+  edf_job_s* job = (edf_job_s*)ctx;
+  edf_release(job->edf, job);
+}
+
+/** @brief Scheduling window of a job, min(deadline, period) */
+static inline uint32_t
+__edf_window__(const edf_job_s* job)
+{
+  return (job->deadline < job->period) ? job->deadline : job->period;
+}
+
+/** @brief 'ticks' / 'window' in Q16, rounded up so admission never over-commits */
+static uint32_t
+__edf_density_q16__(uint32_t ticks, uint32_t window)
+{
+  uint32_t rest    = 0;
+  uint64_t density = (window == 0) ? EDF_UTIL_ONE + 1 : time_udiv64_32((uint64_t)ticks << 0x10, window, &rest);
+  density         += (rest != 0);
+  return (density > EDF_UTIL_ONE) ? EDF_UTIL_ONE + 1 : (uint32_t)density;
+}
+
+/**
+ * @brief   Non-preemptive EDF test of the admitted jobs plus 'cand', at every deadline level
+ * @details Jobs run to completion, so a job released just after a job with a
+ *          later deadline started waits out that whole budget. For every job i
+ *          the density of the jobs with a window up to its own, plus the
+ *          longest budget with a longer window over i's window, stays <= 1.
+ **/
+static uint8_t
+__edf_schedulable__(const edf_s* edf, const edf_job_s* cand)
+{
+  uint32_t count = edf->jobs + 1;
+  uint32_t i, j;
+
+  for (i = 0; i < count; i++)
+  {
+    const edf_job_s* level    = (i < edf->jobs) ? edf->admitted[i] : cand;
+    uint32_t         window   = __edf_window__(level);
+    uint32_t         density  = 0;
+    uint32_t         blocking = 0;
+
+    for (j = 0; j < count; j++)
+    {
+      const edf_job_s* other = (j < edf->jobs) ? edf->admitted[j] : cand;
+      if (__edf_window__(other) <= window) { density += other->density_q16; }
+      else if (other->budget > blocking)   { blocking = other->budget; }
+    }
+    if (density + __edf_density_q16__(blocking, window) > EDF_UTIL_ONE) { return 0; }
+  }
+  return 1;
+}
+
+void
+edf_init(edf_s* edf, edf_now_fp now, uint8_t priority)
+{
+  mheap_init(&edf->ready, edf->storage, EDF_MAX_JOBS);
+  sched_task_init(&edf->dispatcher, &__edf_dispatch_task__, edf, priority);
+  edf->now         = now;
+  edf->density_q16 = 0;
+  edf->jobs        = 0;
+}
+
+void
+edf_job_init(edf_job_s* job, edf_job_fp run, void* ctx, uint32_t period, uint32_t deadline, uint32_t budget)
+{
+  mheap_node_init(&job->node);
+  tickless_timer_init(&job->release_timer);
+  job->edf      = NULL;
+  job->run      = run;
+  job->ctx      = ctx;
+  job->period   = period;
+  job->deadline = (deadline != 0) ? deadline : period;
+  job->budget   = budget;
+
+  job->density_q16 = __edf_density_q16__(budget, __edf_window__(job));
+
+  job->releases = 0;
+  job->runs     = 0;
+  job->overruns = 0;
+  job->misses   = 0;
+  job->max_exec = 0;
+  job->admitted = 0;
+}
+
+uint8_t
+edf_admit(edf_s* edf, edf_job_s* job)
+{
+  if (job->admitted) { return 1; }
+  if (edf->jobs >= EDF_MAX_JOBS) { return 0; }
+  if (edf->density_q16 + job->density_q16 > EDF_UTIL_ONE) { return 0; }
+  if (!__edf_schedulable__(edf, job)) { return 0; }
+
+  edf->density_q16 += job->density_q16;
+  edf->admitted[edf->jobs++] = job;
+  job->edf      = edf;
+  job->admitted = 1;
+  return 1;
+}
+
+void
+edf_remove(edf_s* edf, edf_job_s* job)
+{
+  if (!job->admitted) { return; }
+  tickless_stop(&job->release_timer);
+
+  uint32_t primask = __irq_save__();
+  mheap_remove(&edf->ready, &job->node);
+  __irq_restore__(primask);
+
+  uint32_t idx;
+  for (idx = 0; idx < edf->jobs && edf->admitted[idx] != job; idx++) {}
+  if (idx < edf->jobs) { edf->admitted[idx] = edf->admitted[edf->jobs - 1]; }
+
+  edf->density_q16 -= job->density_q16;
+  edf->jobs--;
+  job->admitted = 0;
+}
+
+uint8_t
+edf_start(edf_s* edf, edf_job_s* job, uint32_t phase)
+{
+  if (!job->admitted || job->edf != edf) { return 0; }
+  return tickless_start_ticks(&job->release_timer, (phase != 0) ? phase : 1, job->period, &__edf_release_timer__, job);
+}
+
+void
+edf_release(edf_s* edf, edf_job_s* job)
+{
+  uint64_t deadline = edf->now() + job->deadline;
+
+  uint32_t primask = __irq_save__();
+  job->releases++;
+  if (mheap_queued(&job->node))
+  {
+    job->misses++; // The previous instance never ran, it is replaced by this one
+    mheap_update(&edf->ready, &job->node, deadline);
+  }
+  else
+  {
+    job->node.key = deadline;
+    mheap_push(&edf->ready, &job->node); // Never full, one node per admitted job
+  }
+  __irq_restore__(primask);
+
+  sched_post(&edf->dispatcher);
+}
+
+uint8_t
+edf_dispatch_one(edf_s* edf)
+{
+  uint32_t      primask = __irq_save__();
+  mheap_node_s* node    = mheap_pop(&edf->ready);
+  __irq_restore__(primask);
+  if (node == NULL) { return 0; }
+
+  edf_job_s* job      = MHEAP_ENTRY(node, edf_job_s, node);
+  uint64_t   deadline = node->key;
+
+  uint64_t start = edf->now();
+  job->run(job->ctx);
+  uint64_t end   = edf->now();
+
+  uint32_t exec = (uint32_t)(end - start);
+  job->runs++;
+  if (exec > job->max_exec) { job->max_exec = exec; }
+  if (exec > job->budget)   { job->overruns++; }
+  if (end > deadline)       { job->misses++; }
+  return 1;
+}
+
+uint32_t
+edf_dispatch(edf_s* edf)
+{
+  uint32_t ran = 0;
+  while (edf_dispatch_one(edf)) { ran++; }
+  return ran;
+}
+
+uint32_t
+edf_density(const edf_s* edf)
+{
+  return edf->density_q16;
+}
@@ -4,6 +4,7 @@
  */
 
 #include "sys/heap.h"
+#include "sys/profiler.h"
 
 extern char     __heap_start;
 extern char     __heap_end;
@@ -37,6 +38,7 @@ heap_region     designated_heap;
 void *
 malloc_(uint16_t obj_size)
 {
+  PROF_SCOPE("malloc_");
   if (obj_size == 0x0 || heapg_current == NULL) 
   {
     return NULL;
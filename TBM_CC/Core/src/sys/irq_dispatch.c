@@ -0,0 +1,120 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "sys/irq_dispatch.h"
+
+irq_slot_s* volatile g_irq_lines[NVIC_IRQs];
+
+/** @brief Anything without a handler, stop here where a debugger can see it */
+static void
+__irq_unhandled__(void)
+{
+  for (;;) { __asm__ volatile("" ::: "memory"); }
+}
+
+/** @brief Vector writes, host builds (make hosttest) have no table and call irq_dispatch() directly */
+static inline void
+__irq_set_vector__(irq_num_e irq, void_func entry)
+{
+#if defined(__arm__)
+  add_to_irq_v(irq, entry);
+#else
+  (void)irq;
+  (void)entry;
+#endif
+}
+
+/** @brief Generic vector entry, IPSR holds the exception number, IRQ 0 is exception 16 */
+static void
+__irq_dispatch_entry__(void)
+{
+#if defined(__arm__)
+  uint32_t ipsr;
+  __asm__ volatile("MRS %0, ipsr" : "=r"(ipsr));
+  irq_dispatch((irq_num_e)((ipsr & 0x1ff) - 0x10));
+#endif
+}
+
+void
+irq_dispatch_init()
+{
+#if defined(__arm__)
+  extern const uint32_t vector_table[2]; // bootdata.c, initial SP and reset
+  uint32_t idx;
+
+  uint32_t primask = __irq_save__();
+  __vectors_ram__[0] = (void_func)vector_table[0];
+  __vectors_ram__[1] = (void_func)vector_table[1];
+  for (idx = 2; idx < NVIC_IRQs + 0x10; idx++)
+  {
+    if (__vectors_ram__[idx] == NULL) { __vectors_ram__[idx] = &__irq_unhandled__; }
+  }
+
+  SCB_VTOR = (uint32_t)__vectors_ram__;
+  __asm__ volatile("dsb\n\tisb" ::: "memory");
+  __irq_restore__(primask);
+#endif
+}
+
+void
+irq_attach(irq_slot_s* slot, irq_num_e irq, irq_handler_fp handler, void* ctx)
+{
+  uint32_t primask = __irq_save__();
+
+  if (slot->attached && slot->irq == irq)
+  {
+    slot->handler = handler;
+    slot->ctx     = ctx;
+    __irq_restore__(primask);
+    return;
+  }
+  if (slot->attached) { irq_detach(slot); }
+
+  slot->handler  = handler;
+  slot->ctx      = ctx;
+  slot->next     = NULL;
+  slot->irq      = irq;
+  slot->attached = 1;
+
+  if (g_irq_lines[irq] == NULL)
+  {
+    g_irq_lines[irq] = slot;
+    __irq_set_vector__(irq, &__irq_dispatch_entry__);
+  }
+  else
+  {
+    irq_slot_s* tail = g_irq_lines[irq];
+    while (tail->next != NULL) { tail = tail->next; }
+    tail->next = slot;
+  }
+
+  __irq_restore__(primask);
+}
+
+void
+irq_detach(irq_slot_s* slot)
+{
+  uint32_t primask = __irq_save__();
+
+  if (slot->attached)
+  {
+    irq_slot_s* volatile* link = &g_irq_lines[slot->irq];
+    while (*link != NULL && *link != slot) { link = &(*link)->next; }
+    if (*link == slot) { *link = slot->next; }
+
+    slot->attached = 0;
+    if (g_irq_lines[slot->irq] == NULL) { __irq_set_vector__(slot->irq, &__irq_unhandled__); }
+  }
+
+  __irq_restore__(primask);
+}
+
+void
+irq_dispatch_fast(irq_num_e irq, void_func trampoline)
+{
+  uint32_t primask = __irq_save__();
+  __irq_set_vector__(irq, trampoline);
+  __irq_restore__(primask);
+}
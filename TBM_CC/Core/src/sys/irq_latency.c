@@ -0,0 +1,72 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "sys/irq_latency.h"
+#include "utils/utimer_mgr.h"
+
+#include <stddef.h>
+
+irq_latency_stats_s g_irq_latency[IRQ_LATENCY_LEVELS];
+
+void
+irq_latency_init(irq_latency_stats_s* stats)
+{
+  uint32_t bucket;
+  stats->count  = 0;
+  stats->min    = 0xffffffff;
+  stats->max    = 0;
+  stats->last   = 0;
+  stats->sum    = 0;
+  stats->sum_sq = 0;
+  for (bucket = 0; bucket < IRQ_LATENCY_BUCKETS; bucket++)
+  {
+    stats->latency_hist[bucket] = 0;
+    stats->jitter_hist[bucket]  = 0;
+  }
+}
+
+void
+irq_latency_init_all()
+{
+  uint32_t level;
+  for (level = 0; level < IRQ_LATENCY_LEVELS; level++) { irq_latency_init(&g_irq_latency[level]); }
+}
+
+uint32_t
+irq_latency_mean_q8(const irq_latency_stats_s* stats)
+{
+  if (stats->count == 0) { return 0; }
+  return (uint32_t)time_udiv64_32(stats->sum << 0x8, stats->count, NULL);
+}
+
+uint32_t
+irq_latency_jitter_q8(const irq_latency_stats_s* stats)
+{
+  if (stats->count < 2) { return 0; }
+
+  // var = E[x^2] - E[x]^2 in Q16, latencies are a few hundred ticks at most so sum_sq << 16 fits
+  uint64_t mean_q8   = time_udiv64_32(stats->sum << 0x8, stats->count, NULL);
+  uint64_t mean_sq16 = time_udiv64_32(stats->sum_sq << 0x10, stats->count, NULL);
+  uint64_t variance  = (mean_sq16 > mean_q8 * mean_q8) ? mean_sq16 - mean_q8 * mean_q8 : 0;
+  return time_isqrt64(variance);
+}
+
+uint32_t
+irq_latency_percentile(const irq_latency_stats_s* stats, uint32_t permille)
+{
+  if (stats->count == 0) { return 0; }
+
+  // ceil(count * permille / 1000)
+  uint64_t target = time_udiv64_32((uint64_t)stats->count * permille + 999, 1000, NULL);
+  uint64_t seen   = 0;
+  uint32_t bucket;
+
+  for (bucket = 0; bucket < IRQ_LATENCY_BUCKETS; bucket++)
+  {
+    seen += stats->latency_hist[bucket];
+    if (seen >= target) { return bucket; }
+  }
+  return IRQ_LATENCY_BUCKETS - 1;
+}
@@ -0,0 +1,250 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "kernel.h"
+#include "sys/irq_handler.h"
+#include "sys/memory_map.h"
+#include "timer_manager.h"
+
+#define SCB_ICSR   MAP_32BIT_ANYREG(vuint32_t, 0xe000ed04) // Interrupt Control and State
+#define SCB_SHPR3  MAP_32BIT_ANYREG(vuint32_t, 0xe000ed20) // PendSV [23:16], SysTick [31:24]
+#define SYST_CSR   MAP_32BIT_ANYREG(vuint32_t, 0xe000e010)
+#define SYST_RVR   MAP_32BIT_ANYREG(vuint32_t, 0xe000e014)
+#define SYST_CVR   MAP_32BIT_ANYREG(vuint32_t, 0xe000e018)
+#define FPU_FPCCR  MAP_32BIT_ANYREG(vuint32_t, 0xe000ef34)
+
+#define ICSR_PENDSVSET   (0x1 << 0x1c)
+#define FPCCR_ASPEN      (0x1UL << 0x1f) // Automatic FPU state preservation
+#define FPCCR_LSPEN      (0x1UL << 0x1e) // Lazy, the space is reserved but only filled on first FPU use
+#define EXC_RETURN_PSP   0xfffffffd      // Thread mode, process stack, basic frame
+#define XPSR_THUMB       0x01000000
+#define KERNEL_PIT_SPEED PIT_SPEED_200MHz // Same PIT clock as the tick in main.c
+#define KERNEL_VECTOR_PENDSV  0xe
+#define KERNEL_VECTOR_SYSTICK 0xf
+
+#define KERNEL_FRAME_WORDS 17 // r4-r11, EXC_RETURN, then the hardware frame r0-r3, r12, lr, pc, xPSR
+
+KERNEL_STACK(g_kernel_idle_stack, KERNEL_IDLE_STACK_WORDS);
+KERNEL_STACK(g_kernel_boot_stack, 128); // Takes the discarded context of kernel_start()'s caller
+
+static kthread_s           g_kernel_idle;
+static kthread_s           g_kernel_boot;
+static kthread_s* volatile g_kernel_running; // Thread whose registers are on the CPU
+
+/** @brief Switch on the next PendSV, which runs once no other exception is active */
+static inline void
+__kernel_pend_switch__()
+{
+  SCB_ICSR = ICSR_PENDSVSET;
+  __asm__ volatile("dsb\n\tisb" ::: "memory");
+}
+
+static void
+__kernel_idle__(void* arg)
+{
+  for (;;) { __asm__ volatile("wfi"); }
+}
+
+/** @brief Where a thread entry returns to */
+static void
+__kthread_exit__(void)
+{
+  uint32_t primask = __irq_save__();
+  ksched_exit();
+  __kernel_pend_switch__();
+  __irq_restore__(primask); // PendSV takes over here and never comes back
+  for (;;) {}
+}
+
+/** @brief Lay out a frame as PendSV would have saved it, the first switch-in "returns" into 'entry' */
+static void
+__kthread_frame__(kthread_s* thread, kthread_fp entry, void* arg, uint64_t* stack, uint32_t stack_bytes)
+{
+  uint32_t* top   = (uint32_t*)((uintptr_t)((uint8_t*)stack + stack_bytes) & ~(uintptr_t)0x7);
+  uint32_t* frame = top - KERNEL_FRAME_WORDS;
+
+  for (uint32_t word = 0; word < KERNEL_FRAME_WORDS; word++) { frame[word] = 0; }
+  frame[8]  = EXC_RETURN_PSP;
+  frame[9]  = (uint32_t)(uintptr_t)arg;             // r0
+  frame[14] = (uint32_t)(uintptr_t)&__kthread_exit__; // lr
+  frame[15] = (uint32_t)(uintptr_t)entry;           // pc
+  frame[16] = XPSR_THUMB;
+
+  thread->sp          = frame;
+  thread->stack       = stack;
+  thread->stack_bytes = stack_bytes;
+}
+
+/**
+ * @brief   Called by PendSV with interrupts masked, stores the outgoing stack pointer and returns the incoming one
+ * @note    External linkage so the 'bl' in __kernel_pendsv__ always finds it under this name
+ **/
+uint32_t* __kernel_switch__(uint32_t* sp) __attribute__((used));
+uint32_t*
+__kernel_switch__(uint32_t* sp)
+{
+  g_kernel_running->sp = sp;
+  g_kernel_running     = ksched_pick();
+  return g_kernel_running->sp;
+}
+
+/**
+ * @brief   PendSV, saves the callee-saved context of the running thread and restores the next one
+ * @details s16-s31 only move for threads with an FPU frame (EXC_RETURN bit 4
+ *          clear), the 'vstmdb' also triggers the lazy save of s0-s15.
+ **/
+__attribute__((naked)) static void
+__kernel_pendsv__(void)
+{
+#if defined(__arm__)
+  __asm__ volatile(
+    "mrs      r0, psp               \n\t"
+    "isb                            \n\t"
+    "tst      lr, #0x10             \n\t"
+    "it       eq                    \n\t"
+    "vstmdbeq r0!, {s16-s31}        \n\t"
+    "stmdb    r0!, {r4-r11, lr}     \n\t"
+    "cpsid    i                     \n\t"
+    "bl       __kernel_switch__     \n\t"
+    "cpsie    i                     \n\t"
+    "ldmia    r0!, {r4-r11, lr}     \n\t"
+    "tst      lr, #0x10             \n\t"
+    "it       eq                    \n\t"
+    "vldmiaeq r0!, {s16-s31}        \n\t"
+    "msr      psp, r0               \n\t"
+    "isb                            \n\t"
+    "bx       lr                    \n\t");
+#endif
+}
+
+/** @brief Tick from either source, pends a switch when a woken thread or a slice peer is due */
+static void
+__kernel_tick__()
+{
+  uint32_t primask = __irq_save__();
+  if (ksched_tick()) { __kernel_pend_switch__(); }
+  __irq_restore__(primask);
+}
+
+static void
+__kernel_systick_isr__(void)
+{
+  __kernel_tick__();
+}
+
+static void
+__kernel_pit_tick__(void* ctx)
+{
+  __kernel_tick__();
+}
+
+void
+kernel_init()
+{
+  uint32_t primask = __irq_save__();
+  __kthread_frame__(&g_kernel_idle, &__kernel_idle__, NULL, g_kernel_idle_stack, sizeof(g_kernel_idle_stack));
+  g_kernel_idle.name = "idle";
+  ksched_init(&g_kernel_idle);
+  __irq_restore__(primask);
+}
+
+void
+kthread_create(kthread_s*  thread,
+               kthread_fp  entry,
+               void*       arg,
+               uint8_t     priority,
+               uint64_t*   stack,
+               uint32_t    stack_bytes,
+               const char* name)
+{
+  if (stack_bytes < KERNEL_MIN_STACK_BYTES) { return; }
+
+  __kthread_frame__(thread, entry, arg, stack, stack_bytes);
+  thread->name     = name;
+  thread->priority = priority;
+
+  uint32_t primask = __irq_save__();
+  ksched_add(thread);
+  if (ksched_current() != NULL && ksched_switch_pending()) { __kernel_pend_switch__(); }
+  __irq_restore__(primask);
+}
+
+void
+kernel_start(kernel_tick_e source, uint32_t tick_hz)
+{
+  __irq_save__();
+
+  // PendSV below every interrupt so a switch never interrupts an ISR, SysTick one level above it (4 priority bits, 0x10 steps)
+  __vectors_ram__[KERNEL_VECTOR_PENDSV] = &__kernel_pendsv__;
+  SCB_SHPR3 = (SCB_SHPR3 & 0x0000ffff) | (0xffUL << 0x10) | (0xe0UL << 0x18);
+  FPU_FPCCR |= FPCCR_ASPEN | FPCCR_LSPEN;
+
+  if (source == KERNEL_TICK_SYSTICK)
+  {
+    __vectors_ram__[KERNEL_VECTOR_SYSTICK] = &__kernel_systick_isr__;
+    SYST_RVR = (KERNEL_CORE_HZ / tick_hz) - 1; // 24 bits, tick_hz >= 36
+    SYST_CVR = 0;
+    SYST_CSR = 0x7; // Core clock | TICKINT | ENABLE
+  }
+  else
+  {
+    pit_channel_start(PIT_TIMER_01, time_to_ticks(KERNEL_PIT_SPEED, MICROS_E, 1000000 / tick_hz) - 1, &__kernel_pit_tick__, NULL);
+  }
+
+  // Thread mode moves to the process stack, the caller's context is saved into g_kernel_boot and dropped
+  g_kernel_running = &g_kernel_boot;
+  uint32_t* boot_top = (uint32_t*)(g_kernel_boot_stack + (sizeof(g_kernel_boot_stack) / sizeof(uint64_t)));
+  SCB_ICSR = ICSR_PENDSVSET;
+
+#if defined(__arm__)
+  __asm__ volatile(
+    "msr  psp, %0      \n\t"
+    "mrs  r1, control  \n\t"
+    "orr  r1, r1, #0x2 \n\t"
+    "msr  control, r1  \n\t"
+    "isb               \n\t"
+    "cpsie i           \n\t" // PendSV is taken right here
+    : : "r"(boot_top) : "r1", "memory");
+#else
+  (void)boot_top;
+#endif
+  for (;;) {}
+}
+
+void
+kernel_yield()
+{
+  uint32_t primask = __irq_save__();
+  ksched_yield();
+  if (ksched_switch_pending()) { __kernel_pend_switch__(); }
+  __irq_restore__(primask);
+}
+
+void
+kernel_sleep(uint32_t ticks)
+{
+  uint32_t primask = __irq_save__();
+  ksched_sleep(ticks);
+  __kernel_pend_switch__();
+  __irq_restore__(primask);
+}
+
+void
+kthread_suspend(kthread_s* thread)
+{
+  uint32_t primask = __irq_save__();
+  ksched_suspend(thread);
+  if (ksched_switch_pending()) { __kernel_pend_switch__(); }
+  __irq_restore__(primask);
+}
+
+void
+kthread_resume(kthread_s* thread)
+{
+  uint32_t primask = __irq_save__();
+  ksched_resume(thread);
+  if (ksched_switch_pending()) { __kernel_pend_switch__(); }
+  __irq_restore__(primask);
+}
@@ -0,0 +1,190 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "kernel.h"
+#include "containers/bitset.h"
+
+typedef struct
+{
+  ilist_s    ready[KERNEL_PRIORITIES]; // Current thread stays at the head of its queue while it runs
+  ilist_s    sleeping;                 // Sorted by wake tick, earliest first
+  uint32_t   ready_mask;               // Bit per non-empty ready queue
+  uint32_t   ticks;
+  kthread_s* current;
+} ksched_s;
+
+static ksched_s g_ksched;
+
+static void
+__ksched_ready__(ksched_s* sched, kthread_s* thread)
+{
+  thread->state = KTHREAD_READY;
+  ilist_push_back(&sched->ready[thread->priority], &thread->link);
+  sched->ready_mask |= 0x1 << thread->priority;
+}
+
+static void
+__ksched_unready__(ksched_s* sched, kthread_s* thread)
+{
+  ilist_unlink(&thread->link);
+  if (ilist_empty(&sched->ready[thread->priority])) { sched->ready_mask &= ~(0x1 << thread->priority); }
+}
+
+static kthread_s*
+__ksched_head__(ksched_s* sched)
+{
+  uint32_t prio = bits_ffs32(sched->ready_mask); // The idle thread keeps the mask non-zero
+  return ILIST_ENTRY(ilist_first(&sched->ready[prio]), kthread_s, link);
+}
+
+/** @brief Move the head of a queue with peers to its back */
+static void
+__ksched_rotate__(ksched_s* sched, kthread_s* thread)
+{
+  ilist_s* queue = &sched->ready[thread->priority];
+  if (ilist_first(queue) == ilist_last(queue)) { return; }
+
+  ilist_unlink(&thread->link);
+  ilist_push_back(queue, &thread->link);
+}
+
+void
+ksched_init(kthread_s* idle)
+{
+  for (uint32_t prio = 0; prio < KERNEL_PRIORITIES; prio++) { ilist_init(&g_ksched.ready[prio]); }
+  ilist_init(&g_ksched.sleeping);
+  g_ksched.ready_mask = 0;
+  g_ksched.ticks      = 0;
+  g_ksched.current    = NULL;
+
+  ilist_node_init(&idle->link);
+  idle->priority = KERNEL_IDLE_PRIORITY;
+  idle->switches = 0;
+  __ksched_ready__(&g_ksched, idle);
+}
+
+void
+ksched_add(kthread_s* thread)
+{
+  if (thread->priority > KERNEL_IDLE_PRIORITY) { thread->priority = KERNEL_IDLE_PRIORITY; }
+  ilist_node_init(&thread->link);
+  thread->switches = 0;
+  __ksched_ready__(&g_ksched, thread);
+}
+
+kthread_s*
+ksched_current()
+{
+  return g_ksched.current;
+}
+
+kthread_s*
+ksched_pick()
+{
+  kthread_s* next = __ksched_head__(&g_ksched);
+  if (next != g_ksched.current)
+  {
+    next->switches++;
+    g_ksched.current = next;
+  }
+  return next;
+}
+
+uint8_t
+ksched_switch_pending()
+{
+  return __ksched_head__(&g_ksched) != g_ksched.current;
+}
+
+void
+ksched_yield()
+{
+  kthread_s* current = g_ksched.current;
+  if (current != NULL && current->state == KTHREAD_READY) { __ksched_rotate__(&g_ksched, current); }
+}
+
+void
+ksched_sleep(uint32_t ticks)
+{
+  kthread_s* current = g_ksched.current;
+  if (current == NULL || current->priority == KERNEL_IDLE_PRIORITY) { return; } // Idle never blocks
+
+  current->wake  = g_ksched.ticks + ((ticks != 0) ? ticks : 1);
+  current->state = KTHREAD_SLEEPING;
+  __ksched_unready__(&g_ksched, current);
+
+  // Sorted insert, wrap safe, equal wake ticks stay in arrival order
+  ilist_node_s* node;
+  ILIST_FOR_EACH(node, &g_ksched.sleeping)
+  {
+    if ((int32_t)(ILIST_ENTRY(node, kthread_s, link)->wake - current->wake) > 0) { break; }
+  }
+  ilist_insert_before(node, &current->link);
+}
+
+void
+ksched_suspend(kthread_s* thread)
+{
+  switch (thread->state)
+  {
+  case KTHREAD_READY:
+    if (thread->priority == KERNEL_IDLE_PRIORITY) { return; }
+    __ksched_unready__(&g_ksched, thread);
+    break;
+
+  case KTHREAD_SLEEPING:
+    ilist_unlink(&thread->link);
+    break;
+
+  default:
+    return;
+  }
+  thread->state = KTHREAD_SUSPENDED;
+}
+
+void
+ksched_resume(kthread_s* thread)
+{
+  if (thread->state != KTHREAD_SUSPENDED && thread->state != KTHREAD_SLEEPING) { return; }
+
+  ilist_unlink(&thread->link); // Off the sleep list, a no-op for a suspended thread
+  __ksched_ready__(&g_ksched, thread);
+}
+
+void
+ksched_exit()
+{
+  kthread_s* current = g_ksched.current;
+  if (current == NULL || current->priority == KERNEL_IDLE_PRIORITY) { return; }
+
+  __ksched_unready__(&g_ksched, current);
+  current->state = KTHREAD_DEAD;
+}
+
+uint8_t
+ksched_tick()
+{
+  ksched_s* sched = &g_ksched;
+  sched->ticks++;
+
+  while (!ilist_empty(&sched->sleeping))
+  {
+    kthread_s* thread = ILIST_ENTRY(ilist_first(&sched->sleeping), kthread_s, link);
+    if ((int32_t)(sched->ticks - thread->wake) < 0) { break; }
+
+    ilist_unlink(&thread->link);
+    __ksched_ready__(sched, thread);
+  }
+
+  // Time slice, the running thread gives way to its equal priority peers
+  if (sched->current != NULL && sched->current->state == KTHREAD_READY) { __ksched_rotate__(sched, sched->current); }
+  return ksched_switch_pending();
+}
+
+uint32_t
+ksched_ticks()
+{
+  return g_ksched.ticks;
+}
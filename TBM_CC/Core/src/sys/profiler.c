@@ -0,0 +1,136 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#if !defined(__arm__)
+  #define _POSIX_C_SOURCE 199309L // clock_gettime() under -std=c99
+  #include <time.h>
+#endif
+
+#include "sys/profiler.h"
+#include "sys/irq_handler.h"
+#include "utils/utimer_mgr.h"
+
+#if defined(__arm__)
+  #include "sys/dwt.h"
+#endif
+
+static prof_probe_s g_prof_probes[PROF_MAX_PROBES];
+static uint32_t     g_prof_probe_count;
+
+/** @brief No libc on target, names are short literals */
+static uint8_t
+__prof_name_equal__(const char* a, const char* b)
+{
+  if (a == b) { return 1; }
+  for (; *a != '\0' && *a == *b; a++, b++) {}
+  return *a == *b;
+}
+
+static void
+__prof_clear__(prof_probe_s* probe)
+{
+  uint32_t bucket;
+  probe->count = 0;
+  probe->min   = 0xffffffff;
+  probe->max   = 0;
+  probe->total = 0;
+  for (bucket = 0; bucket < PROF_HIST_BUCKETS; bucket++) { probe->hist[bucket] = 0; }
+}
+
+uint32_t
+prof_now()
+{
+#if defined(__arm__)
+  return DWT_CYCLES();
+#else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)((uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec); // Differences survive the wrap
+#endif
+}
+
+void
+prof_init()
+{
+#if defined(__arm__)
+  dwt_enable_cycle_counter();
+#endif
+  prof_reset(); // Sites cache their entry, so registrations are never dropped
+}
+
+void
+prof_reset()
+{
+  uint32_t idx;
+  uint32_t primask = __irq_save__();
+  for (idx = 0; idx < g_prof_probe_count; idx++) { __prof_clear__(&g_prof_probes[idx]); }
+  __irq_restore__(primask);
+}
+
+prof_probe_s*
+prof_probe(const char* name)
+{
+  prof_probe_s* found = NULL;
+  uint32_t      idx;
+
+  uint32_t primask = __irq_save__();
+  for (idx = 0; idx < g_prof_probe_count && found == NULL; idx++)
+  {
+    if (__prof_name_equal__(g_prof_probes[idx].name, name)) { found = &g_prof_probes[idx]; }
+  }
+
+  if (found == NULL && g_prof_probe_count < PROF_MAX_PROBES)
+  {
+    found       = &g_prof_probes[g_prof_probe_count++];
+    found->name = name;
+    __prof_clear__(found);
+  }
+  __irq_restore__(primask);
+
+  return found;
+}
+
+void
+prof_record(prof_probe_s* probe, uint32_t ticks)
+{
+  uint32_t bucket = (ticks == 0) ? 0 : 31 - (uint32_t)__builtin_clz(ticks);
+
+  uint32_t primask = __irq_save__();
+  probe->count++;
+  probe->total += ticks;
+  probe->min    = (ticks < probe->min) ? ticks : probe->min;
+  probe->max    = (ticks > probe->max) ? ticks : probe->max;
+  probe->hist[bucket]++;
+  __irq_restore__(primask);
+}
+
+uint32_t
+prof_mean(const prof_probe_s* probe)
+{
+  if (probe->count == 0) { return 0; }
+  return (uint32_t)time_udiv64_32(probe->total, probe->count, NULL);
+}
+
+uint32_t
+prof_probe_count()
+{
+  return g_prof_probe_count;
+}
+
+void
+prof_export(prof_export_fp fp, void* ctx)
+{
+  prof_probe_s snapshot;
+  uint32_t     idx;
+
+  for (idx = 0; idx < g_prof_probe_count; idx++)
+  {
+    uint32_t primask = __irq_save__();
+    snapshot         = g_prof_probes[idx];
+    __irq_restore__(primask);
+
+    if (snapshot.count != 0) { fp(&snapshot, prof_mean(&snapshot), ctx); }
+  }
+}
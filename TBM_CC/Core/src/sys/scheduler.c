@@ -0,0 +1,174 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "scheduler.h"
+#include "containers/bitset.h"
+#include "sys/irq_handler.h"
+
+#include <stddef.h>
+
+typedef struct
+{
+  ilist_s           posted[SCHED_PRIORITIES]; // Shared with ISRs, only touched with interrupts masked
+  ilist_s           ready[SCHED_PRIORITIES];  // Thread context only
+  volatile uint32_t posted_mask;              // Bit per non-empty posted queue
+  uint32_t          ready_mask;               // Bit per non-empty ready queue
+  sched_stats_s     stats;
+} sched_s;
+
+static sched_s g_sched;
+
+void
+sched_init()
+{
+  uint32_t primask = __irq_save__();
+  for (uint32_t prio = 0; prio < SCHED_PRIORITIES; prio++)
+  {
+    ilist_init(&g_sched.posted[prio]);
+    ilist_init(&g_sched.ready[prio]);
+  }
+  g_sched.posted_mask   = 0;
+  g_sched.ready_mask    = 0;
+  g_sched.stats.runs    = 0;
+  g_sched.stats.batches = 0;
+  g_sched.stats.sleeps  = 0;
+  __irq_restore__(primask);
+}
+
+void
+sched_task_init(sched_task_s* task, sched_task_fp run, void* ctx, uint8_t priority)
+{
+  ilist_node_init(&task->link);
+  soft_timer_init(&task->timer);
+  task->run      = run;
+  task->ctx      = ctx;
+  task->runs     = 0;
+  task->priority = (priority < SCHED_PRIORITIES) ? priority : SCHED_PRIORITIES - 1;
+}
+
+void
+sched_post(sched_task_s* task)
+{
+  uint32_t primask = __irq_save__();
+  if (!ilist_node_linked(&task->link))
+  {
+    ilist_push_back(&g_sched.posted[task->priority], &task->link);
+    g_sched.posted_mask |= 0x1 << task->priority;
+  }
+  __irq_restore__(primask);
+}
+
+/** @brief Soft timer callback, runs in the wheel tick ISR */
+static void
+__sched_timer_post__(void* ctx)
+{
+  sched_post((sched_task_s*)ctx);
+}
+
+void
+sched_post_delayed(sched_task_s* task, timer_datum_s delay)
+{
+  soft_timer_start(&task->timer, delay, &__sched_timer_post__, task);
+}
+
+void
+sched_post_ticks(sched_task_s* task, uint32_t ticks)
+{
+  soft_timer_start_ticks(&task->timer, ticks, 0, &__sched_timer_post__, task);
+}
+
+void
+sched_post_periodic(sched_task_s* task, timer_datum_s period)
+{
+  soft_timer_start_periodic(&task->timer, period, &__sched_timer_post__, task);
+}
+
+void
+sched_cancel(sched_task_s* task)
+{
+  soft_timer_stop(&task->timer);
+
+  uint32_t primask = __irq_save__();
+  if (ilist_node_linked(&task->link))
+  {
+    ilist_unlink(&task->link);
+    uint32_t bit = 0x1 << task->priority;
+    if (ilist_empty(&g_sched.posted[task->priority])) { g_sched.posted_mask &= ~bit; }
+    if (ilist_empty(&g_sched.ready[task->priority]))  { g_sched.ready_mask  &= ~bit; }
+  }
+  __irq_restore__(primask);
+}
+
+uint8_t
+sched_task_queued(const sched_task_s* task)
+{
+  return ilist_node_linked(&task->link);
+}
+
+/** @brief Move every posted task behind the ready ones of its priority, one critical section */
+static void
+__sched_take_posted__(sched_s* sched)
+{
+  if (sched->posted_mask == 0) { return; }
+
+  uint32_t primask = __irq_save__();
+  uint32_t posted  = sched->posted_mask;
+  while (posted != 0)
+  {
+    uint32_t prio = bits_pop_lowest32(&posted);
+    ilist_splice_back(&sched->ready[prio], &sched->posted[prio]);
+  }
+  sched->ready_mask  |= sched->posted_mask;
+  sched->posted_mask  = 0;
+  __irq_restore__(primask);
+
+  sched->stats.batches++;
+}
+
+uint8_t
+sched_run_once()
+{
+  sched_s* sched = &g_sched;
+  __sched_take_posted__(sched);
+  if (sched->ready_mask == 0) { return 0; }
+
+  uint32_t      prio = bits_ffs32(sched->ready_mask);
+  ilist_node_s* node = ilist_pop_front(&sched->ready[prio]);
+  if (ilist_empty(&sched->ready[prio])) { sched->ready_mask &= ~(0x1 << prio); }
+
+  // Unlinked before it runs, so it can post itself again
+  sched_task_s* task = ILIST_ENTRY(node, sched_task_s, link);
+  task->runs++;
+  sched->stats.runs++;
+  task->run(task->ctx);
+  return 1;
+}
+
+void
+sched_run(const volatile uint8_t* keep_running)
+{
+  while (*keep_running)
+  {
+    if (sched_run_once()) { continue; }
+
+    // Sleep with interrupts masked so a post between the check and WFI still
+    // wakes the core, the pending ISR runs once PRIMASK is restored
+    uint32_t primask = __irq_save__();
+    if (g_sched.posted_mask == 0)
+    {
+      g_sched.stats.sleeps++;
+#if defined(__arm__)
+      __asm__ volatile("dsb\n\twfi" ::: "memory");
+#endif
+    }
+    __irq_restore__(primask);
+  }
+}
+
+const sched_stats_s*
+sched_stats()
+{
+  return &g_sched.stats;
+}
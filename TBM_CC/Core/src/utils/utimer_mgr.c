@@ -6,6 +6,8 @@
 /* Definition@Header */
 #include "utils/utimer_mgr.h"
 
+#include <stddef.h>
+
 // TIME CLAMPING
 
 uint32_t
@@ -15,34 +17,6 @@ __time_clamp_24MHz__(uint32_t intime, timetype_e timetype)
   return (intime * (clamped_val == 0)) + clamped_val;
 };
 
-uint32_t
-__time_clamp_50MHz__(uint32_t intime, timetype_e timetype)
-{
-  uint32_t clamped_val = TRANSLATE_TIMECLAMP_50MHz(intime, timetype);
-  return (intime * (clamped_val == 0)) + clamped_val;
-};
-
-uint32_t
-__time_clamp_100MHz__(uint32_t intime, timetype_e timetype)
-{  
-  uint32_t clamped_val = TRANSLATE_TIMECLAMP_100MHz(intime, timetype);
-  return (intime * (clamped_val == 0)) + clamped_val;
-};
-
-uint32_t
-__time_clamp_150MHz__(uint32_t intime, timetype_e timetype)
-{
-  uint32_t clamped_val = TRANSLATE_TIMECLAMP_150MHz(intime, timetype);
-  return (intime * (clamped_val == 0)) + clamped_val;
-};
-
-uint32_t
-__time_clamp_200MHz__(uint32_t intime, timetype_e timetype)
-{
-  uint32_t clamped_val = TRANSLATE_TIMECLAMP_200MHz(intime, timetype);
-  return (intime * (clamped_val == 0)) + clamped_val;
-};
-
 // UNIT CONVERSION
 
 uint32_t
@@ -63,74 +37,150 @@ __resolve_time_24MHz__(uint32_t targetval, timetype_e timetype, ttconversiondir_
   }
 }
 
+// PIT TICK SCALES
+
+/** @brief [pit_speed_e][timetype_e], every entry is folded by the compiler */
+static const time_tick_scale_s g_tick_scales[4][NANOS_E + 1] = {
+  TICK_SCALE_ROW(50),  // PIT_SPEED_50MHz
+  TICK_SCALE_ROW(100), // PIT_SPEED_100MHz
+  TICK_SCALE_ROW(150), // PIT_SPEED_150MHz
+  TICK_SCALE_ROW(200), // PIT_SPEED_200MHz
+};
+
 uint32_t
-__resolve_time_50MHz__(uint32_t targetval, timetype_e timetype, ttconversiondir_e conversiondir)
+time_to_ticks(pit_speed_e freq, timetype_e timetype, uint32_t value)
 {
-  uint32_t time_unit = targetval;
-  switch (conversiondir)
-  {
-    default:
-    case FROMTIME_E:
-      // ensuring safety
-      time_unit = __time_clamp_50MHz__(targetval, timetype);
+  const time_tick_scale_s* scale = &g_tick_scales[freq & 0x3][timetype];
 
-      // 50MHz = 20nanoseconds periods
-      return TRANSLATE_TIME_50MHz(time_unit, timetype);
-    case FROMTICKS_E:
-      return BACKTRANSLATE_TIME_50MHz(time_unit, timetype);
-  }
+  // Clamp on max_val, the ticks of every value up to it fit 32 bits
+  uint32_t clamped = (value > scale->max_val) ? scale->max_val : value;
+  uint64_t ticks   = ((uint64_t)clamped * scale->mult) >> scale->shift;
+  return (uint32_t)ticks;
 }
 
 uint32_t
-__resolve_time_100MHz__(uint32_t targetval, timetype_e timetype, ttconversiondir_e conversiondir)
+ticks_to_time(pit_speed_e freq, timetype_e timetype, uint32_t ticks)
 {
-  uint32_t time_unit = targetval;
-  switch (conversiondir)
+  const time_tick_scale_s* scale = &g_tick_scales[freq & 0x3][timetype];
+
+  if (scale->shift == 0x0)
   {
-    default:
-    case FROMTIME_E:
-      // ensuring safety
-      time_unit = __time_clamp_100MHz__(targetval, timetype);
+    // Whole ticks per unit, a single unit longer than 32 bits of ticks never completes
+    return (scale->mult > 0xffffffff) ? 0 : ticks / (uint32_t)scale->mult;
+  }
 
-      // 50MHz = 20nanoseconds periods
-      return TRANSLATE_TIME_100MHz(time_unit, timetype);
-    case FROMTICKS_E:
-      return BACKTRANSLATE_TIME_100MHz(time_unit, timetype);
+  // ticks * den / mhz, split so nothing needs a 64-bit division
+  uint32_t mhz  = PIT_SPEED_MHZ(freq);
+  uint64_t time = (uint64_t)(ticks / mhz) * scale->den + ((ticks % mhz) * scale->den) / mhz;
+  return (time > 0xffffffff) ? 0xffffffff : (uint32_t)time;
+}
+
+// FIXED-POINT TIME
+
+/** @brief Nano-seconds per timetype_e unit */
+static const time_ns64_t g_ns_per_unit[NANOS_E + 1] = {
+  86400ULL * TIME_NS64_PER_S, // DAYS_E
+  3600ULL * TIME_NS64_PER_S,  // HOURS_E
+  60ULL * TIME_NS64_PER_S,    // MINUTES_E
+  TIME_NS64_PER_S,            // SECONDS_E
+  1000000ULL,                 // MILLIS_E
+  1000ULL,                    // MICROS_E
+  100ULL,                     // ZETTOS_E
+  10ULL,                      // YOTTOS_E
+  1ULL,                       // NANOS_E
+};
+
+/** @brief Seconds per timetype_e unit, DAYS_E..SECONDS_E */
+static const uint32_t g_s_per_unit[SECONDS_E + 1] = {86400, 3600, 60, 1};
+
+uint64_t
+time_udiv64_32(uint64_t dividend, uint32_t divisor, uint32_t* remainder)
+{
+  uint64_t quotient = 0;
+  uint64_t rem      = 0;
+  int8_t   bit;
+
+  for (bit = 63; bit >= 0; bit--)
+  {
+    rem = (rem << 0x1) | ((dividend >> bit) & 0x1);
+    if (rem >= divisor)
+    {
+      rem      -= divisor;
+      quotient |= 1ULL << bit;
+    }
   }
+
+  if (remainder != NULL) { *remainder = (uint32_t)rem; }
+  return quotient;
 }
 
 uint32_t
-__resolve_time_150MHz__(uint32_t targetval, timetype_e timetype, ttconversiondir_e conversiondir)
+time_isqrt64(uint64_t value)
 {
-  uint32_t time_unit = targetval;
-  switch (conversiondir)
-  {
-    default:
-    case FROMTIME_E:
-      // ensuring safety
-      time_unit = __time_clamp_150MHz__(targetval, timetype);
+  uint64_t root = 0;
+  uint64_t bit  = 1ULL << 0x3e;
 
-      // 50MHz = 20nanoseconds periods
-      return TRANSLATE_TIME_150MHz(time_unit, timetype);
-    case FROMTICKS_E:
-      return BACKTRANSLATE_TIME_150MHz(time_unit, timetype);
+  while (bit > value) { bit >>= 0x2; }
+  while (bit != 0)
+  {
+    if (value >= root + bit)
+    {
+      value -= root + bit;
+      root   = (root >> 0x1) + bit;
+    }
+    else
+    {
+      root >>= 0x1;
+    }
+    bit >>= 0x2;
   }
+  return (uint32_t)root;
+}
+
+time_ns64_t
+time_to_ns64(timetype_e timetype, uint32_t value)
+{
+  // Only DAYS_E..MINUTES_E can pass 64 bits, the limits fold at compile time
+  static const uint32_t max_val[SECONDS_E] = {
+    (uint32_t)(0xffffffffffffffffULL / (86400ULL * TIME_NS64_PER_S)),
+    (uint32_t)(0xffffffffffffffffULL / (3600ULL * TIME_NS64_PER_S)),
+    (uint32_t)(0xffffffffffffffffULL / (60ULL * TIME_NS64_PER_S)),
+  };
+
+  if (timetype < SECONDS_E && value > max_val[timetype]) { return 0xffffffffffffffffULL; }
+  return (time_ns64_t)value * g_ns_per_unit[timetype];
 }
 
 uint32_t
-__resolve_time_200MHz__(uint32_t targetval, timetype_e timetype, ttconversiondir_e conversiondir)
+time_from_ns64(timetype_e timetype, time_ns64_t ns)
 {
-  uint32_t time_unit = targetval;
-  switch (conversiondir)
-  {
-    default:
-    case FROMTIME_E:
-      // ensuring safety
-      time_unit = __time_clamp_200MHz__(targetval, timetype);
+  uint64_t value;
 
-      // 50MHz = 20nanoseconds periods
-      return TRANSLATE_TIME_200MHz(time_unit, timetype);
-    case FROMTICKS_E:
-      return BACKTRANSLATE_TIME_200MHz(time_unit, timetype);
+  // floor(floor(ns / a) / b) == floor(ns / (a * b)), keeps every divisor in 32 bits
+  if (timetype <= SECONDS_E)
+  {
+    value = time_udiv64_32(ns, (uint32_t)TIME_NS64_PER_S, NULL);
+    value = time_udiv64_32(value, g_s_per_unit[timetype], NULL);
   }
-}
\ No newline at end of file
+  else
+  {
+    value = time_udiv64_32(ns, (uint32_t)g_ns_per_unit[timetype], NULL);
+  }
+
+  return (value > 0xffffffff) ? 0xffffffff : (uint32_t)value;
+}
+
+time_q32_t
+time_ns64_to_q32(time_ns64_t ns)
+{
+  uint32_t   rem;
+  uint64_t   seconds = time_udiv64_32(ns, (uint32_t)TIME_NS64_PER_S, &rem);
+  time_q32_t frac    = time_udiv64_32((uint64_t)rem << 0x20, (uint32_t)TIME_NS64_PER_S, NULL);
+  return (seconds << 0x20) | frac;
+}
+
+time_ns64_t
+time_q32_to_ns64(time_q32_t seconds)
+{
+  return (seconds >> 0x20) * TIME_NS64_PER_S + (((seconds & 0xffffffff) * TIME_NS64_PER_S) >> 0x20);
+}
@@ -0,0 +1,72 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "benchmarks_gpio.h"
+
+#include "sys/dwt.h"
+#include "sys/irq_handler.h"
+#include "sys/profiler.h"
+#include "utils/utimer_mgr.h"
+
+bench_gpio_results_s g_bench_gpio;
+
+static volatile uint32_t g_bench_gpio_sink; // DTCM, the baseline store target
+
+/** @brief Best of BENCH_GPIO_RUNS for BENCH_GPIO_TOGGLES stores of 'mask' to 'reg' */
+static uint32_t
+__bench_gpio_stores__(volatile uint32_t* reg, uint32_t mask)
+{
+  uint32_t best = 0xffffffff;
+  uint32_t run;
+  for (run = 0; run < BENCH_GPIO_RUNS; run++)
+  {
+    uint32_t start = DWT_CYCLES();
+    uint32_t toggle;
+    for (toggle = 0; toggle < BENCH_GPIO_TOGGLES; toggle++) { *reg = mask; }
+    __asm__ volatile("dsb" ::: "memory");
+    uint32_t cycles = DWT_CYCLES() - start;
+    best = (cycles < best) ? cycles : best;
+  }
+  return best;
+}
+
+/** @brief Toggles per second for BENCH_GPIO_TOGGLES stores taking 'cycles' */
+static uint32_t
+__bench_gpio_hz__(uint32_t cycles)
+{
+  if (cycles == 0) { return 0; }
+  return (uint32_t)time_udiv64_32((uint64_t)PROF_COUNTER_HZ * BENCH_GPIO_TOGGLES, cycles, NULL);
+}
+
+void
+bench_gpio_toggle(uint8_t port, uint8_t bit)
+{
+  uint8_t bank = gpio_route_bank(port);
+  if (bank == 0 || bank >= GPIO_FAST_OFFSET || bit > 31) { return; }
+
+  uint32_t                   mask   = 0x1UL << bit;
+  volatile gpio_port_regs_s* normal = GPIO_PORT(bank);
+  volatile gpio_port_regs_s* fast   = GPIO_PORT(bank + GPIO_FAST_OFFSET);
+
+  dwt_enable_cycle_counter();
+  gpio_port_direction(normal, mask, 1);
+  gpio_port_direction(fast, mask, 1);
+  uint32_t primask = __irq_save__();
+
+  g_bench_gpio.overhead_cycles = __bench_gpio_stores__(&g_bench_gpio_sink, mask);
+
+  gpio_route_pin(bank, bit, 0);
+  g_bench_gpio.normal_cycles = __bench_gpio_stores__(&normal->DR_TOGGLE, mask);
+
+  gpio_route_pin(bank, bit, 1);
+  g_bench_gpio.fast_cycles = __bench_gpio_stores__(&fast->DR_TOGGLE, mask);
+
+  __irq_restore__(primask);
+
+  g_bench_gpio.normal_cycles -= g_bench_gpio.overhead_cycles;
+  g_bench_gpio.fast_cycles   -= g_bench_gpio.overhead_cycles;
+  g_bench_gpio.normal_hz      = __bench_gpio_hz__(g_bench_gpio.normal_cycles);
+  g_bench_gpio.fast_hz        = __bench_gpio_hz__(g_bench_gpio.fast_cycles);
+}
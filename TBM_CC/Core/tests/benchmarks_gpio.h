@@ -0,0 +1,41 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef BENCHMARKS_GPIO_H
+#define BENCHMARKS_GPIO_H
+
+#include <stdint.h>
+
+#include "gpio_handler.h"
+
+/**
+ * @brief   Toggle rate of one pin on its regular (IPG) and its fast (AHB) GPIO module
+ * @details BENCH_GPIO_TOGGLES back to back DR_TOGGLE stores, best of
+ *          BENCH_GPIO_RUNS, with the pin routed to the module being measured so
+ *          a scope on the pad shows the same rate. The loop ends with a dsb, the
+ *          last store has reached the module when the counter is read. Read
+ *          'g_bench_gpio' with a probe, like g_bench_pit.
+ *
+ * @note    The pin has to be a muxed GPIO output already (e.g. the LED after
+ *          start_PITx()), it is routed back to the fast module afterwards.
+ **/
+#define BENCH_GPIO_TOGGLES 64
+#define BENCH_GPIO_RUNS    8
+
+typedef struct
+{
+  uint32_t normal_cycles;   // BENCH_GPIO_TOGGLES stores to GPIO1-4
+  uint32_t fast_cycles;     // The same stores to GPIO6-9
+  uint32_t overhead_cycles; // The same loop storing to DTCM, already subtracted from the above
+  uint32_t normal_hz;       // Toggles per second at PROF_COUNTER_HZ
+  uint32_t fast_hz;
+} bench_gpio_results_s;
+
+extern bench_gpio_results_s g_bench_gpio;
+
+/** @brief Measure both modules on bit 'bit' of pad bank 'port' (1-4) */
+void bench_gpio_toggle(uint8_t port, uint8_t bit);
+
+#endif // BENCHMARKS_GPIO_H
@@ -0,0 +1,56 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "benchmarks_irq_latency.h"
+
+#include "gpio_handler.h"
+
+static irq_latency_stats_s* volatile g_bench_irq_stats;
+static volatile uint32_t             g_bench_irq_remaining;
+static uint8_t                       g_bench_irq_toggle;
+
+static void
+__bench_irq_latency_isr__(void* ctx)
+{
+  uint32_t cval = PIT_CHANNEL(PIT_TIMER_01).CVAL; // First load, includes the demux scan
+
+  if (g_bench_irq_toggle) { SET_GPIO_REGISTER(GPIO7_DR_TOGGLE, 0x3); }
+
+  irq_latency_record(g_bench_irq_stats, irq_latency_from_cval(PIT_CHANNEL(PIT_TIMER_01).LDVAL, cval));
+
+  if (--g_bench_irq_remaining == 0) { PIT_CHANNEL(PIT_TIMER_01).TCTRL = 0; }
+}
+
+void
+bench_irq_latency(pit_speed_e freq, uint8_t nvic_priority, uint32_t samples, uint8_t toggle)
+{
+  if (samples == 0) { return; }
+
+  uint8_t saved_priority = NVIC_GET_PRIORITY(IRQ_PIT);
+
+  g_bench_irq_stats     = irq_latency_level(nvic_priority);
+  g_bench_irq_remaining = samples;
+  g_bench_irq_toggle    = toggle;
+  irq_latency_init(g_bench_irq_stats);
+
+  pit_channel_attach(PIT_TIMER_01, &__bench_irq_latency_isr__, NULL); // Next to the tick on channel 0, if any
+  NVIC_SET_PRIORITY(IRQ_PIT, nvic_priority);
+
+  pit_rearm(PIT_TIMER_01, time_to_ticks(freq, MICROS_E, BENCH_IRQ_LATENCY_PERIOD_US) - 1);
+  while (g_bench_irq_remaining != 0) { __asm__ volatile("wfi"); }
+
+  pit_channel_detach(PIT_TIMER_01);
+  NVIC_SET_PRIORITY(IRQ_PIT, saved_priority);
+}
+
+void
+bench_irq_latency_sweep(pit_speed_e freq, uint32_t samples, uint8_t toggle)
+{
+  uint32_t level;
+  for (level = 0; level < IRQ_LATENCY_LEVELS; level++)
+  {
+    bench_irq_latency(freq, (uint8_t)(level << 0x4), samples, toggle);
+  }
+}
@@ -0,0 +1,37 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef BENCHMARKS_IRQ_LATENCY_H
+#define BENCHMARKS_IRQ_LATENCY_H
+
+#include <stdint.h>
+
+#include "timer_manager.h"
+#include "sys/irq_latency.h"
+
+/**
+ * @brief   PIT expiry to ISR entry latency, per NVIC priority of the PIT line
+ * @details Runs PIT channel 1 periodically with a minimal ISR which samples
+ *          CVAL1 as its first load, results land in g_irq_latency (irq_latency.h),
+ *          read them with a probe like g_bench_pit. Whatever else is enabled
+ *          (tick, GPT, GPIO interrupts) is the load the latency is measured under,
+ *          so a sweep shows which priority the PIT needs to stay ahead of it.
+ *
+ *          With 'toggle' set GPIO7 bit 3 (pin 13, the LED) toggles on every ISR
+ *          entry, a scope on the pin shows the same jitter as the histograms.
+ *
+ * @note    Needs the PIT clock running (start_PITx() or init_tickless_PIT0()).
+ *          Takes channel 1 of the PIT demux (pit_demux.h) for the run, so the
+ *          latency includes the dispatch and the four-channel flag scan.
+ **/
+#define BENCH_IRQ_LATENCY_PERIOD_US 20
+
+/** @brief Collect 'samples' latencies with the PIT line at 'nvic_priority' (0x00..0xf0) */
+void bench_irq_latency(pit_speed_e freq, uint8_t nvic_priority, uint32_t samples, uint8_t toggle);
+
+/** @brief bench_irq_latency() at every one of the 16 priority levels */
+void bench_irq_latency_sweep(pit_speed_e freq, uint32_t samples, uint8_t toggle);
+
+#endif // BENCHMARKS_IRQ_LATENCY_H
@@ -0,0 +1,45 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "benchmarks_pit.h"
+
+#include "sys/dwt.h"
+#include "sys/irq_handler.h"
+
+bench_pit_results_s g_bench_pit;
+
+#define BENCH_PIT_MEASURE(result, statement)                                   \
+  do                                                                           \
+  {                                                                            \
+    uint32_t best = 0xffffffff;                                                \
+    for (uint32_t run = 0; run < BENCH_PIT_RUNS; run++)                        \
+    {                                                                          \
+      uint32_t start = DWT_CYCLES();                                           \
+      statement;                                                               \
+      uint32_t cycles = DWT_CYCLES() - start;                                  \
+      best = (cycles < best) ? cycles : best;                                  \
+    }                                                                          \
+    (result) = best;                                                           \
+  } while (0)
+
+void
+bench_pit_tick_path(timer_manager_s* pitman)
+{
+  dwt_enable_cycle_counter();
+  uint32_t primask = __irq_save__();
+
+  BENCH_PIT_MEASURE(g_bench_pit.overhead_cycles, __asm__ volatile("" ::: "memory"));
+  BENCH_PIT_MEASURE(g_bench_pit.configure_cycles, pit_configure(pitman));
+  BENCH_PIT_MEASURE(g_bench_pit.rearm_cycles, pit_rearm(PIT_TIMER_00, pitman->targetval));
+  BENCH_PIT_MEASURE(g_bench_pit.ack_cycles, pit_ack(PIT_TIMER_00));
+
+  g_bench_pit.configure_cycles -= g_bench_pit.overhead_cycles;
+  g_bench_pit.rearm_cycles     -= g_bench_pit.overhead_cycles;
+  g_bench_pit.ack_cycles       -= g_bench_pit.overhead_cycles;
+
+  // Leave the tick running as it was
+  pit_configure(pitman);
+  __irq_restore__(primask);
+}
@@ -0,0 +1,33 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef BENCHMARKS_PIT_H
+#define BENCHMARKS_PIT_H
+
+#include <stdint.h>
+
+#include "timer_manager.h"
+
+/**
+ * @brief   Core cycles spent per call in the PIT tick path, best of BENCH_PIT_RUNS
+ * @details Read 'g_bench_pit' with a probe after bench_pit_tick_path() has run,
+ *          the same way the mocktest return values are inspected on target.
+ **/
+#define BENCH_PIT_RUNS 16
+
+typedef struct
+{
+  uint32_t configure_cycles; // pit_configure(), what polltick used to run every tick
+  uint32_t rearm_cycles;     // pit_rearm(), new load value
+  uint32_t ack_cycles;       // pit_ack(), periodic tick
+  uint32_t overhead_cycles;  // Empty measurement, already subtracted from the above
+} bench_pit_results_s;
+
+extern bench_pit_results_s g_bench_pit;
+
+/** @brief Measure the one-time setup against the per-tick path on a configured 'pitman' */
+void bench_pit_tick_path(timer_manager_s* pitman);
+
+#endif // BENCHMARKS_PIT_H
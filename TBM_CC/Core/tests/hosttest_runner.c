@@ -0,0 +1,103 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+/**
+ * @brief   Host entry point for the hardware independent mocktests
+ * @details Only compiled into an executable by 'make hosttest' (-DTBM_HOST_TEST),
+ *          the firmware build sees an empty translation unit.
+ **/
+#ifdef TBM_HOST_TEST
+
+#include <stdio.h>
+
+#include "mocktests_containers.h"
+#include "mocktests_soft_timer.h"
+#include "mocktests_tickless_timer.h"
+#include "mocktests_timekeeping.h"
+#include "mocktests_timer_driver.h"
+#include "mocktests_input_capture.h"
+#include "mocktests_clock_discipline.h"
+#include "mocktests_profiler.h"
+#include "mocktests_irq_latency.h"
+#include "mocktests_irq_dispatch.h"
+#include "mocktests_pit_demux.h"
+#include "mocktests_scheduler.h"
+#include "mocktests_coroutine.h"
+#include "mocktests_kernel.h"
+#include "mocktests_edf.h"
+#include "mocktests_gpio_port.h"
+#include "mocktests_gpio_registry.h"
+#include "mocktests_gpio_irq.h"
+#include "mocktests_pinmux.h"
+#include "mocktests_flexio.h"
+#include "mocktests_lpi2c.h"
+
+typedef uint32_t (*mocktest_fp)(void);
+
+typedef struct
+{
+  const char* name;
+  mocktest_fp test;
+} mocktest_entry_s;
+
+static const mocktest_entry_s g_mocktests[] = {
+  {"intrusive_list", test_intrusive_list},
+  {"bitset",         test_bitset},
+  {"min_heap",       test_min_heap},
+  {"soft_timer",     test_soft_timer_wheel},
+  {"tickless_timer", test_tickless_timer},
+  {"clock",          test_clock_conversion},
+  {"time_ticks",     test_time_ticks},
+  {"time_ns64",      test_time_ns64},
+  {"timer_driver",   test_timer_driver},
+  {"input_capture",  test_input_capture},
+  {"clock_discipline", test_clock_discipline},
+  {"profiler",       test_profiler},
+  {"irq_latency",    test_irq_latency},
+  {"irq_dispatch",   test_irq_dispatch},
+  {"pit_demux",      test_pit_demux},
+  {"scheduler",      test_scheduler},
+  {"coroutine",      test_coroutine},
+  {"kernel_sched",   test_kernel_sched},
+  {"edf",            test_edf},
+  {"gpio_port",      test_gpio_port},
+  {"gpio_registry",  test_gpio_registry},
+  {"gpio_irq",       test_gpio_irq},
+  {"pinmux",         test_pinmux},
+  {"flexio",         test_flexio},
+  {"lpi2c",          test_lpi2c},
+};
+
+static void
+__print_edf_reports__(void)
+{
+  const mock_edf_report_s* reports;
+  uint32_t count = mocktests_edf_reports(&reports);
+  for (uint32_t idx = 0; idx < count; idx++)
+  {
+    const mock_edf_report_s* report = &reports[idx];
+    printf("  edf %-12s admitted %u, releases %u, runs %u, misses %u, overruns %u, load %u/1000\n",
+           report->name, (unsigned)report->admitted, (unsigned)report->releases, (unsigned)report->runs,
+           (unsigned)report->misses, (unsigned)report->overruns,
+           (unsigned)(((uint64_t)report->busy * 1000) / (report->elapsed ? report->elapsed : 1)));
+  }
+}
+
+int
+main(void)
+{
+  uint32_t total_failures = 0;
+  for (uint32_t idx = 0; idx < sizeof(g_mocktests) / sizeof(g_mocktests[0]); idx++)
+  {
+    uint32_t failures = g_mocktests[idx].test();
+    if (g_mocktests[idx].test == test_edf) { __print_edf_reports__(); }
+    printf("[%s] %s (%u failed expectations)\n",
+           failures == 0 ? "PASS" : "FAIL", g_mocktests[idx].name, (unsigned)failures);
+    total_failures += failures;
+  }
+  return total_failures == 0 ? 0 : 1;
+}
+
+#endif // TBM_HOST_TEST
@@ -0,0 +1,82 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_clock_discipline.h"
+#include "mocktests_common.h"
+
+#include "devices/clock_discipline.h"
+
+/** @brief Deterministic capture jitter in counter ticks, zero mean over 8 edges */
+static const int32_t g_pps_jitter[8] = {3, -3, 5, -5, 1, -1, 0, 0};
+
+uint32_t
+test_clock_discipline()
+{
+  MOCK_BEGIN();
+
+  // 24MHz counter running 37ppm fast: 24000888 ticks and 1000037000 raw ns per true second
+  const uint32_t    ticks_per_pps = 24000888;
+  const time_ns64_t raw_per_pps   = 1000037000ULL;
+  uint32_t          stamp         = 0xfff00000; // Wraps early on
+  time_ns64_t       raw_ns        = 5000000000ULL;
+  uint32_t          edge;
+
+  discipline_init(24000000);
+  MOCK_EXPECT(!discipline_locked() && discipline_ppb() == 0);
+  MOCK_EXPECT(discipline_compensate_ticks(24000000) == 24000000);
+  MOCK_EXPECT(discipline_pps(stamp, raw_ns) == DISCIPLINE_PRIMED);
+
+  for (edge = 1; edge <= 120; edge++)
+  {
+    stamp  += ticks_per_pps;
+    raw_ns += raw_per_pps;
+    MOCK_EXPECT(discipline_pps(stamp + (uint32_t)g_pps_jitter[edge & 0x7], raw_ns) == DISCIPLINE_TRACKING);
+  }
+
+  // A few ticks of jitter at 24MHz are ~100ppb per edge, the loop averages them out
+  int32_t ppb = discipline_ppb();
+  MOCK_EXPECT(discipline_locked());
+  MOCK_EXPECT(ppb > 37000 - 200 && ppb < 37000 + 200);
+  MOCK_EXPECT(discipline_freq_hz() >= ticks_per_pps - 5 && discipline_freq_hz() <= ticks_per_pps + 5);
+
+  // LDVAL for a nominal 1s period becomes the real tick count of a second
+  uint32_t ldval = discipline_compensate_ticks(24000000);
+  MOCK_EXPECT(ldval >= ticks_per_pps - 5 && ldval <= ticks_per_pps + 5);
+
+  // One raw (fast) second of monotonic clock is 1s of corrected time, within a us
+  time_ns64_t start = discipline_correct_ns(raw_ns);
+  time_ns64_t span  = discipline_correct_ns(raw_ns + raw_per_pps) - start;
+  MOCK_EXPECT(span > 1000000000ULL - 1000 && span < 1000000000ULL + 1000);
+
+  // A missed pulse (two seconds) and a glitch are rejected without losing lock
+  stamp  += 2 * ticks_per_pps;
+  raw_ns += 2 * raw_per_pps;
+  MOCK_EXPECT(discipline_pps(stamp, raw_ns) == DISCIPLINE_REJECTED);
+  MOCK_EXPECT(discipline_pps(stamp + 1200, raw_ns) == DISCIPLINE_REJECTED);
+  MOCK_EXPECT(discipline_rejected() == 2 && discipline_locked());
+
+  // Re-anchoring on an update keeps the corrected clock continuous
+  time_ns64_t before = discipline_correct_ns(raw_ns + raw_per_pps);
+  stamp  += ticks_per_pps;
+  raw_ns += raw_per_pps;
+  MOCK_EXPECT(discipline_pps(stamp, raw_ns) == DISCIPLINE_TRACKING);
+  time_ns64_t after = discipline_correct_ns(raw_ns);
+  MOCK_EXPECT(after + 10 >= before && after <= before + 10);
+
+  // Slow oscillator, -20ppm, the sign carries through every output
+  discipline_init(24000000);
+  stamp = 0;
+  discipline_pps(stamp, 0);
+  for (edge = 1; edge <= 120; edge++)
+  {
+    stamp += 24000000 - 480;
+    discipline_pps(stamp, (time_ns64_t)edge * 999980000ULL);
+  }
+  ppb = discipline_ppb();
+  MOCK_EXPECT(ppb > -20000 - 50 && ppb < -20000 + 50);
+  MOCK_EXPECT(discipline_compensate_ticks(24000000) >= 24000000 - 481 && discipline_compensate_ticks(24000000) <= 24000000 - 479);
+
+  MOCK_END();
+}
@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_CLOCK_DISCIPLINE_H
+#define MOCKTESTS_CLOCK_DISCIPLINE_H
+
+#include <stdint.h>
+
+/** @brief Locks the discipline loop onto a drifting, jittery 1PPS stream, returns failure count */
+uint32_t test_clock_discipline();
+
+#endif // MOCKTESTS_CLOCK_DISCIPLINE_H
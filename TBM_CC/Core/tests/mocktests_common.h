@@ -0,0 +1,23 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_COMMON_H
+#define MOCKTESTS_COMMON_H
+
+#include <stdint.h>
+
+/**
+ * @brief   Minimal expectation macro shared by the hardware independent mocktests
+ * @details Each test function owns a local 'failures' counter and returns it,
+ *          so the same tests run on the teensy (inspect the return value with
+ *          a probe) and on the host through 'make hosttest'.
+ **/
+#define MOCK_BEGIN() uint32_t failures = 0
+
+#define MOCK_EXPECT(cond) failures += ((cond) ? 0 : 1)
+
+#define MOCK_END() return failures
+
+#endif // MOCKTESTS_COMMON_H
@@ -0,0 +1,173 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_containers.h"
+#include "mocktests_common.h"
+
+#include "containers/bitset.h"
+#include "containers/intrusive_list.h"
+#include "containers/min_heap.h"
+
+typedef struct
+{
+  uint32_t     value;
+  ilist_node_s link;
+} mock_item_s;
+
+static uint32_t
+sum_list(ilist_s * list)
+{
+  uint32_t       sum = 0;
+  ilist_node_s * node;
+  ILIST_FOR_EACH(node, list) { sum += ILIST_ENTRY(node, mock_item_s, link)->value; }
+  return sum;
+}
+
+uint32_t
+test_intrusive_list()
+{
+  MOCK_BEGIN();
+
+  mock_item_s items[4] = {{.value = 1}, {.value = 2}, {.value = 4}, {.value = 8}};
+  ilist_s     list = ILIST_INIT(list);
+  ilist_s     other;
+  ilist_init(&other);
+
+  MOCK_EXPECT(ilist_empty(&list));
+  MOCK_EXPECT(ilist_pop_front(&list) == NULL);
+
+  ilist_push_back(&list, &items[1].link);
+  ilist_push_front(&list, &items[0].link);
+  ilist_push_back(&list, &items[3].link);
+  ilist_insert_before(&items[3].link, &items[2].link);
+
+  // Order should now be 1,2,4,8
+  MOCK_EXPECT(ILIST_ENTRY(ilist_first(&list), mock_item_s, link)->value == 1);
+  MOCK_EXPECT(ILIST_ENTRY(ilist_last(&list), mock_item_s, link)->value == 8);
+  MOCK_EXPECT(ILIST_ENTRY(items[1].link.next, mock_item_s, link)->value == 4);
+  MOCK_EXPECT(sum_list(&list) == 15);
+
+  // Unlink from the middle, then unlink again (must be a no-op)
+  ilist_unlink(&items[1].link);
+  ilist_unlink(&items[1].link);
+  MOCK_EXPECT(!ilist_node_linked(&items[1].link));
+  MOCK_EXPECT(sum_list(&list) == 13);
+
+  // Safe iteration while unlinking everything above 1
+  ilist_node_s *node, *tmp;
+  ILIST_FOR_EACH_SAFE(node, tmp, &list)
+  {
+    mock_item_s * item = ILIST_ENTRY(node, mock_item_s, link);
+    if (item->value > 1) { ilist_unlink(node); ilist_push_back(&other, node); }
+  }
+  MOCK_EXPECT(sum_list(&list) == 1);
+  MOCK_EXPECT(sum_list(&other) == 12);
+
+  // Splice keeps the order of the source list
+  ilist_splice_back(&list, &other);
+  MOCK_EXPECT(ilist_empty(&other));
+  MOCK_EXPECT(sum_list(&list) == 13);
+  MOCK_EXPECT(ILIST_ENTRY(ilist_last(&list), mock_item_s, link)->value == 8);
+
+  MOCK_EXPECT(ILIST_ENTRY(ilist_pop_front(&list), mock_item_s, link)->value == 1);
+  MOCK_EXPECT(ILIST_ENTRY(ilist_pop_front(&list), mock_item_s, link)->value == 4);
+  MOCK_EXPECT(ILIST_ENTRY(ilist_pop_front(&list), mock_item_s, link)->value == 8);
+  MOCK_EXPECT(ilist_empty(&list));
+
+  MOCK_END();
+}
+
+uint32_t
+test_bitset()
+{
+  MOCK_BEGIN();
+
+  BITSET_DECLARE(bits, 70);
+  bitset_zero(bits, BITSET_WORDS(70));
+
+  MOCK_EXPECT(BITSET_WORDS(70) == 3);
+  MOCK_EXPECT(bitset_ffs(bits, BITSET_WORDS(70)) == BITSET_NONE);
+  MOCK_EXPECT(bitset_fls(bits, BITSET_WORDS(70)) == BITSET_NONE);
+  MOCK_EXPECT(bitset_ffz(bits, BITSET_WORDS(70)) == 0);
+
+  bitset_set(bits, 33);
+  bitset_set(bits, 69);
+  bitset_set(bits, 31);
+  MOCK_EXPECT(bitset_test(bits, 33) && bitset_test(bits, 69) && bitset_test(bits, 31));
+  MOCK_EXPECT(!bitset_test(bits, 32));
+  MOCK_EXPECT(bitset_ffs(bits, BITSET_WORDS(70)) == 31);
+  MOCK_EXPECT(bitset_fls(bits, BITSET_WORDS(70)) == 69);
+  MOCK_EXPECT(bitset_next(bits, BITSET_WORDS(70), 32) == 33);
+  MOCK_EXPECT(bitset_next(bits, BITSET_WORDS(70), 34) == 69);
+  MOCK_EXPECT(bitset_next(bits, BITSET_WORDS(70), 70) == BITSET_NONE);
+  MOCK_EXPECT(bitset_count(bits, BITSET_WORDS(70)) == 3);
+
+  bitset_clear(bits, 31);
+  bitset_assign(bits, 33, 0);
+  bitset_assign(bits, 0, 5);
+  MOCK_EXPECT(bitset_ffs(bits, BITSET_WORDS(70)) == 0);
+  MOCK_EXPECT(bitset_count(bits, BITSET_WORDS(70)) == 2);
+
+  // Full first word, first zero must come from the second word
+  bits[0] = 0xffffffff;
+  MOCK_EXPECT(bitset_ffz(bits, BITSET_WORDS(70)) == 32);
+
+  uint32_t word = 0x80000101;
+  MOCK_EXPECT(bits_fls32(word) == 31);
+  MOCK_EXPECT(bits_pop_lowest32(&word) == 0);
+  MOCK_EXPECT(bits_pop_lowest32(&word) == 8);
+  MOCK_EXPECT(bits_pop_lowest32(&word) == 31);
+  MOCK_EXPECT(word == 0);
+
+  MOCK_END();
+}
+
+uint32_t
+test_min_heap()
+{
+  MOCK_BEGIN();
+
+  static mheap_node_s  nodes[64];
+  static mheap_node_s* storage[64];
+  mheap_s              heap;
+  mheap_init(&heap, storage, 64);
+
+  MOCK_EXPECT(mheap_peek(&heap) == NULL);
+  MOCK_EXPECT(mheap_pop(&heap) == NULL);
+
+  // Pseudo random keys with duplicates, must come out sorted
+  uint32_t seed = 0xace1;
+  for (uint32_t idx = 0; idx < 64; idx++)
+  {
+    seed = seed * 1103515245UL + 12345UL;
+    nodes[idx].key = (seed >> 16) & 0xff;
+    MOCK_EXPECT(mheap_push(&heap, &nodes[idx]));
+  }
+  mheap_node_s overflow = {0};
+  MOCK_EXPECT(!mheap_push(&heap, &overflow));
+
+  // Remove from the middle, re-key one to the front and one to the back
+  mheap_remove(&heap, &nodes[10]);
+  mheap_remove(&heap, &nodes[10]);
+  MOCK_EXPECT(!mheap_queued(&nodes[10]) && mheap_size(&heap) == 63);
+  mheap_update(&heap, &nodes[20], 0);
+  MOCK_EXPECT(mheap_peek(&heap)->key == 0);
+  mheap_update(&heap, &nodes[30], 0x1000);
+
+  uint64_t last     = 0;
+  uint32_t unsorted = 0;
+  mheap_node_s* node;
+  while ((node = mheap_pop(&heap)) != NULL)
+  {
+    unsorted += (node->key < last);
+    last      = node->key;
+    MOCK_EXPECT(!mheap_queued(node));
+  }
+  MOCK_EXPECT(unsorted == 0);
+  MOCK_EXPECT(last == 0x1000);
+  MOCK_EXPECT(mheap_size(&heap) == 0);
+
+  MOCK_END();
+}
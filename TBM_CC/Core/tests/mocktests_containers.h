@@ -0,0 +1,20 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_CONTAINERS_H
+#define MOCKTESTS_CONTAINERS_H
+
+#include <stdint.h>
+
+/** @brief Link/unlink/splice coverage for the intrusive list, returns failure count */
+uint32_t test_intrusive_list();
+
+/** @brief Set/clear/search coverage for the bitset, returns failure count */
+uint32_t test_bitset();
+
+/** @brief Push/pop ordering, remove and re-key coverage for the min-heap, returns failure count */
+uint32_t test_min_heap();
+
+#endif // MOCKTESTS_CONTAINERS_H
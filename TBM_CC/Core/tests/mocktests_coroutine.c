@@ -0,0 +1,136 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_coroutine.h"
+#include "mocktests_common.h"
+
+#include "sys/coroutine.h"
+
+#define MOCK_CO_TRACE 32
+
+/** @brief A bit-banged transfer as a driver would write it, g_co_trace records the pulse order */
+typedef struct
+{
+  uint8_t  data;
+  uint8_t  bit;
+  uint8_t  ready; // Stands in for the condition a driver waits on
+  uint8_t  id;
+  uint32_t pulses;
+} mock_co_tx_s;
+
+static uint8_t  g_co_trace[MOCK_CO_TRACE];
+static uint32_t g_co_trace_len;
+
+static co_status_e
+__mock_co_tx__(co_s* co, void* ctx)
+{
+  mock_co_tx_s* tx = (mock_co_tx_s*)ctx;
+
+  CO_BEGIN(co);
+  for (tx->bit = 0; tx->bit < 4; tx->bit++)
+  {
+    tx->pulses++;
+    if (g_co_trace_len < MOCK_CO_TRACE) { g_co_trace[g_co_trace_len++] = tx->id; }
+    CO_YIELD(co);
+  }
+  CO_AWAIT(co, tx->ready);
+  CO_AWAIT_TICKS(co, 3);
+  tx->data = 0xa5;
+  CO_END(co);
+}
+
+static co_status_e
+__mock_co_exit__(co_s* co, void* ctx)
+{
+  uint32_t* steps = (uint32_t*)ctx;
+  CO_BEGIN(co);
+  (*steps)++;
+  CO_YIELD(co);
+  (*steps)++;
+  if (*steps == 2) { CO_EXIT(co); }
+  (*steps) += 100;
+  CO_END(co);
+}
+
+static uint32_t
+__mock_co_drain__()
+{
+  uint32_t ran = 0;
+  while (sched_run_once()) { ran++; }
+  return ran;
+}
+
+uint32_t
+test_coroutine()
+{
+  MOCK_BEGIN();
+
+  timer_datum_s tick = {.freq = PIT_SPEED_200MHz, .type = MILLIS_E, .val = 200000};
+  soft_timer_wheel_init(&tick);
+  sched_init();
+
+  // Stepped by hand, every call resumes after the last wait
+  static mock_co_tx_s tx;
+  co_s                co = {0};
+  tx.id = 1;
+  uint32_t step;
+  for (step = 0; step < 4; step++) { MOCK_EXPECT(__mock_co_tx__(&co, &tx) == CO_YIELDED); }
+  MOCK_EXPECT(tx.pulses == 4);
+  MOCK_EXPECT(__mock_co_tx__(&co, &tx) == CO_YIELDED && tx.pulses == 4); // Awaiting 'ready'
+  tx.ready = 1;
+  MOCK_EXPECT(__mock_co_tx__(&co, &tx) == CO_SLEEPING && co.wake == soft_timer_now() + 3);
+  soft_timer_tick();
+  soft_timer_tick();
+  MOCK_EXPECT(__mock_co_tx__(&co, &tx) == CO_SLEEPING);
+  soft_timer_tick();
+  MOCK_EXPECT(__mock_co_tx__(&co, &tx) == CO_DONE && tx.data == 0xa5);
+  MOCK_EXPECT(__mock_co_tx__(&co, &tx) == CO_DONE && tx.pulses == 4);
+
+  // CO_EXIT leaves from the middle of the body
+  uint32_t exit_steps = 0;
+  co_s     exit_co    = {0};
+  MOCK_EXPECT(__mock_co_exit__(&exit_co, &exit_steps) == CO_YIELDED);
+  MOCK_EXPECT(__mock_co_exit__(&exit_co, &exit_steps) == CO_DONE && exit_steps == 2);
+
+  // Two transfers on the scheduler interleave pulse by pulse
+  static co_task_s    task_a, task_b;
+  static mock_co_tx_s tx_a, tx_b;
+  tx_a.id = 0xa; tx_a.ready = 1;
+  tx_b.id = 0xb; tx_b.ready = 0;
+  g_co_trace_len = 0;
+  co_task_start(&task_a, &__mock_co_tx__, &tx_a, 0x1);
+  co_task_start(&task_b, &__mock_co_tx__, &tx_b, 0x1);
+  for (step = 0; step < 8; step++) { MOCK_EXPECT(sched_run_once() == 1); }
+  MOCK_EXPECT(g_co_trace_len == 8);
+  for (step = 0; step < 8; step++) { MOCK_EXPECT(g_co_trace[step] == ((step & 0x1) ? 0xb : 0xa)); }
+
+  // 'a' sleeps on the wheel (not queued), 'b' polls its condition until woken
+  sched_run_once();
+  sched_run_once();
+  MOCK_EXPECT(task_a.status == CO_SLEEPING && !sched_task_queued(&task_a.task));
+  MOCK_EXPECT(task_b.status == CO_YIELDED && sched_task_queued(&task_b.task));
+  tx_b.ready = 1;
+  MOCK_EXPECT(__mock_co_drain__() == 1 && task_b.status == CO_SLEEPING);
+
+  uint32_t t;
+  for (t = 0; t < 3; t++)
+  {
+    soft_timer_tick();
+    __mock_co_drain__();
+  }
+  MOCK_EXPECT(co_task_done(&task_a) && tx_a.data == 0xa5);
+  MOCK_EXPECT(co_task_done(&task_b) && tx_b.data == 0xa5);
+  MOCK_EXPECT(__mock_co_drain__() == 0);
+
+  // Stop takes a sleeping coroutine off the wheel, restart runs it from the top
+  tx_a.ready = 1;
+  co_task_start(&task_a, &__mock_co_tx__, &tx_a, 0x1);
+  while (task_a.status != CO_SLEEPING) { sched_run_once(); }
+  co_task_stop(&task_a);
+  for (t = 0; t < 4; t++) { soft_timer_tick(); }
+  MOCK_EXPECT(__mock_co_drain__() == 0 && tx_a.pulses == 8);
+
+  MOCK_END();
+}
@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_COROUTINE_H
+#define MOCKTESTS_COROUTINE_H
+
+#include <stdint.h>
+
+/** @brief Resume points, awaits, wheel sleeps and interleaving on the scheduler, returns failure count */
+uint32_t test_coroutine();
+
+#endif // MOCKTESTS_COROUTINE_H
@@ -0,0 +1,210 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_edf.h"
+#include "mocktests_common.h"
+
+#include "sys/edf.h"
+
+#define MOCK_EDF_MAX_SET 8
+
+/** @brief One job of a replayed set, 'exec' is what a run really takes (> budget for an overrun) */
+typedef struct
+{
+  uint32_t period;
+  uint32_t deadline;
+  uint32_t budget;
+  uint32_t exec;
+} mock_edf_spec_s;
+
+static uint64_t g_edf_sim_now;
+static uint32_t g_edf_last_deadline_ok; // Every run had the earliest deadline of the ready jobs
+
+static mock_edf_report_s g_edf_reports[MOCK_EDF_REPORTS];
+static uint32_t          g_edf_report_count;
+
+static uint64_t
+__mock_edf_now__(void)
+{
+  return g_edf_sim_now;
+}
+
+static void
+__mock_edf_run__(void* ctx)
+{
+  g_edf_sim_now += ((const mock_edf_spec_s*)ctx)->exec;
+}
+
+/**
+ * @brief   Replay 'set' for 'horizon' ticks of simulated time
+ * @details Stands in for the release timers and the dispatcher task: due
+ *          releases are made at their nominal tick, then the earliest deadline
+ *          runs to completion (advancing the clock by its 'exec'). An idle core
+ *          jumps to the next release.
+ **/
+static mock_edf_report_s
+__mock_edf_replay__(const mock_edf_spec_s* set, uint32_t count, uint64_t horizon)
+{
+  static edf_s     edf;
+  static edf_job_s jobs[MOCK_EDF_MAX_SET];
+  uint64_t         next_release[MOCK_EDF_MAX_SET];
+  mock_edf_report_s report = {0};
+  uint32_t         idx;
+
+  g_edf_sim_now = 0;
+  edf_init(&edf, &__mock_edf_now__, 0x0);
+  for (idx = 0; idx < count; idx++)
+  {
+    edf_job_init(&jobs[idx], &__mock_edf_run__, (void*)&set[idx], set[idx].period, set[idx].deadline, set[idx].budget);
+    report.admitted += edf_admit(&edf, &jobs[idx]);
+    next_release[idx] = 0;
+  }
+
+  g_edf_last_deadline_ok = 1;
+  while (g_edf_sim_now < horizon)
+  {
+    uint64_t now      = g_edf_sim_now;
+    uint64_t earliest = UINT64_MAX;
+    for (idx = 0; idx < count; idx++)
+    {
+      if (!jobs[idx].admitted) { continue; }
+      while (next_release[idx] <= now)
+      {
+        g_edf_sim_now = next_release[idx]; // The timer fires on time, the deadline counts from there
+        edf_release(&edf, &jobs[idx]);
+        next_release[idx] += set[idx].period;
+      }
+      if (next_release[idx] < earliest) { earliest = next_release[idx]; }
+    }
+    g_edf_sim_now = now;
+
+    mheap_node_s* head = mheap_peek(&edf.ready);
+    uint64_t      key  = (head != NULL) ? head->key : 0;
+    uint64_t      t0   = g_edf_sim_now;
+    if (edf_dispatch_one(&edf))
+    {
+      report.busy += (uint32_t)(g_edf_sim_now - t0);
+      // The run just made had the smallest key, whatever is left is not earlier
+      head = mheap_peek(&edf.ready);
+      if (head != NULL && head->key < key) { g_edf_last_deadline_ok = 0; }
+    }
+    else
+    {
+      g_edf_sim_now = earliest;
+    }
+  }
+
+  for (idx = 0; idx < count; idx++)
+  {
+    report.releases += jobs[idx].releases;
+    report.runs     += jobs[idx].runs;
+    report.misses   += jobs[idx].misses;
+    report.overruns += jobs[idx].overruns;
+  }
+  return report;
+}
+
+/** @brief Keep a replay's numbers for mocktests_edf_reports() */
+static void
+__mock_edf_record__(const char* name, const mock_edf_report_s* report)
+{
+  if (g_edf_report_count >= MOCK_EDF_REPORTS) { return; }
+  g_edf_reports[g_edf_report_count]         = *report;
+  g_edf_reports[g_edf_report_count].name    = name;
+  g_edf_reports[g_edf_report_count].elapsed = (uint32_t)g_edf_sim_now;
+  g_edf_report_count++;
+}
+
+uint32_t
+mocktests_edf_reports(const mock_edf_report_s** reports)
+{
+  *reports = g_edf_reports;
+  return g_edf_report_count;
+}
+
+uint32_t
+test_edf()
+{
+  MOCK_BEGIN();
+  g_edf_report_count = 0;
+
+  sched_init(); // edf_release() posts the dispatcher task, the replay dispatches by itself
+
+  // 95% density, implicit deadlines, every level including blocking at or below 1: every deadline met
+  static const mock_edf_spec_s dense[] = {
+    {.period = 100, .deadline = 0, .budget = 10, .exec = 10},
+    {.period = 200, .deadline = 0, .budget = 40, .exec = 40},
+    {.period = 200, .deadline = 0, .budget = 50, .exec = 50},
+    {.period = 400, .deadline = 0, .budget = 70, .exec = 70},
+    {.period = 400, .deadline = 0, .budget = 70, .exec = 70},
+    {.period = 400, .deadline = 0, .budget = 20, .exec = 20},
+  };
+  mock_edf_report_s report = __mock_edf_replay__(dense, 6, 20000);
+  __mock_edf_record__("dense", &report);
+  MOCK_EXPECT(report.admitted == 6 && report.misses == 0 && report.overruns == 0);
+  MOCK_EXPECT(report.runs == report.releases);
+  MOCK_EXPECT(g_edf_last_deadline_ok);
+  MOCK_EXPECT(report.busy >= 18900); // ~95% of the horizon is work
+
+  // One more job would pass 100%, admission turns it away and the rest still meets every deadline
+  static const mock_edf_spec_s over[] = {
+    {.period = 100, .deadline = 0, .budget = 10, .exec = 10},
+    {.period = 200, .deadline = 0, .budget = 40, .exec = 40},
+    {.period = 200, .deadline = 0, .budget = 50, .exec = 50},
+    {.period = 400, .deadline = 0, .budget = 70, .exec = 70},
+    {.period = 400, .deadline = 0, .budget = 70, .exec = 70},
+    {.period = 400, .deadline = 0, .budget = 20, .exec = 20},
+    {.period = 100, .deadline = 0, .budget = 10, .exec = 10},
+  };
+  report = __mock_edf_replay__(over, 7, 20000);
+  __mock_edf_record__("rejected", &report);
+  MOCK_EXPECT(report.admitted == 6 && report.misses == 0);
+
+  // 15% density, but the long job blocks the short one past its deadline: not admitted
+  static const mock_edf_spec_s blocking[] = {
+    {.period = 10,   .deadline = 0, .budget = 1,  .exec = 1},
+    {.period = 1000, .deadline = 0, .budget = 50, .exec = 50},
+  };
+  report = __mock_edf_replay__(blocking, 2, 20000);
+  __mock_edf_record__("blocking", &report);
+  MOCK_EXPECT(report.admitted == 1 && report.misses == 0);
+
+  // Constrained deadlines count against min(deadline, period)
+  static const mock_edf_spec_s tight[] = {
+    {.period = 100, .deadline = 50, .budget = 10, .exec = 10},
+    {.period = 100, .deadline = 80, .budget = 20, .exec = 20},
+    {.period = 200, .deadline = 0,  .budget = 30, .exec = 30},
+  };
+  report = __mock_edf_replay__(tight, 3, 20000);
+  __mock_edf_record__("constrained", &report);
+  MOCK_EXPECT(report.admitted == 3 && report.misses == 0);
+
+  // A job running past its budget is counted, and the others pay with misses
+  static const mock_edf_spec_s overrun[] = {
+    {.period = 100, .deadline = 0, .budget = 10, .exec = 10},
+    {.period = 200, .deadline = 0, .budget = 40, .exec = 90},
+    {.period = 200, .deadline = 0, .budget = 50, .exec = 50},
+    {.period = 400, .deadline = 0, .budget = 70, .exec = 70},
+    {.period = 400, .deadline = 0, .budget = 70, .exec = 70},
+    {.period = 400, .deadline = 0, .budget = 20, .exec = 20},
+  };
+  report = __mock_edf_replay__(overrun, 6, 20000);
+  __mock_edf_record__("overrun", &report);
+  MOCK_EXPECT(report.admitted == 6 && report.overruns > 0 && report.misses > 0);
+
+  // Density rounds up, a full set is admitted exactly to 1.0 and not beyond
+  static edf_s     edf;
+  static edf_job_s half_a, half_b, sliver;
+  edf_init(&edf, &__mock_edf_now__, 0x0);
+  edf_job_init(&half_a, &__mock_edf_run__, NULL, 10, 0, 5);
+  edf_job_init(&half_b, &__mock_edf_run__, NULL, 10, 0, 5);
+  edf_job_init(&sliver, &__mock_edf_run__, NULL, 1000000, 0, 1);
+  MOCK_EXPECT(edf_admit(&edf, &half_a) && edf_admit(&edf, &half_b) && edf_density(&edf) == EDF_UTIL_ONE);
+  MOCK_EXPECT(!edf_admit(&edf, &sliver));
+  edf_remove(&edf, &half_b);
+  MOCK_EXPECT(edf_admit(&edf, &sliver) && edf_density(&edf) == EDF_UTIL_ONE / 2 + 1);
+
+  MOCK_END();
+}
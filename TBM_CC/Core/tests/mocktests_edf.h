@@ -0,0 +1,32 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_EDF_H
+#define MOCKTESTS_EDF_H
+
+#include <stdint.h>
+
+#define MOCK_EDF_REPORTS 8
+
+/** @brief Outcome of one replayed set, 'elapsed' simulated ticks of which 'busy' ran jobs */
+typedef struct
+{
+  const char* name;
+  uint32_t    admitted;
+  uint32_t    releases;
+  uint32_t    runs;
+  uint32_t    misses;
+  uint32_t    overruns;
+  uint32_t    busy;
+  uint32_t    elapsed;
+} mock_edf_report_s;
+
+/** @brief Replays job sets on a simulated clock, checks admission, deadline order, misses and overruns, returns failure count */
+uint32_t test_edf();
+
+/** @brief Reports of the replays made by the last test_edf(), printed by the host runner */
+uint32_t mocktests_edf_reports(const mock_edf_report_s** reports);
+
+#endif // MOCKTESTS_EDF_H
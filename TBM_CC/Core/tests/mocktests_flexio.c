@@ -0,0 +1,154 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_flexio.h"
+#include "mocktests_common.h"
+
+#include "devices/edma.h"
+#include "devices/flexio.h"
+
+static flexio_regs_s g_mock_flexio;
+static edma_regs_s   g_mock_edma;
+static edma_tcd_s    g_mock_tcd;
+
+static uint32_t g_mock_done;
+static uint8_t  g_mock_error;
+
+static void
+__mock_dma_done__(void* ctx, uint8_t error)
+{
+  (void)ctx;
+  g_mock_done++;
+  g_mock_error = error;
+}
+
+uint32_t
+test_flexio()
+{
+  MOCK_BEGIN();
+
+  // Register layouts against the reference manual
+  uintptr_t base = (uintptr_t)&g_mock_flexio;
+  MOCK_EXPECT((uintptr_t)&g_mock_flexio.SHIFTCTL[0] - base == 0x080);
+  MOCK_EXPECT((uintptr_t)&g_mock_flexio.SHIFTCFG[0] - base == 0x100);
+  MOCK_EXPECT((uintptr_t)&g_mock_flexio.SHIFTBUF[0] - base == 0x200);
+  MOCK_EXPECT((uintptr_t)&g_mock_flexio.SHIFTBUFBIS[0] - base == 0x280);
+  MOCK_EXPECT((uintptr_t)&g_mock_flexio.TIMCTL[0] - base == 0x400);
+  MOCK_EXPECT((uintptr_t)&g_mock_flexio.TIMCMP[0] - base == 0x500);
+  MOCK_EXPECT((uintptr_t)&g_mock_edma.SERQ - (uintptr_t)&g_mock_edma == 0x1b);
+  MOCK_EXPECT((uintptr_t)&g_mock_edma.CINT - (uintptr_t)&g_mock_edma == 0x1f);
+  MOCK_EXPECT((uintptr_t)&g_mock_edma.ERR - (uintptr_t)&g_mock_edma == 0x2c);
+  MOCK_EXPECT(sizeof(edma_tcd_s) == 0x20);
+
+  // Builders, 120MHz FlexIO clock
+  flexio_program_s spi;
+  flexio_program_spi(&spi, 0, 1, 2, 3, FLEXIO_CLOCK_HZ, 8000000);
+  MOCK_EXPECT(spi.timcmp == 0x0f07 && spi.hz == 7500000);
+  MOCK_EXPECT(spi.shiftctl == (FLEXIO_SHIFTCTL_TIMSEL(1) | FLEXIO_SHIFTCTL_TIMPOL_NEG | (0x3UL << 0x10) | (0x2UL << 0x8) | 0x2));
+  MOCK_EXPECT(((spi.timctl >> 0x18) & 0x3f) == 0x1 && ((spi.timctl >> 0x8) & 0x1f) == 3);
+
+  flexio_program_s led;
+  flexio_program_ws2812(&led, 1, 2, 5, FLEXIO_CLOCK_HZ);
+  MOCK_EXPECT(led.timcmp == 0x3f18 && led.hz == FLEXIO_WS2812_HZ && led.unit == 4);
+  MOCK_EXPECT(((led.timctl >> 0x10) & 0x3) == FLEXIO_PINCFG_OFF && ((led.timctl >> 0x18) & 0x3f) == 0x5);
+
+  flexio_program_s bus;
+  flexio_program_8080(&bus, 2, 3, 8, 16, FLEXIO_CLOCK_HZ, 20000000);
+  MOCK_EXPECT(bus.timcmp == 0x0702 && bus.hz == 20000000);
+  MOCK_EXPECT(((bus.shiftcfg >> 0x10) & 0x1f) == 7 && (bus.timctl & FLEXIO_TIMCTL_PINPOL_LOW));
+
+  // Slow clocks saturate the divider
+  flexio_program_s slow;
+  flexio_program_spi(&slow, 0, 0, 0, 1, FLEXIO_CLOCK_HZ, 100000);
+  MOCK_EXPECT((slow.timcmp & 0xff) == 0xff && slow.hz <= 100000 * 3);
+
+  // WS2812 symbols, MSB first
+  static const uint8_t grb[3] = {0xff, 0x00, 0x80};
+  uint32_t             words[FLEXIO_WS2812_WORDS(3)];
+  MOCK_EXPECT(flexio_ws2812_encode(grb, 3, words) == 3);
+  MOCK_EXPECT(words[0] == 0xdb6db692 && words[1] == 0x4924d249 && words[2] == 0x24000000);
+  uint32_t one[FLEXIO_WS2812_WORDS(1)];
+  MOCK_EXPECT(flexio_ws2812_encode(&grb[1], 1, one) == 1 && one[0] == 0x92492400);
+
+  // Load and polled writes
+  static flexio_s io;
+  flexio_init(&io, &g_mock_flexio, FLEXIO_CLOCK_HZ);
+  MOCK_EXPECT(g_mock_flexio.CTRL == FLEXIO_CTRL_FLEXEN);
+  MOCK_EXPECT(flexio_write(&io, grb, 1) == 0); // Nothing loaded
+
+  flexio_load(&io, &spi);
+  MOCK_EXPECT(g_mock_flexio.SHIFTCTL[0] == spi.shiftctl && g_mock_flexio.TIMCTL[1] == spi.timctl);
+  MOCK_EXPECT(g_mock_flexio.TIMCMP[1] == spi.timcmp && g_mock_flexio.TIMCFG[1] == spi.timcfg);
+
+  static const uint8_t frame[2] = {0xa5, 0x3c};
+  g_mock_flexio.SHIFTSTAT = 0x1;
+  MOCK_EXPECT(flexio_write(&io, frame, 2) == 2 && g_mock_flexio.SHIFTBUFBIS[0] == 0x3c000000);
+  MOCK_EXPECT((uintptr_t)flexio_tx_register(&io) == (uintptr_t)&g_mock_flexio.SHIFTBUFBIS[0] + 3);
+
+  flexio_load(&io, &bus);
+  MOCK_EXPECT(g_mock_flexio.TIMCTL[1] == 0 && g_mock_flexio.SHIFTCTL[0] == 0); // Previous lane stopped
+  static const uint8_t pixels[5] = {0x1, 0x2, 0x3, 0x4, 0x5};
+  g_mock_flexio.SHIFTSTAT = 0x1 << 2;
+  MOCK_EXPECT(flexio_write(&io, pixels, 5) == 0);
+  MOCK_EXPECT(flexio_write(&io, pixels, 4) == 4 && g_mock_flexio.SHIFTBUF[2] == 0x04030201);
+  MOCK_EXPECT(flexio_tx_register(&io) == (volatile void*)&g_mock_flexio.SHIFTBUF[2]);
+
+  // DMA feeding the shifter
+  static edma_channel_s dma;
+  edma_channel_init(&dma, &g_mock_edma, &g_mock_tcd, 3);
+  flexio_load(&io, &spi);
+  static uint8_t block[16];
+  MOCK_EXPECT(flexio_write_dma(&io, &dma, block, sizeof(block), &__mock_dma_done__, NULL) == 1);
+  MOCK_EXPECT(g_mock_tcd.SADDR == (uint32_t)(uintptr_t)block && g_mock_tcd.SOFF == 1 && g_mock_tcd.ATTR == 0);
+  MOCK_EXPECT(g_mock_tcd.DADDR == (uint32_t)(uintptr_t)&g_mock_flexio.SHIFTBUFBIS[0] + 3 && g_mock_tcd.DOFF == 0);
+  MOCK_EXPECT(g_mock_tcd.NBYTES == 1 && g_mock_tcd.CITER == 16 && g_mock_tcd.BITER == 16 && g_mock_tcd.SLAST == -16);
+  MOCK_EXPECT(g_mock_tcd.CSR == (EDMA_CSR_INTMAJOR | EDMA_CSR_DREQ));
+  MOCK_EXPECT(g_mock_edma.SERQ == 3 && dma.busy && (g_mock_flexio.SHIFTSDEN & 0x1));
+  MOCK_EXPECT(flexio_write_dma(&io, &dma, block, sizeof(block), &__mock_dma_done__, NULL) == 0); // Busy
+
+  g_mock_edma.INT = 0x1 << 4; // Other channel on the line
+  edma_service(&dma);
+  MOCK_EXPECT(g_mock_done == 0 && dma.busy);
+
+  g_mock_edma.INT = 0x1 << 3;
+  edma_service(&dma);
+  MOCK_EXPECT(g_mock_done == 1 && g_mock_error == 0 && g_mock_edma.CINT == 3 && !dma.busy);
+  edma_service(&dma); // Stale flag on the fake block, no second callback
+  MOCK_EXPECT(g_mock_done == 1);
+
+  g_mock_edma.INT = 0;
+  g_mock_edma.ERR = 0x1 << 3;
+  g_mock_edma.CERQ = 0;
+  MOCK_EXPECT(flexio_write_dma(&io, &dma, block, 8, &__mock_dma_done__, NULL) == 1);
+  edma_service(&dma);
+  MOCK_EXPECT(g_mock_done == 2 && g_mock_error == 1 && g_mock_edma.CERQ == 3 && g_mock_edma.CERR == 3);
+  g_mock_edma.ERR = 0;
+
+  // Word lanes move 32-bit units, only shifters 0-3 have requests
+  flexio_program_ws2812(&led, 1, 2, 5, FLEXIO_CLOCK_HZ);
+  flexio_load(&io, &led);
+  MOCK_EXPECT(flexio_write_dma(&io, &dma, words, sizeof(words), &__mock_dma_done__, NULL) == 1);
+  MOCK_EXPECT(g_mock_tcd.ATTR == EDMA_ATTR(EDMA_SIZE_32BIT, EDMA_SIZE_32BIT) && g_mock_tcd.NBYTES == 4);
+  MOCK_EXPECT(g_mock_tcd.CITER == 3 && g_mock_tcd.DADDR == (uint32_t)(uintptr_t)&g_mock_flexio.SHIFTBUFBIS[1]);
+  edma_stop(&dma);
+  flexio_program_ws2812(&led, 4, 2, 5, FLEXIO_CLOCK_HZ);
+  flexio_load(&io, &led);
+  MOCK_EXPECT(flexio_write_dma(&io, &dma, words, sizeof(words), &__mock_dma_done__, NULL) == 0);
+  MOCK_EXPECT(flexio_dma_source(2, 2) == EDMA_SOURCE_FLEXIO2_23 && flexio_dma_source(1, 0) == EDMA_SOURCE_FLEXIO1_01);
+  MOCK_EXPECT(flexio_dma_source(3, 0) == 0xff && flexio_dma_source(1, 4) == 0xff);
+
+  // DMAMUX request numbers, 4.4 p.52: LPI2C2 and LPI2C4 sit in the upper half
+  MOCK_EXPECT(EDMA_SOURCE_LPI2C1 == 17 && EDMA_SOURCE_LPI2C2 == 81 && EDMA_SOURCE_LPI2C3 == 18 && EDMA_SOURCE_LPI2C4 == 82);
+  MOCK_EXPECT(EDMA_SOURCE_LPI2C(1) == 17 && EDMA_SOURCE_LPI2C(2) == 81 && EDMA_SOURCE_LPI2C(3) == 18 && EDMA_SOURCE_LPI2C(4) == 82);
+
+  // Flush returns once both flags are up, release stops the lane
+  g_mock_flexio.SHIFTSTAT = 0x1 << 4;
+  g_mock_flexio.TIMSTAT   = 0x1 << 2;
+  flexio_flush(&io);
+  flexio_release(&io);
+  MOCK_EXPECT(g_mock_flexio.SHIFTCTL[4] == 0 && g_mock_flexio.TIMCTL[2] == 0 && !io.loaded);
+
+  MOCK_END();
+}
@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_FLEXIO_H
+#define MOCKTESTS_FLEXIO_H
+
+#include <stdint.h>
+
+/** @brief Program builders, WS2812 encoding, polled and DMA writes on fake FlexIO/eDMA blocks, returns failure count */
+uint32_t test_flexio();
+
+#endif // MOCKTESTS_FLEXIO_H
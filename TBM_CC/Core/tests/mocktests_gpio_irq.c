@@ -0,0 +1,122 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_gpio_irq.h"
+#include "mocktests_common.h"
+
+#include "devices/gpio_irq.h"
+
+/** @brief Fake GPIO module, ISR behaves as a plain register (W1C is emulated by the test) */
+static gpio_port_regs_s g_mock_gpio_irq;
+
+typedef struct
+{
+  uint32_t runs;
+  uint32_t order;
+  uint32_t pin;
+  uint64_t stamp;
+} mock_gpio_edge_s;
+
+static uint32_t g_mock_gpio_order;
+
+static void
+__mock_gpio_edge__(void* ctx, uint32_t pin, uint64_t stamp)
+{
+  mock_gpio_edge_s* edge = (mock_gpio_edge_s*)ctx;
+  edge->runs++;
+  edge->order = ++g_mock_gpio_order;
+  edge->pin   = pin;
+  edge->stamp = stamp;
+}
+
+/** @brief Hardware side of an edge, the flag is set whatever IMR says */
+static void
+__mock_gpio_flag__(uint32_t pin)
+{
+  g_mock_gpio_irq.ISR |= 0x1UL << pin;
+}
+
+/** @brief Service one entry, then let the W1C of the collected flags land */
+static uint32_t
+__mock_gpio_entry__(gpio_irq_s* irq, uint64_t now)
+{
+  uint32_t flags = g_mock_gpio_irq.ISR;
+  uint32_t run   = gpio_irq_service(irq, now);
+  g_mock_gpio_irq.ISR = flags & ~(flags & g_mock_gpio_irq.IMR);
+  return run;
+}
+
+uint32_t
+test_gpio_irq()
+{
+  MOCK_BEGIN();
+
+  static gpio_irq_s       irq;
+  static mock_gpio_edge_s button;
+  static mock_gpio_edge_s encoder;
+  static mock_gpio_edge_s level;
+
+  gpio_irq_init(&irq, &g_mock_gpio_irq);
+  g_mock_gpio_irq.ICR1     = 0xffffffff;
+  g_mock_gpio_irq.ICR2     = 0;
+  g_mock_gpio_irq.EDGE_SEL = 0;
+  g_mock_gpio_irq.IMR      = 0;
+
+  // Trigger programming, two ICR bits per pin, EDGE_SEL for both edges
+  gpio_irq_attach(&irq, 5, GPIO_IRQ_RISING, &__mock_gpio_edge__, &button, 100);
+  gpio_irq_attach(&irq, 20, GPIO_IRQ_BOTH, &__mock_gpio_edge__, &encoder, 0);
+  gpio_irq_attach(&irq, 17, GPIO_IRQ_HIGH, &__mock_gpio_edge__, &level, 0);
+  MOCK_EXPECT(((g_mock_gpio_irq.ICR1 >> 10) & 0x3) == GPIO_IRQ_RISING);
+  MOCK_EXPECT((g_mock_gpio_irq.ICR1 & ~(0x3UL << 10)) == (0xffffffff & ~(0x3UL << 10))); // Other pins kept
+  MOCK_EXPECT(((g_mock_gpio_irq.ICR2 >> 2) & 0x3) == GPIO_IRQ_HIGH);
+  MOCK_EXPECT(g_mock_gpio_irq.EDGE_SEL == (0x1UL << 20));
+  MOCK_EXPECT(g_mock_gpio_irq.IMR == ((0x1UL << 5) | (0x1UL << 17) | (0x1UL << 20)));
+  MOCK_EXPECT(irq.attached == g_mock_gpio_irq.IMR);
+
+  // Several pins in one entry, highest first, each with its own context and the entry stamp
+  g_mock_gpio_irq.ISR = 0;
+  __mock_gpio_flag__(5);
+  __mock_gpio_flag__(20);
+  __mock_gpio_flag__(17);
+  __mock_gpio_flag__(9); // Not unmasked, neither run nor cleared
+  g_mock_gpio_order = 0;
+  MOCK_EXPECT(__mock_gpio_entry__(&irq, 1000) == ((0x1UL << 5) | (0x1UL << 17) | (0x1UL << 20)));
+  MOCK_EXPECT(encoder.order == 1 && level.order == 2 && button.order == 3);
+  MOCK_EXPECT(encoder.pin == 20 && level.pin == 17 && button.pin == 5);
+  MOCK_EXPECT(button.stamp == 1000 && encoder.stamp == 1000);
+  MOCK_EXPECT(g_mock_gpio_irq.ISR == (0x1UL << 9));
+
+  // Debounce, an edge inside the window of the last accepted one is dropped
+  g_mock_gpio_irq.ISR = 0;
+  __mock_gpio_flag__(5);
+  MOCK_EXPECT(__mock_gpio_entry__(&irq, 1099) == 0);
+  MOCK_EXPECT(button.runs == 1 && irq.bounced == 1);
+  __mock_gpio_flag__(5);
+  MOCK_EXPECT(__mock_gpio_entry__(&irq, 1100) == (0x1UL << 5));
+  MOCK_EXPECT(button.runs == 2 && button.stamp == 1100);
+
+  // Without debounce every edge runs
+  __mock_gpio_flag__(20);
+  __mock_gpio_entry__(&irq, 1101);
+  __mock_gpio_flag__(20);
+  __mock_gpio_entry__(&irq, 1101);
+  MOCK_EXPECT(encoder.runs == 3);
+
+  // An entry with nothing flagged (the other half-port line) is counted, not dispatched
+  MOCK_EXPECT(__mock_gpio_entry__(&irq, 1200) == 0 && irq.spurious == 1);
+
+  // Detach masks the pin, re-attach starts a fresh debounce window
+  gpio_irq_detach(&irq, 5);
+  MOCK_EXPECT((g_mock_gpio_irq.IMR & (0x1UL << 5)) == 0 && (irq.attached & (0x1UL << 5)) == 0);
+  __mock_gpio_flag__(5);
+  MOCK_EXPECT(__mock_gpio_entry__(&irq, 1201) == 0 && button.runs == 2);
+  gpio_irq_attach(&irq, 5, GPIO_IRQ_FALLING, &__mock_gpio_edge__, &button, 100);
+  g_mock_gpio_irq.ISR = 0;
+  __mock_gpio_flag__(5);
+  MOCK_EXPECT(__mock_gpio_entry__(&irq, 1202) == (0x1UL << 5) && button.runs == 3);
+  MOCK_EXPECT(((g_mock_gpio_irq.ICR1 >> 10) & 0x3) == GPIO_IRQ_FALLING);
+
+  MOCK_END();
+}
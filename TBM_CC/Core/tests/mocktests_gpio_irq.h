@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_GPIO_IRQ_H
+#define MOCKTESTS_GPIO_IRQ_H
+
+#include <stdint.h>
+
+/** @brief Trigger programming, flag scan order, per-pin context and debounce on a fake port, returns failure count */
+uint32_t test_gpio_irq();
+
+#endif // MOCKTESTS_GPIO_IRQ_H
@@ -0,0 +1,88 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_gpio_port.h"
+#include "mocktests_common.h"
+
+#include "devices/gpio_port.h"
+
+#include <stddef.h>
+
+/** @brief Fake GPIO module, the write-only registers keep the last value written */
+static gpio_port_regs_s g_mock_gpio;
+
+uint32_t
+test_gpio_port()
+{
+  MOCK_BEGIN();
+
+  // Layout matches gpio_registers_e
+  MOCK_EXPECT(offsetof(gpio_port_regs_s, PSR) == 0x8);
+  MOCK_EXPECT(offsetof(gpio_port_regs_s, EDGE_SEL) == 0x1c);
+  MOCK_EXPECT(offsetof(gpio_port_regs_s, DR_SET) == 0x84);
+  MOCK_EXPECT(offsetof(gpio_port_regs_s, DR_CLEAR) == 0x88);
+  MOCK_EXPECT(offsetof(gpio_port_regs_s, DR_TOGGLE) == 0x8c);
+
+  // Base addresses of all three address ranges
+  MOCK_EXPECT(GPIO_PORT_ADDR(1) == 0x401b8000);
+  MOCK_EXPECT(GPIO_PORT_ADDR(4) == 0x401c4000);
+  MOCK_EXPECT(GPIO_PORT_ADDR(5) == 0x400c0000);
+  MOCK_EXPECT(GPIO_PORT_ADDR(7) == 0x42004000);
+  MOCK_EXPECT(GPIO_PORT_ADDR(9) == 0x4200c000);
+
+  // Masked write, one store per direction, pins outside the mask never written
+  gpio_port_write_masked(&g_mock_gpio, 0x0000ff00, 0x1234a5ff);
+  MOCK_EXPECT(g_mock_gpio.DR_SET == 0x0000a500);
+  MOCK_EXPECT(g_mock_gpio.DR_CLEAR == 0x00005a00);
+
+  gpio_port_write_field(&g_mock_gpio, 16, 8, 0x1c3);    // Bit 8 is outside the field
+  MOCK_EXPECT(g_mock_gpio.DR_SET == 0x00c30000);
+  MOCK_EXPECT(g_mock_gpio.DR_CLEAR == 0x003c0000);
+
+  gpio_port_write_field(&g_mock_gpio, 0, 32, 0xf0f0f0f0); // Whole port
+  MOCK_EXPECT(g_mock_gpio.DR_SET == 0xf0f0f0f0);
+  MOCK_EXPECT(g_mock_gpio.DR_CLEAR == 0x0f0f0f0f);
+
+  gpio_port_set(&g_mock_gpio, 0x9);
+  gpio_port_clear(&g_mock_gpio, 0x6);
+  gpio_port_toggle(&g_mock_gpio, 0x30);
+  MOCK_EXPECT(g_mock_gpio.DR_SET == 0x9 && g_mock_gpio.DR_CLEAR == 0x6 && g_mock_gpio.DR_TOGGLE == 0x30);
+
+  // Direction read-modify-write keeps the other pins
+  g_mock_gpio.GDIR = 0x1;
+  gpio_port_direction(&g_mock_gpio, 0x18, 1);
+  MOCK_EXPECT(g_mock_gpio.GDIR == 0x19);
+  gpio_port_direction(&g_mock_gpio, 0x9, 0);
+  MOCK_EXPECT(g_mock_gpio.GDIR == 0x10);
+
+  // Descriptors are constant initializers
+  static const gpio_pin_s pin = GPIO_PIN_AT(&g_mock_gpio, 3);
+  static const gpio_pin_s led = GPIO_PIN(7, 3);
+  MOCK_EXPECT(led.port == GPIO_PORT(7) && led.mask == 0x8);
+
+  gpio_pin_write(&pin, 1);
+  MOCK_EXPECT(g_mock_gpio.DR_SET == 0x8);
+  gpio_pin_write(&pin, 0);
+  MOCK_EXPECT(g_mock_gpio.DR_CLEAR == 0x8);
+  gpio_pin_toggle(&pin);
+  MOCK_EXPECT(g_mock_gpio.DR_TOGGLE == 0x8);
+
+  g_mock_gpio.PSR = 0x8;
+  MOCK_EXPECT(gpio_pin_read(&pin) == 1);
+  g_mock_gpio.PSR = 0x7;
+  MOCK_EXPECT(gpio_pin_read(&pin) == 0 && gpio_port_read(&g_mock_gpio) == 0x7);
+
+  // Routing, outputs go to the fast twin unless overridden, GPIO5 stays put
+  MOCK_EXPECT(gpio_route_module(2, 1, GPIO_ROUTE_AUTO) == 7);
+  MOCK_EXPECT(gpio_route_module(2, 0, GPIO_ROUTE_AUTO) == 2);
+  MOCK_EXPECT(gpio_route_module(1, 1, GPIO_ROUTE_NORMAL) == 1);
+  MOCK_EXPECT(gpio_route_module(4, 0, GPIO_ROUTE_FAST) == 9);
+  MOCK_EXPECT(gpio_route_module(8, 0, GPIO_ROUTE_AUTO) == 3); // A fast module maps back to its bank
+  MOCK_EXPECT(gpio_route_module(5, 1, GPIO_ROUTE_FAST) == 5);
+  MOCK_EXPECT(gpio_route_module(0, 1, GPIO_ROUTE_AUTO) == 0);
+  MOCK_EXPECT(gpio_route_bank(9) == 4 && gpio_route_bank(4) == 4);
+
+  MOCK_END();
+}
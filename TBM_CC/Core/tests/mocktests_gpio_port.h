@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_GPIO_PORT_H
+#define MOCKTESTS_GPIO_PORT_H
+
+#include <stdint.h>
+
+/** @brief Register layout, masked and field writes, pin descriptors on a fake port, module routing, returns failure count */
+uint32_t test_gpio_port();
+
+#endif // MOCKTESTS_GPIO_PORT_H
@@ -0,0 +1,93 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_gpio_registry.h"
+#include "mocktests_common.h"
+
+#include "devices/gpio_registry.h"
+
+/** @brief Two fake GPIO modules, the write-only registers keep the last value written */
+static gpio_port_regs_s g_mock_gpio_a;
+static gpio_port_regs_s g_mock_gpio_b;
+
+static void
+__mock_gpio_registry_reset__()
+{
+  g_mock_gpio_a.DR_SET = g_mock_gpio_a.DR_CLEAR = 0;
+  g_mock_gpio_b.DR_SET = g_mock_gpio_b.DR_CLEAR = 0;
+}
+
+uint32_t
+test_gpio_registry()
+{
+  MOCK_BEGIN();
+
+  static const gpio_pin_s clk  = GPIO_PIN_AT(&g_mock_gpio_a, 3);
+  static const gpio_pin_s data = GPIO_PIN_AT(&g_mock_gpio_b, 17);
+
+  // Never registered, before any add: every entry already points at the dummy word
+  uint8_t id;
+  for (id = 0; id <= GPIO_LINE_SINK; id++) { MOCK_EXPECT(g_gpio_lines[id].reg[0] != NULL && g_gpio_lines[id].reg[1] != NULL); }
+  gpio_line_write(7, 1);
+  gpio_line_write(7, 0);
+  MOCK_EXPECT(gpio_line_used() == 0);
+
+  uint8_t clk_id  = gpio_line_add(&clk);
+  uint8_t data_id = gpio_line_add(&data);
+  MOCK_EXPECT(clk_id == 0 && data_id == 1);
+  MOCK_EXPECT(gpio_line_used() == 0x3);
+
+  // One store to the precomputed register of the right port, nothing else touched
+  __mock_gpio_registry_reset__();
+  gpio_line_write(clk_id, 1);
+  MOCK_EXPECT(g_mock_gpio_a.DR_SET == 0x8 && g_mock_gpio_a.DR_CLEAR == 0);
+  gpio_line_write(data_id, 0);
+  MOCK_EXPECT(g_mock_gpio_b.DR_CLEAR == (0x1UL << 17) && g_mock_gpio_b.DR_SET == 0);
+  gpio_line_write(data_id, 0x80); // Any non-zero level is high
+  MOCK_EXPECT(g_mock_gpio_b.DR_SET == (0x1UL << 17));
+
+  // A freed ID writes nothing and is handed out again, lowest first
+  gpio_line_remove(clk_id);
+  MOCK_EXPECT(gpio_line_used() == 0x2);
+  __mock_gpio_registry_reset__();
+  gpio_line_write(clk_id, 1);
+  gpio_line_write(clk_id, 0);
+  MOCK_EXPECT(g_mock_gpio_a.DR_SET == 0 && g_mock_gpio_a.DR_CLEAR == 0);
+  MOCK_EXPECT(gpio_line_add(&clk) == clk_id);
+
+  // Fill the table, the next add fails and out of range IDs only hit free entries
+  uint32_t added = 2;
+  while (gpio_line_add(&data) != GPIO_LINE_NONE) { added++; }
+  MOCK_EXPECT(added == GPIO_LINES);
+  MOCK_EXPECT(gpio_line_used() == (0x1UL << GPIO_LINES) - 1);
+  MOCK_EXPECT(gpio_line_add(NULL) == GPIO_LINE_NONE);
+
+  // The failed add's ID drives nothing, not the pin that owns the last line
+  static const gpio_pin_s last = GPIO_PIN_AT(&g_mock_gpio_a, 9);
+  gpio_line_remove(GPIO_LINES - 1);
+  MOCK_EXPECT(gpio_line_add(&last) == GPIO_LINES - 1 && gpio_line_add(&data) == GPIO_LINE_NONE);
+  __mock_gpio_registry_reset__();
+  gpio_line_write(GPIO_LINE_NONE, 1);
+  gpio_line_write(GPIO_LINE_NONE, 0);
+  gpio_line_write(GPIO_LINES, 1);
+  MOCK_EXPECT(g_mock_gpio_a.DR_SET == 0 && g_mock_gpio_a.DR_CLEAR == 0);
+  MOCK_EXPECT(g_mock_gpio_b.DR_SET == 0 && g_mock_gpio_b.DR_CLEAR == 0);
+  gpio_line_write(GPIO_LINES - 1, 1);
+  MOCK_EXPECT(g_mock_gpio_a.DR_SET == (0x1UL << 9));
+
+  for (id = 2; id < GPIO_LINES; id++) { gpio_line_remove(id); }
+  gpio_line_remove(GPIO_LINE_NONE); // Ignored
+  MOCK_EXPECT(gpio_line_used() == 0x3);
+
+  __mock_gpio_registry_reset__();
+  gpio_line_write((uint8_t)(GPIO_LINES + 5), 1); // Past the table, the sink entry
+  MOCK_EXPECT(g_mock_gpio_a.DR_SET == 0 && g_mock_gpio_b.DR_SET == 0);
+
+  gpio_line_remove(clk_id);
+  gpio_line_remove(data_id);
+  MOCK_EXPECT(gpio_line_used() == 0);
+
+  MOCK_END();
+}
@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_GPIO_REGISTRY_H
+#define MOCKTESTS_GPIO_REGISTRY_H
+
+#include <stdint.h>
+
+/** @brief ID allocation, precomputed set/clear stores on fake ports, writes to freed IDs dropped, returns failure count */
+uint32_t test_gpio_registry();
+
+#endif // MOCKTESTS_GPIO_REGISTRY_H
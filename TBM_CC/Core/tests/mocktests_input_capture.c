@@ -0,0 +1,76 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_input_capture.h"
+#include "mocktests_common.h"
+
+#include "devices/input_capture.h"
+
+/** @brief Deterministic jitter pattern in counter ticks, zero mean over 8 edges */
+static const int32_t g_pps_jitter[8] = {3, -3, 5, -5, 1, -1, 0, 0};
+
+uint32_t
+test_input_capture()
+{
+  MOCK_BEGIN();
+
+  static capture_ring_s  ring;
+  static capture_stats_s stats;
+  capture_ring_init(&ring);
+  capture_stats_init(&stats);
+
+  // 1PPS on a 24MHz counter running 37ppm fast, starting close to the 32-bit wrap
+  const uint32_t ticks_per_pps = 24000888;
+  uint32_t       stamp         = 0xfff00000;
+  uint32_t       edge, popped  = 0, value;
+
+  for (edge = 0; edge < 200; edge++)
+  {
+    MOCK_EXPECT(capture_ring_push(&ring, stamp + (uint32_t)g_pps_jitter[edge & 0x7]));
+    stamp += ticks_per_pps;
+
+    // Consumer drains every 16 edges, as a main loop would
+    if ((edge & 0xf) == 0xf)
+    {
+      while (capture_ring_pop(&ring, &value)) { capture_stats_add(&stats, value); popped++; }
+    }
+  }
+  while (capture_ring_pop(&ring, &value)) { capture_stats_add(&stats, value); popped++; }
+
+  MOCK_EXPECT(popped == 200 && ring.overruns == 0);
+  MOCK_EXPECT(stats.count == 199);
+
+  // The wraps disappear in the modulo 2^32 intervals, the mean is the counter's true rate
+  uint32_t mean = capture_stats_mean(&stats);
+  MOCK_EXPECT(mean >= ticks_per_pps - 1 && mean <= ticks_per_pps + 1);
+  MOCK_EXPECT(stats.min == ticks_per_pps - 10 && stats.max == ticks_per_pps + 8);
+
+  // Interval deviations cycle through -6, 8, -10, 6, -2, 1, 0, 3, an RMS of ~5.6 ticks
+  uint32_t jitter = capture_stats_jitter(&stats);
+  MOCK_EXPECT(jitter >= 5 && jitter <= 7);
+
+  // Edge rate against the nominal 24MHz: 24000000 / 24000888 Hz = 999.963 mHz
+  MOCK_EXPECT(capture_stats_freq_mhz(&stats, 24000000) == 999);
+
+  // High rate stream, 1MHz edges at 24MHz give 1000000000 mHz
+  capture_stats_init(&stats);
+  for (edge = 0; edge < 1000; edge++) { capture_stats_add(&stats, edge * 24); }
+  MOCK_EXPECT(capture_stats_freq_mhz(&stats, 24000000) == 1000000000);
+  MOCK_EXPECT(capture_stats_jitter(&stats) == 0);
+
+  // Block push from a batching producer, overruns are counted, not wrapped over
+  uint32_t block[CAPTURE_RING_SIZE + 8];
+  for (edge = 0; edge < CAPTURE_RING_SIZE + 8; edge++) { block[edge] = edge; }
+  capture_ring_init(&ring);
+  MOCK_EXPECT(capture_ring_push(&ring, 0xdead));
+  MOCK_EXPECT(capture_ring_push_block(&ring, block, CAPTURE_RING_SIZE + 8) == CAPTURE_RING_SIZE - 1);
+  MOCK_EXPECT(ring.overruns == 9);
+  MOCK_EXPECT(!capture_ring_push(&ring, 0xbeef) && ring.overruns == 10);
+  MOCK_EXPECT(capture_ring_count(&ring) == CAPTURE_RING_SIZE);
+  MOCK_EXPECT(capture_ring_pop(&ring, &value) && value == 0xdead);
+  MOCK_EXPECT(capture_ring_pop(&ring, &value) && value == 0);
+
+  MOCK_END();
+}
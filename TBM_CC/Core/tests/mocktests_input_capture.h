@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_INPUT_CAPTURE_H
+#define MOCKTESTS_INPUT_CAPTURE_H
+
+#include <stdint.h>
+
+/** @brief Replays a synthetic 1PPS capture stream through the ring and the statistics, returns failure count */
+uint32_t test_input_capture();
+
+#endif // MOCKTESTS_INPUT_CAPTURE_H
@@ -0,0 +1,96 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_irq_dispatch.h"
+#include "mocktests_common.h"
+
+#include "sys/irq_dispatch.h"
+
+/** @brief A device instance as a handler would see it, 'pending' stands in for its status flag */
+typedef struct
+{
+  irq_slot_s slot;
+  uint8_t    pending;
+  uint32_t   handled;
+  uint32_t   order;
+} mock_irq_device_s;
+
+static uint32_t g_dispatch_order;
+
+static void
+__mock_device_isr__(void* ctx)
+{
+  mock_irq_device_s* dev = (mock_irq_device_s*)ctx;
+  if (!dev->pending) { return; } // Shared line, not ours
+
+  dev->pending = 0;
+  dev->handled++;
+  dev->order = ++g_dispatch_order;
+}
+
+static void
+__mock_oneshot_isr__(void* ctx)
+{
+  mock_irq_device_s* dev = (mock_irq_device_s*)ctx;
+  dev->handled++;
+  irq_detach(&dev->slot); // Leaves the chain from inside the dispatch
+}
+
+IRQ_DISPATCH_TRAMPOLINE(__mock_gpt1_line__, IRQ_GPT1)
+
+uint32_t
+test_irq_dispatch()
+{
+  MOCK_BEGIN();
+
+  static mock_irq_device_s a, b, c, once;
+
+  // Three instances on one line, each handles only its own flag
+  irq_attach(&a.slot, IRQ_GPT1, &__mock_device_isr__, &a);
+  irq_attach(&b.slot, IRQ_GPT1, &__mock_device_isr__, &b);
+  irq_attach(&c.slot, IRQ_GPT1, &__mock_device_isr__, &c);
+  MOCK_EXPECT(g_irq_lines[IRQ_GPT1] == &a.slot && a.slot.next == &b.slot && b.slot.next == &c.slot);
+
+  b.pending = 1;
+  irq_dispatch(IRQ_GPT1);
+  MOCK_EXPECT(a.handled == 0 && b.handled == 1 && c.handled == 0);
+
+  // Attach order is dispatch order
+  a.pending = c.pending = 1;
+  __mock_gpt1_line__(); // What the vector of a fast line runs
+  MOCK_EXPECT(a.handled == 1 && c.handled == 1 && a.order < c.order);
+
+  // Re-attaching to the same line does not link the slot twice
+  irq_attach(&b.slot, IRQ_GPT1, &__mock_device_isr__, &b);
+  MOCK_EXPECT(c.slot.next == NULL && b.slot.next == &c.slot);
+
+  // Attaching to another line moves the slot
+  irq_attach(&b.slot, IRQ_GPT2, &__mock_device_isr__, &b);
+  MOCK_EXPECT(a.slot.next == &c.slot && g_irq_lines[IRQ_GPT2] == &b.slot);
+  b.pending = 1;
+  irq_dispatch(IRQ_GPT1);
+  MOCK_EXPECT(b.handled == 1);
+  irq_dispatch(IRQ_GPT2);
+  MOCK_EXPECT(b.handled == 2);
+
+  // A handler detaching itself does not break the walk
+  irq_attach(&once.slot, IRQ_GPT1, &__mock_oneshot_isr__, &once);
+  irq_detach(&a.slot);
+  irq_attach(&a.slot, IRQ_GPT1, &__mock_device_isr__, &a); // Now behind 'once'
+  a.pending = 1;
+  irq_dispatch(IRQ_GPT1);
+  irq_dispatch(IRQ_GPT1);
+  MOCK_EXPECT(once.handled == 1 && !once.slot.attached && a.handled == 2);
+
+  // Detaching everything empties the lines, a stale detach is a no-op
+  irq_detach(&a.slot);
+  irq_detach(&b.slot);
+  irq_detach(&c.slot);
+  irq_detach(&c.slot);
+  MOCK_EXPECT(g_irq_lines[IRQ_GPT1] == NULL && g_irq_lines[IRQ_GPT2] == NULL);
+  irq_dispatch(IRQ_GPT1);
+
+  MOCK_END();
+}
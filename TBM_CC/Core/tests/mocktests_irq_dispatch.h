@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_IRQ_DISPATCH_H
+#define MOCKTESTS_IRQ_DISPATCH_H
+
+#include <stdint.h>
+
+/** @brief Shared lines, per-slot context, re-attach and detach from a handler, returns failure count */
+uint32_t test_irq_dispatch();
+
+#endif // MOCKTESTS_IRQ_DISPATCH_H
@@ -0,0 +1,110 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_irq_latency.h"
+#include "mocktests_common.h"
+
+#include "sys/irq_latency.h"
+
+/**
+ * @brief   Simulated PIT channel plus a competing ISR at a fixed priority
+ * @details The channel expires every 'ldval + 1' ticks, entry costs 'stacking'
+ *          ticks. A load ISR runs 'load_ticks' every 'load_period' ticks and
+ *          delays the PIT ISR whenever it is active and not preempted, i.e.
+ *          when the PIT priority is numerically the same or higher.
+ **/
+typedef struct
+{
+  uint32_t ldval;
+  uint32_t stacking;
+  uint32_t load_period;
+  uint32_t load_ticks;
+  uint8_t  load_priority;
+} sim_pit_s;
+
+/**
+ * @brief CVAL the ISR would read for an expiry 'phase' ticks into the load period
+ * @note  32-bit only, this file is also in the firmware build which has no __aeabi_uldivmod
+ **/
+static uint32_t
+__sim_cval_on_entry__(const sim_pit_s* sim, uint8_t pit_priority, uint32_t phase)
+{
+  uint32_t delay = sim->stacking;
+
+  if (pit_priority >= sim->load_priority && phase < sim->load_ticks) { delay += sim->load_ticks - phase; }
+
+  return sim->ldval - delay; // Counting down from LDVAL since the reload at expiry
+}
+
+static void
+__sim_run__(const sim_pit_s* sim, uint8_t pit_priority, uint32_t samples)
+{
+  irq_latency_stats_s* stats = irq_latency_level(pit_priority);
+  uint32_t             step  = (sim->ldval % sim->load_period + 1) % sim->load_period;
+  uint32_t             phase = 0; // Expiry time modulo load_period
+  uint32_t             sample;
+
+  irq_latency_init(stats);
+  for (sample = 0; sample < samples; sample++)
+  {
+    phase += step;
+    if (phase >= sim->load_period) { phase -= sim->load_period; }
+    irq_latency_record(stats, irq_latency_from_cval(sim->ldval, __sim_cval_on_entry__(sim, pit_priority, phase)));
+  }
+}
+
+uint32_t
+test_irq_latency()
+{
+  MOCK_BEGIN();
+
+  irq_latency_stats_s stats;
+
+  // Fixed samples, mean/jitter in Q8 and both histograms
+  irq_latency_init(&stats);
+  irq_latency_record(&stats, 10);
+  irq_latency_record(&stats, 14);
+  irq_latency_record(&stats, 10);
+  irq_latency_record(&stats, 14);
+  irq_latency_record(&stats, 200); // Beyond the histogram, lands in the last bucket
+  MOCK_EXPECT(stats.count == 5 && stats.min == 10 && stats.max == 200);
+  MOCK_EXPECT(irq_latency_mean_q8(&stats) == (248 << 0x8) / 5);
+  MOCK_EXPECT(stats.latency_hist[10] == 2 && stats.latency_hist[14] == 2 && stats.latency_hist[IRQ_LATENCY_BUCKETS - 1] == 1);
+  MOCK_EXPECT(stats.jitter_hist[0] == 1 && stats.jitter_hist[4] == 3 && stats.jitter_hist[IRQ_LATENCY_BUCKETS - 1] == 1);
+  MOCK_EXPECT(irq_latency_percentile(&stats, 500) == 14 && irq_latency_percentile(&stats, 1000) == IRQ_LATENCY_BUCKETS - 1);
+
+  // Constant latency has no jitter
+  irq_latency_init(&stats);
+  uint32_t idx;
+  for (idx = 0; idx < 100; idx++) { irq_latency_record(&stats, 12); }
+  MOCK_EXPECT(irq_latency_jitter_q8(&stats) == 0 && irq_latency_mean_q8(&stats) == 12 << 0x8);
+
+  // 10us PIT period at 150MHz, 12 ticks of stacking, a 1.5us load ISR every 7us at priority 0x80
+  const sim_pit_s sim = {
+    .ldval         = 1499,
+    .stacking      = 12,
+    .load_period   = 1051,
+    .load_ticks    = 225,
+    .load_priority = 0x80,
+  };
+
+  irq_latency_init_all();
+  __sim_run__(&sim, 0x00, 2000); // Preempts the load
+  __sim_run__(&sim, 0xf0, 2000); // Waits behind it
+
+  const irq_latency_stats_s* high = irq_latency_level(0x00);
+  const irq_latency_stats_s* low  = irq_latency_level(0xf0);
+
+  MOCK_EXPECT(high->count == 2000 && high->min == 12 && high->max == 12);
+  MOCK_EXPECT(irq_latency_jitter_q8(high) == 0 && high->jitter_hist[0] == 2000);
+
+  MOCK_EXPECT(low->count == 2000 && low->min == 12 && low->max > 12 && low->max <= 12 + 225);
+  MOCK_EXPECT(irq_latency_jitter_q8(low) > irq_latency_jitter_q8(high));
+  MOCK_EXPECT(irq_latency_mean_q8(low) > irq_latency_mean_q8(high));
+  MOCK_EXPECT(irq_latency_percentile(low, 500) <= irq_latency_percentile(low, 990));
+  MOCK_EXPECT(irq_latency_level(0x40)->count == 0);
+
+  MOCK_END();
+}
@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_IRQ_LATENCY_H
+#define MOCKTESTS_IRQ_LATENCY_H
+
+#include <stdint.h>
+
+/** @brief Latency statistics against a simulated PIT and a competing ISR, returns failure count */
+uint32_t test_irq_latency();
+
+#endif // MOCKTESTS_IRQ_LATENCY_H
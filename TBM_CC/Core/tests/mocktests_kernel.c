@@ -0,0 +1,136 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_kernel.h"
+#include "mocktests_common.h"
+
+#include "sys/kernel.h"
+
+#define MOCK_KERNEL_TICKS 64
+
+/**
+ * @brief   Host simulation of the port: one tick is one slice of the current thread
+ * @details 'period' > 0 makes a thread run for one tick then sleep 'period' ticks,
+ *          0 keeps it busy (CPU bound). 'ran' counts the ticks it held the CPU.
+ **/
+typedef struct
+{
+  kthread_s thread;
+  uint32_t  period;
+  uint32_t  ran;
+  uint32_t  last_tick;
+} mock_kthread_s;
+
+static kthread_s g_mock_idle;
+static uint32_t  g_mock_idle_ran;
+
+/** @brief What the port does on one tick: run the current thread, then tick and reschedule */
+static void
+__mock_kernel_step__()
+{
+  kthread_s* current = ksched_pick();
+  if (current == &g_mock_idle)
+  {
+    g_mock_idle_ran++;
+  }
+  else
+  {
+    mock_kthread_s* mock = ILIST_ENTRY(current, mock_kthread_s, thread);
+    mock->ran++;
+    mock->last_tick = ksched_ticks();
+    if (mock->period != 0) { ksched_sleep(mock->period); }
+  }
+  ksched_tick();
+}
+
+static void
+__mock_kthread__(mock_kthread_s* mock, uint8_t priority, uint32_t period)
+{
+  mock->thread.priority = priority;
+  mock->period          = period;
+  mock->ran             = 0;
+  ksched_add(&mock->thread);
+}
+
+uint32_t
+test_kernel_sched()
+{
+  MOCK_BEGIN();
+
+  static mock_kthread_s high, mid_a, mid_b, low;
+  uint32_t              tick;
+
+  // Only the idle thread, it runs
+  ksched_init(&g_mock_idle);
+  MOCK_EXPECT(ksched_pick() == &g_mock_idle && g_mock_idle.priority == KERNEL_IDLE_PRIORITY);
+
+  // Highest priority first, a new higher thread makes a switch pending
+  __mock_kthread__(&low, 0x5, 0);
+  MOCK_EXPECT(ksched_switch_pending() && ksched_pick() == &low.thread);
+  __mock_kthread__(&high, 0x1, 0);
+  MOCK_EXPECT(ksched_switch_pending() && ksched_pick() == &high.thread);
+  MOCK_EXPECT(!ksched_switch_pending());
+
+  // Suspend drops to the next priority, resume preempts it again
+  ksched_suspend(&high.thread);
+  MOCK_EXPECT(high.thread.state == KTHREAD_SUSPENDED && ksched_pick() == &low.thread);
+  ksched_resume(&high.thread);
+  MOCK_EXPECT(ksched_switch_pending() && ksched_pick() == &high.thread);
+
+  // Exit retires the current thread
+  ksched_exit();
+  MOCK_EXPECT(high.thread.state == KTHREAD_DEAD && ksched_pick() == &low.thread);
+  ksched_resume(&high.thread); // Dead stays dead
+  MOCK_EXPECT(ksched_pick() == &low.thread);
+
+  // Equal priority peers share the CPU tick by tick, the lower one starves
+  ksched_init(&g_mock_idle);
+  __mock_kthread__(&mid_a, 0x2, 0);
+  __mock_kthread__(&mid_b, 0x2, 0);
+  __mock_kthread__(&low, 0x5, 0);
+  for (tick = 0; tick < 10; tick++) { __mock_kernel_step__(); }
+  MOCK_EXPECT(mid_a.ran == 5 && mid_b.ran == 5 && low.ran == 0);
+
+  // Yield hands the rest of the slice to the peer
+  ksched_pick();
+  kthread_s* before = ksched_current();
+  ksched_yield();
+  MOCK_EXPECT(ksched_switch_pending() && ksched_pick() != before);
+
+  // Periodic threads preempt the busy one on their wake tick, in priority order
+  ksched_init(&g_mock_idle);
+  __mock_kthread__(&high, 0x0, 4);
+  __mock_kthread__(&mid_a, 0x2, 8);
+  __mock_kthread__(&low, 0x5, 0);
+  for (tick = 0; tick < MOCK_KERNEL_TICKS; tick++) { __mock_kernel_step__(); }
+  MOCK_EXPECT(high.ran == MOCK_KERNEL_TICKS / 4);
+  MOCK_EXPECT(mid_a.ran == MOCK_KERNEL_TICKS / 8);
+  MOCK_EXPECT(low.ran == MOCK_KERNEL_TICKS - high.ran - mid_a.ran);
+  MOCK_EXPECT(g_mock_idle_ran == 0);
+
+  // Only sleepers, the idle thread fills the gaps
+  ksched_suspend(&low.thread);
+  g_mock_idle_ran = 0;
+  high.ran        = 0;
+  for (tick = 0; tick < MOCK_KERNEL_TICKS; tick++) { __mock_kernel_step__(); }
+  MOCK_EXPECT(high.ran == MOCK_KERNEL_TICKS / 4);
+  MOCK_EXPECT(g_mock_idle_ran == MOCK_KERNEL_TICKS - high.ran - MOCK_KERNEL_TICKS / 8);
+
+  // A sleeper resumed early is ready at once
+  MOCK_EXPECT(ksched_pick() == &high.thread);
+  ksched_sleep(10);
+  MOCK_EXPECT(high.thread.state == KTHREAD_SLEEPING && ksched_pick() != &high.thread);
+  ksched_resume(&high.thread);
+  MOCK_EXPECT(high.thread.state == KTHREAD_READY && ksched_pick() == &high.thread);
+
+  // Idle can not block
+  ksched_init(&g_mock_idle);
+  ksched_pick();
+  ksched_sleep(4);
+  ksched_suspend(&g_mock_idle);
+  MOCK_EXPECT(g_mock_idle.state == KTHREAD_READY && ksched_pick() == &g_mock_idle);
+
+  MOCK_END();
+}
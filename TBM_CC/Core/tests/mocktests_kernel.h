@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_KERNEL_H
+#define MOCKTESTS_KERNEL_H
+
+#include <stdint.h>
+
+/** @brief Kernel scheduling policy: preemption, time slices, sleep, suspend/resume and exit, returns failure count */
+uint32_t test_kernel_sched();
+
+#endif // MOCKTESTS_KERNEL_H
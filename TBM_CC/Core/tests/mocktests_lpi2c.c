@@ -0,0 +1,159 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_lpi2c.h"
+#include "mocktests_common.h"
+
+#include "devices/edma.h"
+#include "devices/lpi2c.h"
+
+static lpi2c_regs_s g_mock_lpi2c;
+static edma_regs_s  g_mock_edma;
+static edma_tcd_s   g_mock_tcd;
+
+static uint32_t       g_mock_done;
+static lpi2c_status_e g_mock_status;
+
+static void
+__mock_i2c_done__(void* ctx, lpi2c_status_e status)
+{
+  (void)ctx;
+  g_mock_done++;
+  g_mock_status = status;
+}
+
+uint32_t
+test_lpi2c()
+{
+  MOCK_BEGIN();
+
+  // Register layout against the reference manual
+  uintptr_t base = (uintptr_t)&g_mock_lpi2c;
+  MOCK_EXPECT((uintptr_t)&g_mock_lpi2c.MCR - base == 0x10);
+  MOCK_EXPECT((uintptr_t)&g_mock_lpi2c.MCFGR1 - base == 0x24);
+  MOCK_EXPECT((uintptr_t)&g_mock_lpi2c.MCCR0 - base == 0x48);
+  MOCK_EXPECT((uintptr_t)&g_mock_lpi2c.MFSR - base == 0x5c);
+  MOCK_EXPECT((uintptr_t)&g_mock_lpi2c.MTDR - base == 0x60);
+  MOCK_EXPECT((uintptr_t)&g_mock_lpi2c.MRDR - base == 0x70);
+
+  // SCL timing from the 24MHz oscillator
+  lpi2c_timing_s timing;
+  MOCK_EXPECT(lpi2c_timing(LPI2C_CLOCK_HZ, LPI2C_FAST_HZ, &timing) == 1);
+  MOCK_EXPECT(timing.clklo == 33 && timing.clkhi == 22 && timing.prescale == 0 && timing.hz == LPI2C_FAST_HZ);
+  MOCK_EXPECT(lpi2c_timing(LPI2C_CLOCK_HZ, LPI2C_FAST_PLUS_HZ, &timing) == 1);
+  MOCK_EXPECT(timing.clklo == 12 && timing.clkhi == 7 && timing.hz == LPI2C_FAST_PLUS_HZ);
+  MOCK_EXPECT(lpi2c_timing(LPI2C_CLOCK_HZ, LPI2C_STANDARD_HZ, &timing) == 1);
+  MOCK_EXPECT(timing.prescale == 2 && timing.clklo == 35 && timing.clkhi == 23 && timing.hz == LPI2C_STANDARD_HZ);
+  MOCK_EXPECT(lpi2c_timing(LPI2C_CLOCK_HZ, 3400000, &timing) == 1 && timing.hz <= 3400000);
+
+  // The SCL latency rounds down with the prescaler, the period is exactly what the controller makes
+  uint32_t scl_hz;
+  for (scl_hz = 50000; scl_hz <= 1000000; scl_hz += 50000)
+  {
+    MOCK_EXPECT(lpi2c_timing(LPI2C_CLOCK_HZ, scl_hz, &timing) == 1);
+    uint32_t latency = (2 + timing.filt) >> timing.prescale;
+    uint32_t period  = (timing.clklo + timing.clkhi + 2 + latency) << timing.prescale;
+    MOCK_EXPECT(timing.hz == LPI2C_CLOCK_HZ / period && timing.hz <= scl_hz);
+  }
+  MOCK_EXPECT(lpi2c_timing(LPI2C_CLOCK_HZ, 0, &timing) == 0);
+
+  // Init, 4-word FIFO
+  static lpi2c_s bus;
+  g_mock_lpi2c.PARAM = 0x2;
+  lpi2c_init(&bus, &g_mock_lpi2c, LPI2C_CLOCK_HZ, LPI2C_FAST_PLUS_HZ);
+  MOCK_EXPECT(bus.fifo == 4 && bus.hz == LPI2C_FAST_PLUS_HZ && g_mock_lpi2c.MCR == LPI2C_MCR_MEN);
+  MOCK_EXPECT(g_mock_lpi2c.MCCR0 == (12 | (7 << 0x8) | (11 << 0x10) | (4 << 0x18)) && g_mock_lpi2c.MFCR == 2);
+
+  // Interrupt path, one free word per step so every command shows up in MTDR
+  static const uint8_t cmd[2]  = {0x00, 0xaf};
+  static const uint8_t data[2] = {0x12, 0x34};
+  g_mock_lpi2c.MFSR = 3;
+  g_mock_lpi2c.MSR  = LPI2C_MSR_TDF | LPI2C_MSR_SDF; // Stale STOP of an earlier transfer
+  MOCK_EXPECT(lpi2c_write_async(&bus, 0x80, cmd, 2, data, 2, &__mock_i2c_done__, NULL) == 0); // 8-bit address
+  MOCK_EXPECT(lpi2c_write_async(&bus, 0x3c, cmd, 2, data, 2, &__mock_i2c_done__, NULL) == 1);
+  MOCK_EXPECT(g_mock_lpi2c.MTDR == (LPI2C_CMD_START | 0x78) && lpi2c_busy(&bus));
+  MOCK_EXPECT(g_mock_lpi2c.MIER == (LPI2C_MIER_TDIE | LPI2C_MSR_ERRORS));
+  MOCK_EXPECT(lpi2c_write_async(&bus, 0x3c, cmd, 2, data, 2, &__mock_i2c_done__, NULL) == 0); // Busy
+
+  static const uint32_t expect[5] = {0x00, 0xaf, 0x12, 0x34, LPI2C_CMD_STOP};
+  uint32_t              step;
+  g_mock_lpi2c.MSR = LPI2C_MSR_TDF;
+  for (step = 0; step < 5; step++)
+  {
+    lpi2c_service(&bus);
+    MOCK_EXPECT(g_mock_lpi2c.MTDR == expect[step]);
+  }
+  MOCK_EXPECT(bus.phase == LPI2C_STOP && g_mock_lpi2c.MIER == (LPI2C_MSR_SDF | LPI2C_MSR_ERRORS));
+  lpi2c_service(&bus);
+  MOCK_EXPECT(g_mock_done == 0); // No STOP on the bus yet
+
+  g_mock_lpi2c.MSR = LPI2C_MSR_SDF;
+  lpi2c_service(&bus);
+  MOCK_EXPECT(g_mock_done == 1 && g_mock_status == LPI2C_OK && !lpi2c_busy(&bus) && g_mock_lpi2c.MIER == 0);
+
+  // An empty FIFO takes START, head, data and STOP in one go
+  static const uint8_t one = 0xa5;
+  g_mock_lpi2c.MFSR = 0;
+  MOCK_EXPECT(lpi2c_write_async(&bus, 0x3c, &one, 1, data, 2, NULL, NULL) == 1);
+  MOCK_EXPECT(g_mock_lpi2c.MTDR == 0x34 && bus.data_len == 0 && bus.phase == LPI2C_FIFO);
+  g_mock_lpi2c.MSR = LPI2C_MSR_TDF | LPI2C_MSR_SDF;
+  MOCK_EXPECT(lpi2c_wait(&bus) == LPI2C_OK && g_mock_lpi2c.MTDR == LPI2C_CMD_STOP && g_mock_done == 1);
+
+  // NACK on the address, FIFO flushed and the bus released
+  g_mock_lpi2c.MFSR = 3;
+  g_mock_lpi2c.MSR  = 0;
+  MOCK_EXPECT(lpi2c_write_async(&bus, 0x3d, cmd, 2, data, 2, &__mock_i2c_done__, NULL) == 1);
+  g_mock_lpi2c.MSR = LPI2C_MSR_NDF;
+  lpi2c_service(&bus);
+  MOCK_EXPECT(g_mock_done == 2 && g_mock_status == LPI2C_NACK && bus.errors == 1 && !lpi2c_busy(&bus));
+  MOCK_EXPECT((g_mock_lpi2c.MCR & LPI2C_MCR_RTF) && g_mock_lpi2c.MTDR == LPI2C_CMD_STOP);
+  g_mock_lpi2c.MCR = LPI2C_MCR_MEN;
+
+  // DMA path, the CPU queues START and head, the channel the data, STOP after its completion
+  static edma_channel_s dma;
+  static uint8_t        frame[1024];
+  edma_channel_init(&dma, &g_mock_edma, &g_mock_tcd, 5);
+  lpi2c_attach_dma(&bus, &dma);
+  static const uint8_t ctrl = 0x40;
+  g_mock_lpi2c.MSR          = 0;
+  MOCK_EXPECT(lpi2c_write_async(&bus, 0x3c, &ctrl, 1, frame, sizeof(frame), &__mock_i2c_done__, NULL) == 1);
+  MOCK_EXPECT(bus.phase == LPI2C_DMA && g_mock_lpi2c.MTDR == 0x40 && g_mock_lpi2c.MDER == LPI2C_MDER_TDDE);
+  MOCK_EXPECT(g_mock_tcd.SADDR == (uint32_t)(uintptr_t)frame && g_mock_tcd.DADDR == (uint32_t)(uintptr_t)&g_mock_lpi2c.MTDR);
+  MOCK_EXPECT(g_mock_tcd.CITER == sizeof(frame) && g_mock_tcd.NBYTES == 1 && g_mock_tcd.DOFF == 0);
+  MOCK_EXPECT(g_mock_edma.SERQ == 5 && dma.busy && g_mock_lpi2c.MIER == LPI2C_MSR_ERRORS);
+
+  g_mock_lpi2c.MSR = LPI2C_MSR_TDF; // No refill while the channel owns the FIFO
+  lpi2c_service(&bus);
+  MOCK_EXPECT(g_mock_lpi2c.MTDR == 0x40 && bus.phase == LPI2C_DMA);
+
+  g_mock_lpi2c.MFSR = 4; // Last data bytes still queued, STOP waits for room
+  g_mock_edma.INT   = 0x1 << 5;
+  edma_service(&dma);
+  MOCK_EXPECT(bus.phase == LPI2C_FIFO && g_mock_lpi2c.MDER == 0 && g_mock_lpi2c.MTDR == 0x40);
+  g_mock_lpi2c.MFSR = 2;
+  lpi2c_service(&bus);
+  MOCK_EXPECT(g_mock_lpi2c.MTDR == LPI2C_CMD_STOP && bus.phase == LPI2C_STOP);
+  g_mock_lpi2c.MSR = LPI2C_MSR_SDF;
+  lpi2c_service(&bus);
+  MOCK_EXPECT(g_mock_done == 3 && g_mock_status == LPI2C_OK && !dma.busy);
+
+  // Arbitration lost mid-frame stops the channel
+  g_mock_edma.INT  = 0;
+  g_mock_lpi2c.MSR = 0;
+  MOCK_EXPECT(lpi2c_write_async(&bus, 0x3c, &ctrl, 1, frame, sizeof(frame), &__mock_i2c_done__, NULL) == 1);
+  g_mock_lpi2c.MSR = LPI2C_MSR_ALF;
+  lpi2c_service(&bus);
+  MOCK_EXPECT(g_mock_done == 4 && g_mock_status == LPI2C_ARBITRATION && !dma.busy && g_mock_edma.CERQ == 5);
+  MOCK_EXPECT(g_mock_lpi2c.MDER == 0 && g_mock_lpi2c.MTDR != LPI2C_CMD_STOP); // Bus belongs to the other master
+
+  // Short blocks stay on the interrupt path
+  g_mock_lpi2c.MSR  = 0;
+  g_mock_lpi2c.MFSR = 0;
+  g_mock_edma.SERQ  = 0;
+  MOCK_EXPECT(lpi2c_write_async(&bus, 0x3c, &ctrl, 1, data, 2, NULL, NULL) == 1);
+  MOCK_EXPECT(bus.phase == LPI2C_FIFO && g_mock_edma.SERQ == 0 && g_mock_lpi2c.MDER == 0);
+
+  MOCK_END();
+}
@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_LPI2C_H
+#define MOCKTESTS_LPI2C_H
+
+#include <stdint.h>
+
+/** @brief SCL timing, FIFO refills, NACK abort and DMA writes on fake LPI2C/eDMA blocks, returns failure count */
+uint32_t test_lpi2c();
+
+#endif // MOCKTESTS_LPI2C_H
@@ -0,0 +1,67 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_pinmux.h"
+#include "mocktests_common.h"
+
+#include "devices/pinmux.h"
+
+/** @brief Fake SW_MUX_CTL / SW_PAD_CTL banks and one daisy register */
+static vuint32_t g_mock_mux[PINMUX_PADS];
+static vuint32_t g_mock_pad[PINMUX_PADS];
+static vuint32_t g_mock_daisy;
+
+uint32_t
+test_pinmux()
+{
+  MOCK_BEGIN();
+
+  static pinmux_s mux;
+  uint32_t        pad;
+  for (pad = 0; pad < PINMUX_PADS; pad++) { g_mock_mux[pad] = 0x5; g_mock_pad[pad] = 0x10b0; }
+  g_mock_daisy = 0;
+  pinmux_init(&mux, g_mock_mux, g_mock_pad);
+
+  // Register numbering against the memory map, offsets from IOMUXC_32BASE03 (EMC_00)
+  MOCK_EXPECT(PINMUX_PAD_AD_B0(0) * 4 == 0x0a8);
+  MOCK_EXPECT(PINMUX_PAD_AD_B1(3) * 4 == 0x0f4);
+  MOCK_EXPECT(PINMUX_PAD_SD_B1(11) * 4 == 0x1ec && PINMUX_PAD_SD_B1(11) == PINMUX_PADS - 1);
+  MOCK_EXPECT((uintptr_t)PINMUX_PAD_BASE - (uintptr_t)PINMUX_MUX_BASE == 0x1f0);
+
+  static const pinmux_entry_s board[] = {
+    PINMUX_ENTRY(PINMUX_PAD_B0(3), 0x5, 0x38),
+    PINMUX_ENTRY_DAISY(PINMUX_PAD_AD_B1(3), 0x8, 0x1b000, &g_mock_daisy, 0x1),
+    PINMUX_ENTRY(PINMUX_PAD_EMC(0), 0x2 | PINMUX_SION, 0x0),
+  };
+  MOCK_EXPECT(pinmux_apply(&mux, board, PINMUX_COUNT(board)) == 0);
+  MOCK_EXPECT(g_mock_mux[PINMUX_PAD_B0(3)] == 0x5 && g_mock_pad[PINMUX_PAD_B0(3)] == 0x38);
+  MOCK_EXPECT(g_mock_mux[PINMUX_PAD_AD_B1(3)] == 0x8 && g_mock_pad[PINMUX_PAD_AD_B1(3)] == 0x1b000);
+  MOCK_EXPECT(g_mock_daisy == 0x1);
+  MOCK_EXPECT(g_mock_mux[PINMUX_PAD_EMC(0)] == 0x12);
+  MOCK_EXPECT(g_mock_pad[PINMUX_PAD_B0(4)] == 0x10b0); // Neighbours untouched
+  MOCK_EXPECT(pinmux_owned(&mux, PINMUX_PAD_B0(3)) && !pinmux_owned(&mux, PINMUX_PAD_B0(4)));
+
+  // A second claim of an owned pad, or a duplicate inside one table, is skipped and counted
+  static const pinmux_entry_s driver[] = {
+    PINMUX_ENTRY(PINMUX_PAD_B1(0), 0x1, 0x1),
+    PINMUX_ENTRY(PINMUX_PAD_B0(3), 0x1, 0x1),
+    PINMUX_ENTRY(PINMUX_PAD_B1(0), 0x3, 0x3),
+    PINMUX_ENTRY(PINMUX_PADS, 0x1, 0x1),
+  };
+  MOCK_EXPECT(pinmux_apply(&mux, driver, PINMUX_COUNT(driver)) == 3);
+  MOCK_EXPECT(mux.conflicts == 3);
+  MOCK_EXPECT(g_mock_mux[PINMUX_PAD_B0(3)] == 0x5 && g_mock_pad[PINMUX_PAD_B0(3)] == 0x38); // Live pin kept
+  MOCK_EXPECT(g_mock_mux[PINMUX_PAD_B1(0)] == 0x1 && g_mock_pad[PINMUX_PAD_B1(0)] == 0x1);  // First claim wins
+
+  // Released pads can be claimed again
+  pinmux_release(&mux, PINMUX_PAD_B0(3));
+  pinmux_release(&mux, PINMUX_PADS); // Ignored
+  MOCK_EXPECT(!pinmux_owned(&mux, PINMUX_PAD_B0(3)));
+  MOCK_EXPECT(pinmux_apply(&mux, &driver[1], 1) == 0);
+  MOCK_EXPECT(g_mock_mux[PINMUX_PAD_B0(3)] == 0x1 && mux.conflicts == 3);
+  MOCK_EXPECT(!pinmux_owned(&mux, PINMUX_PADS));
+
+  MOCK_END();
+}
@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_PINMUX_H
+#define MOCKTESTS_PINMUX_H
+
+#include <stdint.h>
+
+/** @brief Table writes and order, ownership conflicts, release on fake register banks, returns failure count */
+uint32_t test_pinmux();
+
+#endif // MOCKTESTS_PINMUX_H
@@ -0,0 +1,102 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_pit_demux.h"
+#include "mocktests_common.h"
+
+#include "devices/pit_demux.h"
+
+/** @brief Fake PIT channel registers, the demux gets them instead of 0x40084100 */
+static pit_channel_regs_s g_mock_pit[PIT_DEMUX_CHANNELS];
+
+typedef struct
+{
+  uint32_t channel;
+  uint32_t runs;
+  uint32_t order;
+  uint32_t flag_seen; // TFLG of its own channel while the handler ran
+} mock_pit_work_s;
+
+static uint32_t g_mock_pit_order;
+
+static void
+__mock_pit_handler__(void* ctx)
+{
+  mock_pit_work_s* work = (mock_pit_work_s*)ctx;
+  work->runs++;
+  work->order     = ++g_mock_pit_order;
+  work->flag_seen = g_mock_pit[work->channel].TFLG;
+}
+
+/** @brief Hardware side of an expiry, TIF is set whatever TIE says */
+static void
+__mock_pit_expire__(uint32_t channel)
+{
+  g_mock_pit[channel].TFLG = 0x1;
+}
+
+uint32_t
+test_pit_demux()
+{
+  MOCK_BEGIN();
+
+  static pit_demux_s     demux;
+  static mock_pit_work_s work[PIT_DEMUX_CHANNELS];
+  uint32_t               channel;
+
+  pit_demux_init(&demux);
+  for (channel = 0; channel < PIT_DEMUX_CHANNELS; channel++)
+  {
+    work[channel].channel     = channel;
+    g_mock_pit[channel].TCTRL = 0x3; // TIE | TEN
+    g_mock_pit[channel].TFLG  = 0;
+    pit_demux_attach(&demux, channel, &__mock_pit_handler__, &work[channel]);
+  }
+  MOCK_EXPECT(demux.attached == 0xf);
+
+  // One channel, only its handler runs
+  __mock_pit_expire__(2);
+  MOCK_EXPECT(pit_demux_service(&demux, g_mock_pit) == 0x4);
+  MOCK_EXPECT(work[2].runs == 1 && work[0].runs == 0 && work[1].runs == 0 && work[3].runs == 0);
+  MOCK_EXPECT(g_mock_pit[2].TFLG == 0x1); // Written 1 to clear, the fake register keeps the write
+
+  // Several channels in one entry, lowest first, each flag cleared before its handler runs
+  for (channel = 0; channel < PIT_DEMUX_CHANNELS; channel++) { g_mock_pit[channel].TFLG = 0; }
+  __mock_pit_expire__(3);
+  __mock_pit_expire__(0);
+  __mock_pit_expire__(1);
+  g_mock_pit_order = 0;
+  uint32_t pending = pit_demux_collect(g_mock_pit);
+  MOCK_EXPECT(pending == 0xb);
+  for (channel = 0; channel < PIT_DEMUX_CHANNELS; channel++) { g_mock_pit[channel].TFLG = 0; } // W1C has landed
+  MOCK_EXPECT(pit_demux_dispatch(&demux, pending) == 0xb);
+  MOCK_EXPECT(work[0].order == 1 && work[1].order == 2 && work[3].order == 3);
+  MOCK_EXPECT(work[0].flag_seen == 0 && work[1].flag_seen == 0 && work[3].flag_seen == 0);
+  MOCK_EXPECT(work[2].runs == 1);
+
+  // Without TIE a set flag is neither dispatched nor cleared (chained monotonic clock)
+  g_mock_pit[3].TCTRL = 0x5; // CHN | TEN
+  g_mock_pit[3].TFLG  = 0x1;
+  MOCK_EXPECT(pit_demux_collect(g_mock_pit) == 0);
+  g_mock_pit[3].TCTRL = 0x3;
+  g_mock_pit[3].TFLG  = 0;
+
+  // Only an NVIC request, nothing flagged
+  MOCK_EXPECT(pit_demux_service(&demux, g_mock_pit) == 0 && demux.spurious == 1);
+
+  // A detached channel is cleared but not run, re-attach swaps the context
+  pit_demux_detach(&demux, 1);
+  __mock_pit_expire__(1);
+  MOCK_EXPECT(pit_demux_service(&demux, g_mock_pit) == 0 && work[1].runs == 1);
+  pit_demux_attach(&demux, 1, &__mock_pit_handler__, &work[0]);
+  g_mock_pit[1].TFLG = 0;
+  MOCK_EXPECT(pit_demux_dispatch(&demux, 0x2) == 0x2 && work[0].runs == 2 && work[1].runs == 1);
+
+  // Out of range channels are ignored
+  pit_demux_attach(&demux, PIT_DEMUX_CHANNELS, &__mock_pit_handler__, NULL);
+  MOCK_EXPECT(demux.attached == 0xf);
+
+  MOCK_END();
+}
@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_PIT_DEMUX_H
+#define MOCKTESTS_PIT_DEMUX_H
+
+#include <stdint.h>
+
+/** @brief Flag scan on a fake register block, per-channel context, clear before dispatch, returns failure count */
+uint32_t test_pit_demux();
+
+#endif // MOCKTESTS_PIT_DEMUX_H
@@ -0,0 +1,77 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_profiler.h"
+#include "mocktests_common.h"
+
+#include "sys/profiler.h"
+
+typedef struct
+{
+  uint32_t probes;
+  uint32_t samples;
+  uint32_t mean_of_fixed;
+} prof_export_tally_s;
+
+static void
+__tally_probe__(const prof_probe_s* snapshot, uint32_t mean, void* ctx)
+{
+  prof_export_tally_s* tally = (prof_export_tally_s*)ctx;
+  tally->probes++;
+  tally->samples += snapshot->count;
+  if (snapshot->name[0] == 'f') { tally->mean_of_fixed = mean; }
+}
+
+static uint32_t
+__busy_scope__(uint32_t rounds)
+{
+  PROF_SCOPE("busy_scope");
+  volatile uint32_t sink = 0;
+  uint32_t          idx;
+  for (idx = 0; idx < rounds; idx++) { sink += idx; }
+  return sink;
+}
+
+uint32_t
+test_profiler()
+{
+  MOCK_BEGIN();
+
+  prof_init();
+  uint32_t registered = prof_probe_count();
+
+  // Fixed samples, statistics and log2 buckets
+  prof_probe_s* fixed = prof_probe("fixed");
+  MOCK_EXPECT(fixed != NULL && prof_probe("fixed") == fixed);
+  MOCK_EXPECT(prof_probe_count() == registered + 1);
+
+  prof_record(fixed, 0);
+  prof_record(fixed, 1);
+  prof_record(fixed, 100);  // [64, 128)
+  prof_record(fixed, 127);  // [64, 128)
+  prof_record(fixed, 4096); // [4096, 8192)
+  MOCK_EXPECT(fixed->count == 5 && fixed->min == 0 && fixed->max == 4096);
+  MOCK_EXPECT(prof_mean(fixed) == (0 + 1 + 100 + 127 + 4096) / 5);
+  MOCK_EXPECT(fixed->hist[0] == 2 && fixed->hist[6] == 2 && fixed->hist[12] == 1);
+
+  // Scoped probe, the site resolves its entry once and records on every exit
+  uint32_t run;
+  for (run = 0; run < 10; run++) { __busy_scope__(1000); }
+  prof_probe_s* busy = prof_probe("busy_scope");
+  MOCK_EXPECT(busy->count == 10 && busy->max >= busy->min && busy->total > 0);
+  MOCK_EXPECT(prof_probe_count() == registered + 2);
+
+  // Export sees every probe with samples, reset keeps names but drops samples
+  prof_export_tally_s tally = {0, 0, 0};
+  prof_export(&__tally_probe__, &tally);
+  MOCK_EXPECT(tally.probes == 2 && tally.samples == 15 && tally.mean_of_fixed == 864);
+
+  prof_reset();
+  tally.probes = 0;
+  prof_export(&__tally_probe__, &tally);
+  MOCK_EXPECT(tally.probes == 0 && prof_probe("fixed") == fixed && fixed->min == 0xffffffff);
+
+  MOCK_END();
+}
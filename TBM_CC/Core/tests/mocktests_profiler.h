@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_PROFILER_H
+#define MOCKTESTS_PROFILER_H
+
+#include <stdint.h>
+
+/** @brief Probe registration, statistics, histogram and export, returns failure count */
+uint32_t test_profiler();
+
+#endif // MOCKTESTS_PROFILER_H
@@ -0,0 +1,128 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_scheduler.h"
+#include "mocktests_common.h"
+
+#include "sys/scheduler.h"
+#include "devices/soft_timer.h"
+
+#define MOCK_SCHED_TASKS 6
+
+typedef struct
+{
+  sched_task_s  task;
+  uint32_t      order;   // Run sequence number of the last run
+  uint32_t      reposts; // Times left to post itself from its own run
+  sched_task_s* poke;    // Posted from the run, stands in for an ISR
+} mock_sched_task_s;
+
+static uint32_t g_sched_order;
+
+static void
+__mock_sched_run__(void* ctx)
+{
+  mock_sched_task_s* mock = (mock_sched_task_s*)ctx;
+  mock->order = ++g_sched_order;
+  if (mock->reposts != 0)
+  {
+    mock->reposts--;
+    sched_post(&mock->task);
+  }
+  if (mock->poke != NULL) { sched_post(mock->poke); }
+}
+
+static uint32_t
+__mock_sched_drain__()
+{
+  uint32_t ran = 0;
+  while (sched_run_once()) { ran++; }
+  return ran;
+}
+
+uint32_t
+test_scheduler()
+{
+  MOCK_BEGIN();
+
+  static mock_sched_task_s mock[MOCK_SCHED_TASKS];
+  uint32_t                 i;
+
+  sched_init();
+  for (i = 0; i < MOCK_SCHED_TASKS; i++)
+  {
+    sched_task_init(&mock[i].task, &__mock_sched_run__, &mock[i], (uint8_t)(i >> 0x1)); // Two tasks per priority 0..2
+    mock[i].reposts = 0;
+    mock[i].poke    = NULL;
+  }
+  MOCK_EXPECT(sched_run_once() == 0);
+
+  // Highest priority first, FIFO within a priority
+  g_sched_order = 0;
+  sched_post(&mock[5].task);
+  sched_post(&mock[4].task);
+  sched_post(&mock[1].task);
+  sched_post(&mock[0].task);
+  sched_post(&mock[2].task);
+  MOCK_EXPECT(__mock_sched_drain__() == 5);
+  MOCK_EXPECT(mock[1].order == 1 && mock[0].order == 2 && mock[2].order == 3);
+  MOCK_EXPECT(mock[5].order == 4 && mock[4].order == 5);
+
+  // Posting a queued task again is coalesced into one run
+  sched_post(&mock[3].task);
+  sched_post(&mock[3].task);
+  MOCK_EXPECT(sched_task_queued(&mock[3].task));
+  MOCK_EXPECT(__mock_sched_drain__() == 1 && mock[3].task.runs == 1);
+  MOCK_EXPECT(!sched_task_queued(&mock[3].task));
+
+  // A task may post itself, a post from a running task lands in the next batch
+  uint32_t batches = sched_stats()->batches;
+  mock[4].reposts  = 2;
+  mock[4].poke     = &mock[0].task; // Higher priority, runs right after
+  g_sched_order    = 0;
+  sched_post(&mock[4].task);
+  MOCK_EXPECT(sched_run_once() == 1 && mock[4].order == 1);
+  MOCK_EXPECT(sched_run_once() == 1 && mock[0].order == 2);
+  mock[4].poke = NULL;
+  MOCK_EXPECT(__mock_sched_drain__() == 2 && mock[4].task.runs == 4);
+  MOCK_EXPECT(sched_stats()->batches - batches == 3);
+
+  // Cancel takes a task off the queue
+  sched_post(&mock[2].task);
+  sched_post(&mock[3].task);
+  sched_cancel(&mock[2].task);
+  MOCK_EXPECT(__mock_sched_drain__() == 1 && mock[3].task.runs == 2 && mock[2].task.runs == 1);
+  sched_run_once(); // Moves the (empty) posted queues, masks must be clear
+  sched_post(&mock[2].task);
+  MOCK_EXPECT(__mock_sched_drain__() == 1 && mock[2].task.runs == 2);
+
+  // Delayed and periodic posts on the wheel, 1ms wheel tick on a 200MHz PIT
+  timer_datum_s tick     = {.freq = PIT_SPEED_200MHz, .type = MILLIS_E, .val = 200000};
+  timer_datum_s three_ms = {.freq = PIT_SPEED_200MHz, .type = MILLIS_E, .val = 600000};
+  timer_datum_s two_ms   = {.freq = PIT_SPEED_200MHz, .type = MILLIS_E, .val = 400000};
+  soft_timer_wheel_init(&tick);
+
+  sched_post_delayed(&mock[0].task, three_ms);
+  sched_post_periodic(&mock[1].task, two_ms);
+  uint32_t runs0 = mock[0].task.runs;
+  uint32_t runs1 = mock[1].task.runs;
+  for (i = 0; i < 10; i++)
+  {
+    soft_timer_tick();
+    __mock_sched_drain__();
+  }
+  MOCK_EXPECT(mock[0].task.runs - runs0 == 1);
+  MOCK_EXPECT(mock[1].task.runs - runs1 == 5);
+
+  // Several expiries before the loop gets to run are one run
+  for (i = 0; i < 6; i++) { soft_timer_tick(); }
+  MOCK_EXPECT(__mock_sched_drain__() == 1);
+
+  sched_cancel(&mock[1].task);
+  for (i = 0; i < 6; i++) { soft_timer_tick(); }
+  MOCK_EXPECT(__mock_sched_drain__() == 0);
+
+  MOCK_END();
+}
@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_SCHEDULER_H
+#define MOCKTESTS_SCHEDULER_H
+
+#include <stdint.h>
+
+/** @brief Priority order, FIFO per priority, coalesced posts, batches and wheel driven posts, returns failure count */
+uint32_t test_scheduler();
+
+#endif // MOCKTESTS_SCHEDULER_H
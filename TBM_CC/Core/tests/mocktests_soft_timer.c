@@ -0,0 +1,124 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_soft_timer.h"
+#include "mocktests_common.h"
+
+#include "devices/soft_timer.h"
+
+#define MOCK_SOFT_TIMERS 2048
+
+typedef struct
+{
+  soft_timer_s timer;
+  uint32_t     due;     // Expected wheel tick of the (first) expiry
+  uint32_t     fired;   // Wheel tick of the last expiry
+  uint32_t     count;
+} mock_soft_timer_s;
+
+static mock_soft_timer_s g_mock_timers[MOCK_SOFT_TIMERS];
+
+static void
+mock_soft_timer_cb(void* ctx)
+{
+  mock_soft_timer_s* mock = (mock_soft_timer_s*)ctx;
+  mock->fired = soft_timer_now();
+  mock->count++;
+}
+
+static void
+mock_soft_timer_stop_self_cb(void* ctx)
+{
+  mock_soft_timer_s* mock = (mock_soft_timer_s*)ctx;
+  mock_soft_timer_cb(ctx);
+  if (mock->count == 3) { soft_timer_stop(&mock->timer); }
+}
+
+uint32_t
+test_soft_timer_wheel()
+{
+  MOCK_BEGIN();
+
+  // 1ms wheel tick on a 200MHz PIT, i.e. 200000 PIT ticks
+  timer_datum_s tick = {.freq = PIT_SPEED_200MHz, .type = MILLIS_E, .val = 200000};
+  soft_timer_wheel_init(&tick);
+
+  // Datum conversion rounds up, never early
+  timer_datum_s one_and_half_ms = {.freq = PIT_SPEED_50MHz, .type = MICROS_E, .val = 75000};
+  MOCK_EXPECT(soft_timer_datum_to_ticks(&one_and_half_ms) == 2);
+  timer_datum_s five_ms = {.freq = PIT_SPEED_200MHz, .type = MILLIS_E, .val = 1000000};
+  MOCK_EXPECT(soft_timer_datum_to_ticks(&five_ms) == 5);
+
+  mock_soft_timer_s* single = &g_mock_timers[0];
+  soft_timer_start(&single->timer, five_ms, &mock_soft_timer_cb, single);
+  MOCK_EXPECT(soft_timer_pending(&single->timer));
+  for (uint32_t t = 0; t < 4; t++) { soft_timer_tick(); }
+  MOCK_EXPECT(single->count == 0);
+  soft_timer_tick();
+  MOCK_EXPECT(single->count == 1 && single->fired == 5);
+  MOCK_EXPECT(!soft_timer_pending(&single->timer));
+
+  // Spread deltas over every level (and past the wheel), stop every 4th timer
+  soft_timer_wheel_init(&tick);
+  uint32_t seed = 0x1234567;
+  uint32_t last = 0;
+  for (uint32_t idx = 0; idx < MOCK_SOFT_TIMERS; idx++)
+  {
+    mock_soft_timer_s* mock = &g_mock_timers[idx];
+    seed = seed * 1664525UL + 1013904223UL;
+    uint32_t delta = 1 + (seed >> (8 + (idx & 0x7) * 2)); // 1 .. ~2^24
+    if (idx == 6) { delta = SOFT_TIMER_MAX_DELTA + 1000; }
+
+    soft_timer_init(&mock->timer);
+    mock->count = 0;
+    mock->due   = delta;
+    soft_timer_start_ticks(&mock->timer, delta, 0, &mock_soft_timer_cb, mock);
+    if ((idx & 0x3) == 0x3) { soft_timer_stop(&mock->timer); }
+    else if (delta > last) { last = delta; }
+  }
+
+  for (uint32_t t = 0; t < last; t++) { soft_timer_tick(); }
+
+  uint32_t misfires = 0;
+  for (uint32_t idx = 0; idx < MOCK_SOFT_TIMERS; idx++)
+  {
+    mock_soft_timer_s* mock = &g_mock_timers[idx];
+    if ((idx & 0x3) == 0x3) { misfires += (mock->count != 0); }
+    else { misfires += (mock->count != 1 || mock->fired != mock->due); }
+  }
+  MOCK_EXPECT(misfires == 0);
+
+  // Periodic, one timer stops itself from its own callback
+  soft_timer_wheel_init(&tick);
+  mock_soft_timer_s* periodic = &g_mock_timers[0];
+  mock_soft_timer_s* stopper  = &g_mock_timers[1];
+  periodic->count = stopper->count = 0;
+  soft_timer_start_ticks(&periodic->timer, 7, 7, &mock_soft_timer_cb, periodic);
+  soft_timer_start_ticks(&stopper->timer, 100, 100, &mock_soft_timer_stop_self_cb, stopper);
+  for (uint32_t t = 0; t < 7000; t++) { soft_timer_tick(); }
+  MOCK_EXPECT(periodic->count == 1000 && periodic->fired == 7000);
+  MOCK_EXPECT(stopper->count == 3 && stopper->fired == 300);
+  MOCK_EXPECT(!soft_timer_pending(&stopper->timer));
+
+  soft_timer_stop(&periodic->timer);
+  MOCK_EXPECT(!soft_timer_pending(&periodic->timer));
+
+  // 2^31 ticks and more (~24.8 days at 1ms) are far future, not late: parked in the last level
+  soft_timer_wheel_init(&tick);
+  mock_soft_timer_s* far  = &g_mock_timers[0];
+  mock_soft_timer_s* max  = &g_mock_timers[1];
+  far->count = max->count = 0;
+  soft_timer_start_ticks(&far->timer, 0x80000000UL, 0, &mock_soft_timer_cb, far);
+  soft_timer_start_ticks(&max->timer, 0xffffffffUL, 0, &mock_soft_timer_cb, max);
+  MOCK_EXPECT(far->timer.level == SOFT_TIMER_LEVELS - 1 && max->timer.level == SOFT_TIMER_LEVELS - 1);
+  for (uint32_t t = 0; t < 2 * SOFT_TIMER_MAX_DELTA; t++) { soft_timer_tick(); } // Two re-cascades
+  MOCK_EXPECT(far->count == 0 && max->count == 0);
+  MOCK_EXPECT(soft_timer_pending(&far->timer) && soft_timer_pending(&max->timer));
+  MOCK_EXPECT(far->timer.level == SOFT_TIMER_LEVELS - 1 && far->timer.expires == 0x80000000UL);
+  soft_timer_stop(&far->timer);
+  soft_timer_stop(&max->timer);
+
+  MOCK_END();
+}
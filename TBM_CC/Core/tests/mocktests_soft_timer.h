@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_SOFT_TIMER_H
+#define MOCKTESTS_SOFT_TIMER_H
+
+#include <stdint.h>
+
+/** @brief Expiry accuracy across every wheel level, stop and periodic re-arm, returns failure count */
+uint32_t test_soft_timer_wheel();
+
+#endif // MOCKTESTS_SOFT_TIMER_H
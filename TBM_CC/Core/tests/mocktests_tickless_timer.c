@@ -0,0 +1,126 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_tickless_timer.h"
+#include "mocktests_common.h"
+
+#include "devices/tickless_timer.h"
+
+/** @brief Simulated PIT channel, counts up from the last arm()/expiry */
+static uint32_t g_sim_armed;
+static uint32_t g_sim_elapsed;
+static uint32_t g_sim_skew;  // Ticks the CPU spends between reading the count and restarting it
+static uint64_t g_sim_total; // Ticks since the skew test started, what tickless_now() has to match
+
+static uint32_t
+sim_arm(uint32_t ticks)
+{
+  uint32_t elapsed = g_sim_elapsed + g_sim_skew;
+  g_sim_total     += g_sim_skew;
+  g_sim_armed      = ticks;
+  g_sim_elapsed    = 0;
+  return elapsed;
+}
+
+static uint32_t
+sim_elapsed(void)
+{
+  return g_sim_elapsed;
+}
+
+static const tickless_hw_s g_sim_hw = {.arm = &sim_arm, .elapsed = &sim_elapsed};
+
+/** @brief Let 'ticks' PIT ticks pass, running the ISR at every expiry */
+static void
+sim_advance(uint32_t ticks)
+{
+  g_sim_total += ticks;
+  while (ticks >= g_sim_armed - g_sim_elapsed)
+  {
+    ticks -= g_sim_armed - g_sim_elapsed;
+    g_sim_elapsed = 0; // Reload
+    tickless_expire();
+  }
+  g_sim_elapsed += ticks;
+}
+
+typedef struct
+{
+  tickless_timer_s timer;
+  uint64_t         fired;
+  uint32_t         count;
+} mock_tickless_s;
+
+static void
+mock_tickless_cb(void* ctx)
+{
+  mock_tickless_s* mock = (mock_tickless_s*)ctx;
+  mock->fired = tickless_now();
+  mock->count++;
+}
+
+uint32_t
+test_tickless_timer()
+{
+  MOCK_BEGIN();
+
+  static mock_tickless_s a, b, c, periodic;
+
+  // Datums from another PIT speed are rescaled
+  timer_datum_s at_100MHz = {.freq = PIT_SPEED_100MHz, .type = MICROS_E, .val = 1000};
+  timer_datum_s at_150MHz = {.freq = PIT_SPEED_150MHz, .type = MICROS_E, .val = 3001};
+  MOCK_EXPECT(tickless_datum_to_ticks(&at_100MHz, PIT_SPEED_200MHz) == 2000);
+  MOCK_EXPECT(tickless_datum_to_ticks(&at_150MHz, PIT_SPEED_50MHz) == 1000);
+
+  tickless_init(&g_sim_hw, PIT_SPEED_200MHz);
+  MOCK_EXPECT(g_sim_armed == TICKLESS_MAX_ARM); // Idle, only keeps time
+
+  timer_datum_s one_thousand = {.freq = PIT_SPEED_200MHz, .type = MICROS_E, .val = 1000};
+  MOCK_EXPECT(tickless_start(&a.timer, one_thousand, &mock_tickless_cb, &a));
+  MOCK_EXPECT(tickless_start_ticks(&b.timer, 5000, 0, &mock_tickless_cb, &b));
+  MOCK_EXPECT(tickless_start_ticks(&c.timer, 5000, 0, &mock_tickless_cb, &c));
+  MOCK_EXPECT(tickless_start_ticks(&periodic.timer, 3000, 3000, &mock_tickless_cb, &periodic));
+  MOCK_EXPECT(g_sim_armed == 1000);
+
+  sim_advance(20000);
+  MOCK_EXPECT(a.count == 1 && a.fired == 1000);
+  MOCK_EXPECT(b.count == 1 && b.fired == 5000);
+  MOCK_EXPECT(c.count == 1 && c.fired == 5000);
+  MOCK_EXPECT(periodic.count == 6 && periodic.fired == 18000);
+
+  // One wakeup per distinct deadline: 1000, 3000, 5000, 6000, 9000, 12000, 15000, 18000
+  MOCK_EXPECT(tickless_wakeups() == 8);
+  MOCK_EXPECT(tickless_now() == 20000);
+  tickless_stop(&periodic.timer);
+
+  // An earlier deadline reprograms a channel already armed for a later one
+  tickless_start_ticks(&a.timer, 10000, 0, &mock_tickless_cb, &a);
+  sim_advance(2000);
+  tickless_start_ticks(&b.timer, 500, 0, &mock_tickless_cb, &b);
+  MOCK_EXPECT(g_sim_armed == 500);
+  sim_advance(600);
+  MOCK_EXPECT(b.count == 2 && b.fired == 22500);
+
+  // Stopping the earliest deadline leaves one empty wakeup, then the next one is exact
+  tickless_start_ticks(&c.timer, 100, 0, &mock_tickless_cb, &c);
+  tickless_stop(&c.timer);
+  sim_advance(10000);
+  MOCK_EXPECT(c.count == 1);
+  MOCK_EXPECT(a.count == 2 && a.fired == 30000);
+
+  // Ticks passing while the channel is reprogrammed stay in the time base
+  g_sim_total = tickless_now();
+  g_sim_skew  = 3;
+  tickless_start_ticks(&b.timer, 1000, 0, &mock_tickless_cb, &b);
+  tickless_start_ticks(&c.timer, 500, 0, &mock_tickless_cb, &c);
+  tickless_start_ticks(&a.timer, 200, 0, &mock_tickless_cb, &a);
+  MOCK_EXPECT(tickless_now() == g_sim_total);
+  sim_advance(5000);
+  MOCK_EXPECT(a.count == 3 && b.count == 3 && c.count == 2);
+  MOCK_EXPECT(tickless_now() == g_sim_total);
+  g_sim_skew = 0;
+
+  MOCK_END();
+}
@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_TICKLESS_TIMER_H
+#define MOCKTESTS_TICKLESS_TIMER_H
+
+#include <stdint.h>
+
+/** @brief Exact expiry and wakeup count of the tickless scheduler on a simulated channel, returns failure count */
+uint32_t test_tickless_timer();
+
+#endif // MOCKTESTS_TICKLESS_TIMER_H
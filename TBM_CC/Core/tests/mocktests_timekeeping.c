@@ -0,0 +1,126 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_timekeeping.h"
+#include "mocktests_common.h"
+
+#include "devices/monotonic_clock.h"
+#include "utils/utimer_mgr.h"
+
+uint32_t
+test_clock_conversion()
+{
+  MOCK_BEGIN();
+
+  // Integral tick lengths are exact over the whole 64-bit range
+  MOCK_EXPECT(clock_ticks_to_ns_at(1, PIT_SPEED_50MHz) == 20);
+  MOCK_EXPECT(clock_ticks_to_ns_at(100000000ULL, PIT_SPEED_100MHz) == 1000000000ULL);
+  MOCK_EXPECT(clock_ticks_to_ns_at(0x123456789abULL, PIT_SPEED_200MHz) == 0x123456789abULL * 5);
+
+  // 150MHz, 6.666..ns per tick
+  MOCK_EXPECT(clock_ticks_to_ns_at(3, PIT_SPEED_150MHz) == 20);
+  MOCK_EXPECT(clock_ticks_to_ns_at(150000000ULL, PIT_SPEED_150MHz) == 1000000000ULL);
+
+  // Drift stays below 1ns per 2^32 ticks, 3 * 2^40 ticks is ~6.1 hours (exactly 20 * 2^40 ns)
+  uint64_t ticks    = 3ULL << 0x28;
+  uint64_t expected = 20ULL << 0x28;
+  uint64_t actual   = clock_ticks_to_ns_at(ticks, PIT_SPEED_150MHz);
+  uint64_t error    = (actual > expected) ? actual - expected : expected - actual;
+  MOCK_EXPECT(error <= (ticks >> 0x20) + 1);
+
+  MOCK_END();
+}
+
+uint32_t
+test_time_ticks()
+{
+  MOCK_BEGIN();
+
+  // Literal arguments fold into immediates, the bit-field check forces that
+  enum { ticks_100ms = TICKS_MS(100, PIT_SPEED_200MHz) };
+  MOCK_EXPECT(ticks_100ms == 20000000);
+  MOCK_EXPECT(TICKS_S(1, PIT_SPEED_150MHz) == 150000000);
+  MOCK_EXPECT(TICKS_US(7, PIT_SPEED_50MHz) == 350);
+  MOCK_EXPECT(TICKS_NS(100, PIT_SPEED_150MHz) == 15);
+
+  timer_datum_s datum = TIMER_DATUM_MS(100, PIT_SPEED_200MHz);
+  MOCK_EXPECT(datum.freq == PIT_SPEED_200MHz && datum.type == MILLIS_E && datum.val == 20000000);
+
+  // Runtime table agrees with the macros
+  MOCK_EXPECT(time_to_ticks(PIT_SPEED_200MHz, MILLIS_E, 100) == TICKS_MS(100, PIT_SPEED_200MHz));
+  MOCK_EXPECT(time_to_ticks(PIT_SPEED_150MHz, SECONDS_E, 1) == TICKS_S(1, PIT_SPEED_150MHz));
+  MOCK_EXPECT(time_to_ticks(PIT_SPEED_50MHz, MICROS_E, 7) == TICKS_US(7, PIT_SPEED_50MHz));
+  MOCK_EXPECT(time_to_ticks(PIT_SPEED_200MHz, ZETTOS_E, 3) == 60);
+  MOCK_EXPECT(time_to_ticks(PIT_SPEED_100MHz, YOTTOS_E, 3) == 3);
+
+  // More than one tick per unit at the fractional scales, clamped instead of wrapping
+  MOCK_EXPECT(time_to_ticks(PIT_SPEED_200MHz, ZETTOS_E, 0x10000000) == 214748364UL * 20);
+  MOCK_EXPECT(time_to_ticks(PIT_SPEED_50MHz, ZETTOS_E, 0xffffffff) == 858993459UL * 5);
+  MOCK_EXPECT(time_to_ticks(PIT_SPEED_150MHz, YOTTOS_E, 0xffffffff) == 0xffffffff);
+  MOCK_EXPECT(time_to_ticks(PIT_SPEED_200MHz, YOTTOS_E, 0x80000000) == 0xfffffffe);
+  MOCK_EXPECT(time_to_ticks(PIT_SPEED_200MHz, ZETTOS_E, 214748364) == 214748364UL * 20); // Largest exact value
+
+  // Sub micro-second units are at most one tick short, never long
+  uint32_t ns;
+  uint32_t failures_ns = 0;
+  for (ns = 0; ns < 5000; ns += 7)
+  {
+    uint32_t ticks = time_to_ticks(PIT_SPEED_150MHz, NANOS_E, ns);
+    uint32_t exact = (ns * 150) / 1000;
+    failures_ns   += (ticks != exact && ticks + 1 != exact);
+  }
+  MOCK_EXPECT(failures_ns == 0);
+
+  // Out of range values clamp to the largest load value instead of wrapping
+  MOCK_EXPECT(time_to_ticks(PIT_SPEED_200MHz, SECONDS_E, 100) == 21 * 200000000UL);
+  MOCK_EXPECT(time_to_ticks(PIT_SPEED_50MHz, DAYS_E, 1) == 0);
+  MOCK_EXPECT(0xffffffffUL / 5 - time_to_ticks(PIT_SPEED_200MHz, NANOS_E, 0xffffffff) <= 1);
+
+  // Way back
+  MOCK_EXPECT(ticks_to_time(PIT_SPEED_200MHz, MILLIS_E, 20000000) == 100);
+  MOCK_EXPECT(ticks_to_time(PIT_SPEED_150MHz, NANOS_E, 15) == 100);
+  MOCK_EXPECT(ticks_to_time(PIT_SPEED_50MHz, HOURS_E, 0xffffffff) == 0);
+  MOCK_EXPECT(ticks_to_time(PIT_SPEED_100MHz, NANOS_E, 0xffffffff) == 0xffffffff);
+
+  MOCK_END();
+}
+
+uint32_t
+test_time_ns64()
+{
+  MOCK_BEGIN();
+
+  // Every unit is an exact multiple of a nano-second
+  MOCK_EXPECT(time_to_ns64(DAYS_E, 1) == 86400ULL * TIME_NS64_PER_S);
+  MOCK_EXPECT(time_to_ns64(MILLIS_E, 100) == 100000000ULL);
+  MOCK_EXPECT(time_to_ns64(ZETTOS_E, 3) == 300);
+  MOCK_EXPECT(time_to_ns64(SECONDS_E, 0xffffffff) == 0xffffffffULL * TIME_NS64_PER_S);
+  MOCK_EXPECT(time_to_ns64(DAYS_E, 213503) == 213503ULL * 86400ULL * TIME_NS64_PER_S);
+  MOCK_EXPECT(time_to_ns64(DAYS_E, 213504) == 0xffffffffffffffffULL);
+
+  // Way back rounds down and round trips exactly
+  MOCK_EXPECT(time_from_ns64(HOURS_E, time_to_ns64(HOURS_E, 1234)) == 1234);
+  MOCK_EXPECT(time_from_ns64(MINUTES_E, time_to_ns64(SECONDS_E, 119)) == 1);
+  MOCK_EXPECT(time_from_ns64(YOTTOS_E, 99) == 9);
+  MOCK_EXPECT(time_from_ns64(NANOS_E, 0x100000000ULL) == 0xffffffff);
+
+  // Q32.32 seconds
+  MOCK_EXPECT(time_ns64_to_q32(TIME_NS64_PER_S) == TIME_Q32_ONE);
+  MOCK_EXPECT(time_ns64_to_q32(time_to_ns64(MILLIS_E, 500)) == TIME_Q32_ONE / 2);
+  MOCK_EXPECT(time_ns64_to_q32(time_to_ns64(DAYS_E, 7)) == (7ULL * 86400ULL) << 0x20);
+  MOCK_EXPECT(time_q32_to_ns64(3 * TIME_Q32_ONE + TIME_Q32_ONE / 4) == 3250000000ULL);
+
+  // ns -> Q32.32 -> ns loses less than one nano-second
+  time_ns64_t ns = 123456789012345ULL;
+  MOCK_EXPECT(ns - time_q32_to_ns64(time_ns64_to_q32(ns)) <= 1);
+
+  // Summing 1s steps for a day stays exact, a float accumulator drifts here
+  time_ns64_t total = 0;
+  uint32_t    step;
+  for (step = 0; step < 86400000; step += 1000) { total += time_to_ns64(MILLIS_E, 1000); }
+  MOCK_EXPECT(time_from_ns64(DAYS_E, total) == 1);
+
+  MOCK_END();
+}
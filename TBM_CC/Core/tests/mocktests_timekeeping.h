@@ -0,0 +1,20 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_TIMEKEEPING_H
+#define MOCKTESTS_TIMEKEEPING_H
+
+#include <stdint.h>
+
+/** @brief Tick to nano-second conversion of the monotonic clock at every PIT speed, returns failure count */
+uint32_t test_clock_conversion();
+
+/** @brief TICKS_* macros against the runtime time_to_ticks() table, clamping and the way back */
+uint32_t test_time_ticks();
+
+/** @brief time_ns64_t and Q32.32 conversions for every timetype_e unit */
+uint32_t test_time_ns64();
+
+#endif // MOCKTESTS_TIMEKEEPING_H
@@ -0,0 +1,107 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#include "mocktests_timer_driver.h"
+#include "mocktests_common.h"
+
+#include "devices/timer_driver.h"
+#include "utils/utimer_mgr.h"
+
+#include <stddef.h>
+
+/** @brief Mock backend, records what the generic layer asked for */
+static uint32_t g_mock_configured;
+static uint32_t g_mock_armed_ticks;
+static uint32_t g_mock_cancels;
+
+static void     mock_configure(timer_channel_s* ch)             { g_mock_configured++; }
+static void     mock_arm(timer_channel_s* ch, uint32_t ticks)   { g_mock_armed_ticks = ticks; }
+static void     mock_cancel(timer_channel_s* ch)                { g_mock_cancels++; }
+static uint32_t mock_read(timer_channel_s* ch)                  { return 0; }
+
+static const timer_driver_ops_s g_mock_ops = {
+  .configure = &mock_configure,
+  .arm       = &mock_arm,
+  .cancel    = &mock_cancel,
+  .read      = &mock_read,
+  .capture   = NULL,
+};
+
+static void
+mock_expired_cb(void* ctx)
+{
+  (*(uint32_t*)ctx)++;
+}
+
+uint32_t
+test_timer_driver()
+{
+  MOCK_BEGIN();
+
+  // Same shapes as the real backends: PIT 200MHz/32-bit, GPT 24MHz/32-bit, QuadTimer 150MHz/16-bit, RTWDOG
+  static timer_channel_s pit, gpt, qtimer_fast, qtimer_slow, wdog;
+  timer_channel_setup(&pit, &g_mock_ops, PIT_E, 0, 0, TIMER_CAP_ONESHOT | TIMER_CAP_READ, 200000000UL, 0xffffffff);
+  timer_channel_setup(&gpt, &g_mock_ops, GPT_E, 0, 0, TIMER_CAP_ONESHOT | TIMER_CAP_READ | TIMER_CAP_CAPTURE, 24000000UL, 0xffffffff);
+  timer_channel_setup(&qtimer_fast, &g_mock_ops, QUAD_E, 0, 0, TIMER_CAP_ONESHOT | TIMER_CAP_CAPTURE, 150000000UL, 0xffff);
+  timer_channel_setup(&qtimer_slow, &g_mock_ops, QUAD_E, 0, 1, TIMER_CAP_ONESHOT | TIMER_CAP_CAPTURE, 150000000UL >> 7, 0xffff);
+  timer_channel_setup(&wdog, &g_mock_ops, RTWDOG_E, 0, 0, TIMER_CAP_ONESHOT | TIMER_CAP_RESETS, 32768UL, 0xffff);
+
+  // Conversions, rounded down, clamped and never 0
+  MOCK_EXPECT(timer_channel_ns_to_ticks(&pit, time_to_ns64(MILLIS_E, 100)) == 20000000);
+  MOCK_EXPECT(timer_channel_ns_to_ticks(&gpt, time_to_ns64(SECONDS_E, 1)) >= 23999999);
+  MOCK_EXPECT(timer_channel_ns_to_ticks(&gpt, time_to_ns64(SECONDS_E, 1)) <= 24000000);
+  MOCK_EXPECT(timer_channel_ns_to_ticks(&qtimer_fast, time_to_ns64(SECONDS_E, 1)) == 0xffff);
+  MOCK_EXPECT(timer_channel_ns_to_ticks(&pit, 1) == 1);
+  MOCK_EXPECT(timer_channel_reaches(&pit, time_to_ns64(SECONDS_E, 21)));
+  MOCK_EXPECT(!timer_channel_reaches(&pit, time_to_ns64(SECONDS_E, 22)));
+  MOCK_EXPECT(timer_channel_reaches(&qtimer_fast, time_to_ns64(MICROS_E, 400)));
+  MOCK_EXPECT(!timer_channel_reaches(&qtimer_fast, time_to_ns64(MICROS_E, 500)));
+
+  timer_pool_reset();
+  g_mock_configured = 0;
+  MOCK_EXPECT(timer_pool_add(&pit));
+  MOCK_EXPECT(timer_pool_add(&gpt));
+  MOCK_EXPECT(timer_pool_add(&qtimer_fast));
+  MOCK_EXPECT(timer_pool_add(&qtimer_slow));
+  MOCK_EXPECT(timer_pool_add(&wdog));
+  MOCK_EXPECT(g_mock_configured == 5);
+
+  // 10us: PIT has the finest resolution and reaches it
+  timer_channel_s* a = timer_pool_alloc(time_to_ns64(MICROS_E, 10), TIMER_CAP_ONESHOT);
+  MOCK_EXPECT(a == &pit);
+
+  // Next finest for 10us is the fast QuadTimer (150MHz)
+  timer_channel_s* b = timer_pool_alloc(time_to_ns64(MICROS_E, 10), TIMER_CAP_ONESHOT);
+  MOCK_EXPECT(b == &qtimer_fast);
+
+  // 30ms is out of the fast QuadTimer's reach, the GPT (24MHz) beats the slow QuadTimer (1.17MHz)
+  timer_channel_s* c = timer_pool_alloc(time_to_ns64(MILLIS_E, 30), TIMER_CAP_ONESHOT);
+  MOCK_EXPECT(c == &gpt);
+
+  // Nothing left reaches an hour, the longest range free channel is the fallback, never the watchdog
+  timer_channel_s* d = timer_pool_alloc(time_to_ns64(HOURS_E, 1), TIMER_CAP_ONESHOT);
+  MOCK_EXPECT(d == &qtimer_slow);
+  MOCK_EXPECT(timer_pool_alloc(time_to_ns64(MICROS_E, 1), TIMER_CAP_ONESHOT) == NULL);
+
+  // Capabilities filter, only the GPT and QuadTimers capture
+  timer_pool_free(c);
+  timer_pool_free(b);
+  MOCK_EXPECT(timer_pool_alloc(time_to_ns64(MICROS_E, 1), TIMER_CAP_CAPTURE | TIMER_CAP_READ) == &gpt);
+
+  // Arm and expire through the generic layer
+  uint32_t fired = 0;
+  timer_channel_arm_ns(a, time_to_ns64(MICROS_E, 5), &mock_expired_cb, &fired);
+  MOCK_EXPECT(g_mock_armed_ticks == 1000);
+  timer_channel_expired(a);
+  MOCK_EXPECT(fired == 1);
+
+  uint32_t cancels = g_mock_cancels;
+  timer_channel_cancel(a);
+  timer_channel_expired(a); // Late ISR after a cancel runs nothing
+  MOCK_EXPECT(fired == 1 && g_mock_cancels == cancels + 1);
+
+  timer_pool_reset();
+  MOCK_END();
+}
@@ -0,0 +1,14 @@
+/**
+ * @authors   Ario Amin @ Permadev,
+ * @copyright Copyright (c) 2021-2026, MIT-License included in project toplevel dir
+ */
+
+#ifndef MOCKTESTS_TIMER_DRIVER_H
+#define MOCKTESTS_TIMER_DRIVER_H
+
+#include <stdint.h>
+
+/** @brief Channel allocation, ns to tick conversion and expiry through a mock backend, returns failure count */
+uint32_t test_timer_driver();
+
+#endif // MOCKTESTS_TIMER_DRIVER_H
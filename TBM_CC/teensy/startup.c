@@ -1,5 +1,6 @@
 #include "sys/mpu.h"
 #include "sys/heap.h"
+#include "sys/irq_dispatch.h"
 #include "sys/memory_map.h"
 
 extern unsigned long _stextload;
@@ -13,12 +14,6 @@ extern unsigned long _ebss;
 extern unsigned long _flexram_bank_config;
 extern unsigned long _estack;
 
-#ifndef NVIC_IRQs
-  #define NVIC_IRQs 0xa0
-#endif
-
-typedef void (*void_func)(void);
-
 static void
 memory_copy(uint32_t* dest, const uint32_t* src, uint32_t* dest_end);
 static void
@@ -29,7 +24,7 @@ int  execute();
 
 __attribute__((/* section(".vectors"),*/ used, aligned(0x400)))
 /**
- * @brief IRQ Function vector
+ * @brief IRQ Function vector, .bss so it lives in DTCM, VTOR points here after irq_dispatch_init()
  *
  * @attribute: used, aligned(0x400),
  */
@@ -65,6 +60,7 @@ startup()
     "ORR r1, R1, (0xF << 20)\n"  // ; Set bits 20-23 to enable CP10 and CP11 coprocessors
     "STR r1, [R0]");           // ; Write back the modified value to the CPACRDSBISB) ;
     
+  irq_dispatch_init(); // VTOR -> __vectors_ram__, see sys/irq_dispatch.h
   __asm__ volatile("CPSIE i" ::: "memory"); // enable irqs
 
   // Need to read MPU section of ARM refman again to learn why the current